@@ -55,7 +55,7 @@ enum {VEC_MP = 4000, VEC_D, MAT_MP, MAT_D, COMP_MP, COMP_D, VEC_RAT, MAT_RAT, CO
 
 
 enum {INACTIVE = 500, ACTIVE};
-enum {PARSING = 1000, TYPE_CONFIRMATION, DATA_TRANSMISSION, NUMPACKETS};
+enum {PARSING = 1000, TYPE_CONFIRMATION, DATA_TRANSMISSION, NUMPACKETS, PATH_TELEMETRY};
 
 
 
@@ -78,6 +78,7 @@ int bertini_main_wrapper(const std::vector<std::string> & options,  int num_proc
 
 
 
+
 /**
  Print the Bertini splash screen to the screen.
  */
@@ -462,48 +463,60 @@ int compare_integers_increasing(const void * left_in, const void * right_in);
 
 
 /**
- \brief Broadcast send a patch to everyone
+ \brief Broadcast send a patch to everyone in a communicator
 
  \param patch a pointer to a patch to send
+ \param root The id of the sending process, in comm
+ \param comm The communicator over which to broadcast
  */
-void send_patch_mp   (const patch_eval_data_mp * patch);
+void send_patch_mp(const patch_eval_data_mp * patch, int root, MPI_Comm comm);
 /**
- \brief Broadcast receive a patch from 0
+ \brief Broadcast receive a patch from the root of a communicator
 
  \param patch a pointer to a patch to receive into
+ \param root The id of the sending process, in comm
+ \param comm The communicator over which to broadcast
  */
-void receive_patch_mp(patch_eval_data_mp * patch);
+void receive_patch_mp(patch_eval_data_mp * patch, int root, MPI_Comm comm);
 
 
 
 /**
- \brief Broadcast send a patch to everyone
+ \brief Broadcast send a patch to everyone in a communicator
 
  \param patch a pointer to a patch to send
+ \param root The id of the sending process, in comm
+ \param comm The communicator over which to broadcast
  */
-void send_patch_d   (const patch_eval_data_d * patch);
+void send_patch_d(const patch_eval_data_d * patch, int root, MPI_Comm comm);
 /**
- \brief Broadcast receive a patch from 0
+ \brief Broadcast receive a patch from the root of a communicator
 
  \param patch a pointer to a patch to receive into
+ \param root The id of the sending process, in comm
+ \param comm The communicator over which to broadcast
  */
-void receive_patch_d(patch_eval_data_d * patch);
+void receive_patch_d(patch_eval_data_d * patch, int root, MPI_Comm comm);
 
 
 
 
 /**
- \brief Broadcast send a preproc_data to everyone
+ \brief Broadcast send a preproc_data to everyone in a communicator
 
  \param PPD a pointer to a preproc_data to send
+ \param root The id of the sending process, in comm
+ \param comm The communicator over which to broadcast
  */
-void send_preproc_data(const preproc_data *PPD);
+void send_preproc_data(const preproc_data *PPD, int root, MPI_Comm comm);
 /**
- \brief Broadcast receive a preproc_data from 0
+ \brief Broadcast receive a preproc_data from the root of a communicator
 
  \param PPD a pointer to a preproc_data to receive into
+ \param root The id of the sending process, in comm
+ \param comm The communicator over which to broadcast
  */
-void receive_preproc_data(preproc_data *PPD);
+void receive_preproc_data(preproc_data *PPD, int root, MPI_Comm comm);
 
 
 
@@ -512,32 +525,36 @@ void receive_preproc_data(preproc_data *PPD);
  \brief send a matrix to a single target.
 
  \param A matrix to send
- \param target Where to send it relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_mat_d(const mat_d A, int target);
+void send_mat_d(const mat_d A, int target, MPI_Comm comm);
 /**
  \brief receive a matrix from a single source.
 
  \param A matrix to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_mat_d(mat_d A, int source);
+void receive_mat_d(mat_d A, int source, MPI_Comm comm);
 
 
 /**
  \brief send a matrix to a single target.
 
  \param A matrix to send
- \param target Where to send it relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_mat_mp(const mat_mp A, int target);
+void send_mat_mp(const mat_mp A, int target, MPI_Comm comm);
 /**
  \brief receive a matrix from a single source.
 
  \param A matrix to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_mat_mp(mat_mp A, int source);
+void receive_mat_mp(mat_mp A, int source, MPI_Comm comm);
 
 
 /**
@@ -546,18 +563,20 @@ void receive_mat_mp(mat_mp A, int source);
  \param A_d The double matrix to send
  \param A_mp The mp matrix to send
  \param A_rat The rational matrix to send
- \param target Where to send it relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_mat_rat(const mat_d A_d, const mat_mp A_mp, const mpq_t ***A_rat, int target);
+void send_mat_rat(const mat_d A_d, const mat_mp A_mp, const mpq_t ***A_rat, int target, MPI_Comm comm);
 /**
  \brief Simultaneously receive a double, mp, and rational matrix from a single source.
 
  \param A_d The double matrix to receive into
  \param A_mp The mp matrix to receive into
  \param A_rat The rational matrix to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_mat_rat(mat_d A_d, mat_mp A_mp, mpq_t ***A_rat, int source);
+void receive_mat_rat(mat_d A_d, mat_mp A_mp, mpq_t ***A_rat, int source, MPI_Comm comm);
 
 
 
@@ -565,31 +584,35 @@ void receive_mat_rat(mat_d A_d, mat_mp A_mp, mpq_t ***A_rat, int source);
  \brief send a vector to a single target.
 
  \param b matrix to send
- \param target Where to send it, relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_vec_d(const vec_d b, int target);
+void send_vec_d(const vec_d b, int target, MPI_Comm comm);
 /**
  \brief receive a vector from a single source.
 
  \param b matrix to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_vec_d(vec_d b, int source);
+void receive_vec_d(vec_d b, int source, MPI_Comm comm);
 
 /**
  \brief send a vector to a single target.
 
  \param b matrix to send
- \param target Where to send it, relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_vec_mp(const vec_mp b, int target);
+void send_vec_mp(const vec_mp b, int target, MPI_Comm comm);
 /**
  \brief receive a vector from a single source.
 
  \param b matrix to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_vec_mp(vec_mp b, int source);
+void receive_vec_mp(vec_mp b, int source, MPI_Comm comm);
 
 
 /**
@@ -597,17 +620,19 @@ void receive_vec_mp(vec_mp b, int source);
 
  \param b matrix to send
  \param size the number of entries
- \param target Where to send it, relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_vec_rat(const mpq_t ***b, int size, int target);
+void send_vec_rat(const mpq_t ***b, int size, int target, MPI_Comm comm);
 /**
  \brief receive a vector from a single source.
 
  \param b matrix to receive into
  \param size the number of entries
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_vec_rat(mpq_t ***b, int size, int source);
+void receive_vec_rat(mpq_t ***b, int size, int source, MPI_Comm comm);
 
 
 
@@ -617,16 +642,18 @@ void receive_vec_rat(mpq_t ***b, int size, int source);
  \brief send a complex number to a single target.
 
  \param c Number to send
- \param target Where to send it, relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_comp_d(const comp_d c, int target);
+void send_comp_d(const comp_d c, int target, MPI_Comm comm);
 /**
  \brief Receive a complex number from a single source.
 
  \param c Number to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_comp_d(comp_d c, int source);
+void receive_comp_d(comp_d c, int source, MPI_Comm comm);
 
 
 
@@ -642,17 +669,19 @@ void receive_comp_d(comp_d c, int source);
 
  \param c Number to send
  \param num How many there are
- \param target Where to send it, relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_comp_num_d(const comp_d *c, int num, int target);
+void send_comp_num_d(const comp_d *c, int num, int target, MPI_Comm comm);
 /**
  \brief Receive an array of complex numbers from a single source.
 
  \param c Number to receive into
  \param num How many there are
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_comp_num_d(comp_d *c, int num, int source);
+void receive_comp_num_d(comp_d *c, int num, int source, MPI_Comm comm);
 
 
 
@@ -665,16 +694,18 @@ void receive_comp_num_d(comp_d *c, int num, int source);
  \brief send a complex number to a single target.
 
  \param c Number to send
- \param target Where to send it, relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_comp_mp(const comp_mp c, int target);
+void send_comp_mp(const comp_mp c, int target, MPI_Comm comm);
 /**
  \brief Receive a complex number from a single source.
 
  \param c Number to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_comp_mp(comp_mp c, int source);
+void receive_comp_mp(comp_mp c, int source, MPI_Comm comm);
 
 
 /**
@@ -682,33 +713,37 @@ void receive_comp_mp(comp_mp c, int source);
 
  \param c array of numbers to send
  \param num How many of them there are.
- \param target Where to send them, relative to MPI_COMM_WORLD
+ \param target Where to send them, relative to comm
+ \param comm The communicator
  */
-void send_comp_num_mp(const comp_mp *c, int num, int target);
+void send_comp_num_mp(const comp_mp *c, int num, int target, MPI_Comm comm);
 /**
  \brief Receive an array of complex numbers from a single target.
 
  \param c array of numbers to receive into
  \param num How many of them there are.
- \param source Where to receive them from, relative to MPI_COMM_WORLD
+ \param source Where to receive them from, relative to comm
+ \param comm The communicator
  */
-void receive_comp_num_mp(comp_mp *c, int num, int source);
+void receive_comp_num_mp(comp_mp *c, int num, int source, MPI_Comm comm);
 
 
 /**
  \brief send a single complex number to a single target.
 
  \param c number to send
- \param target Where to send it, relative to MPI_COMM_WORLD
+ \param target Where to send it, relative to comm
+ \param comm The communicator
  */
-void send_comp_rat(const mpq_t c[2], int target);
+void send_comp_rat(const mpq_t c[2], int target, MPI_Comm comm);
 /**
  \brief Receive a complex number from a single source.
 
  \param c Number to receive into
- \param source Where to receive it from, relative to MPI_COMM_WORLD
+ \param source Where to receive it from, relative to comm
+ \param comm The communicator
  */
-void receive_comp_rat(mpq_t c[2], int source);
+void receive_comp_rat(mpq_t c[2], int source, MPI_Comm comm);
 
 
 /**
@@ -716,17 +751,19 @@ void receive_comp_rat(mpq_t c[2], int source);
 
  \param c array of numbers to send
  \param num How many of them there are.
- \param target Where to send them, relative to MPI_COMM_WORLD
+ \param target Where to send them, relative to comm
+ \param comm The communicator
  */
-void send_comp_num_rat(const mpq_t c[][2], int num, int target);
+void send_comp_num_rat(const mpq_t c[][2], int num, int target, MPI_Comm comm);
 /**
  \brief Receive an array of complex numbers from a single target.
 
  \param c array of numbers to receive into
  \param num How many of them there are.
- \param source Where to receive them from, relative to MPI_COMM_WORLD
+ \param source Where to receive them from, relative to comm
+ \param comm The communicator
  */
-void receive_comp_num_rat(const mpq_t c[][2], int num, int source);
+void receive_comp_num_rat(const mpq_t c[][2], int num, int source, MPI_Comm comm);
 
 
 
@@ -781,5 +818,59 @@ void print_comp_matlab(const comp_d M,std::string name);
 
 
 
+/**
+ \brief Write a multiple precision number to a file in exact binary form.
+
+ Unlike print_mp and mpf_out_str, there is no conversion to decimal, so writing and reading back are linear in the number of limbs, and lossless.  The format is machine-independent, being built on mpz_out_raw.
+
+ \param OUT The file to write to, opened in binary mode.
+ \param x The number to write.
+ */
+void write_mp_raw(FILE *OUT, const mpf_t x);
+
+/**
+ \brief Read a multiple precision number written by write_mp_raw.
+
+ The number is rounded to the current precision of x.
+
+ \throws runtime_error on premature end of file.
+ \param x The number to set.  Must already be initialized.
+ \param IN The file to read from.
+ */
+void read_mp_raw(mpf_t x, FILE *IN);
+
+/**
+ \brief Write a complex multiple precision number to a file in exact binary form.
+ \see write_mp_raw
+ \param OUT The file to write to.
+ \param c The number to write.
+ */
+void write_comp_mp_raw(FILE *OUT, const comp_mp c);
+
+/**
+ \brief Read a complex multiple precision number written by write_comp_mp_raw.
+ \param c The number to set.  Must already be initialized.
+ \param IN The file to read from.
+ */
+void read_comp_mp_raw(comp_mp c, FILE *IN);
+
+/**
+ \brief Write a multiple precision vector to a file in exact binary form, size first.
+ \see write_mp_raw
+ \param OUT The file to write to.
+ \param v The vector to write.
+ */
+void write_vec_mp_raw(FILE *OUT, const vec_mp v);
+
+/**
+ \brief Read a multiple precision vector written by write_vec_mp_raw, resizing as necessary.
+ \param v The vector to set.  Must already be initialized.
+ \param IN The file to read from.
+ */
+void read_vec_mp_raw(vec_mp v, FILE *IN);
+
+
+
+
 
 #endif
@@ -18,5 +18,23 @@
 #include "decompositions/surface.hpp"
 #include "decompositions/curve.hpp"
 #include "parallelism.hpp"
+#include "job_service.hpp"
+#include "sampler.hpp"
+
+
+
+
+/**
+ \brief decompose, as bertini_real does when called from the command line, on every process.
+
+ Moves into the run's workspace, parses the input, sets up the tracker config, and runs the ubermaster on the head and the workers on the others.  MPI must be initialized, and is left so.
+
+ The workers are dismissed whether or not the head succeeded, so that the processes stay in step for whatever runs next.  A worker which throws aborts the run, since the head is waiting on it.
+
+ \return 0 on success, nonzero if the decomposition failed.  The same on every process.
+ \param program_options The options, parsed from the command line.
+ */
+int RunDecomposition(BertiniRealConfig & program_options);
+
 
 #endif
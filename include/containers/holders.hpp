@@ -563,6 +563,17 @@ public:
 	}
 
 
+	/**
+	 \brief set the names.
+
+	 \param names the new names, in the order of the variables.
+	 */
+	void set_variable_names(std::vector<std::string> const& names)
+	{
+		this->variable_names = names;
+	}
+
+
 	/**
 	 \brief read variable names from names.out
 
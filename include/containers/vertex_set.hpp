@@ -193,6 +193,27 @@ public:
 	 */
 	int setup_vertices(boost::filesystem::path INfile);
 
+	/**
+	 \brief create a VertexSet from an already-open file.
+
+	 \see setup_vertices
+	 \param IN the open file from which to read, {\em e.g.} a chunk of a DecompositionArchive.
+	 \return the number of vertices read in.
+	 */
+	int setup_vertices(FILE *IN);
+
+
+	/**
+	 \brief create a VertexSet from a file written by print_binary.
+
+	 Much faster than setup_vertices, as there is no conversion from decimal.
+
+	 \throws runtime_error if the file is not a binary VertexSet, or ends prematurely.
+	 \param IN the open file from which to read, in binary mode.
+	 \return the number of vertices read in.
+	 */
+	int setup_vertices_binary(FILE *IN);
+
 
 
 
@@ -284,6 +305,17 @@ public:
 	void print(boost::filesystem::path const& outputfile) const;
 
 
+	/**
+	 \brief write VertexSet to a file in exact binary form, for fast re-loading.
+
+	 The contents are the same as those of print, in the same order, preceded by the magic string "BRVERTX1".  Integers are in the byte order of the writing machine, and numbers are written with write_vec_mp_raw.
+
+	 \see setup_vertices_binary
+	 \param outputfile the name of the file to write the VertexSet to.
+	 */
+	void print_binary(boost::filesystem::path const& outputfile) const;
+
+
 
 	/**
 	 set the name of the current input file.  while it is set to this, all added vertices will inherit the index of this name.
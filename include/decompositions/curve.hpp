@@ -209,6 +209,18 @@ public:
 	int setup(boost::filesystem::path containing_folder);
 
 
+	/**
+	 \brief Read a Decomposition from a location in a DecompositionArchive.
+
+	 Only the "decomp", "E.edge" and "curve.cnums" chunks at the location are read.
+
+	 \return the number 1.  Seems stupid.
+
+	 \param location The location of the Decomposition in the archive.
+	 */
+	int setup(ArchiveLocation const& location);
+
+
 
 	/**
 	 \brief open a folder as an edges file, and parse it into the vector of edges in this Decomposition.
@@ -218,7 +230,25 @@ public:
 	 */
 	int setup_edges(boost::filesystem::path INfile);
 
+	/**
+	 \brief parse an already-open edges file into the vector of edges in this Decomposition.
+
+	 \return the number of edges added
+	 \param IN the open file, from which to read.
+	 */
+	int setup_edges(FILE *IN);
+
 	int setup_cycle_numbers(boost::filesystem::path INfile);
+
+	/**
+	 \brief parse an already-open cycle number file.
+
+	 \throws runtime_error if the number of edges does not match that already read.
+	 \return the number of edges
+	 \param IN the open file, from which to read.
+	 \param source_name The name of the source, for error messages.
+	 */
+	int setup_cycle_numbers(FILE *IN, std::string const& source_name);
 	/**
 
 	 \brief Write all the edges in this Decomposition to a file.
@@ -691,7 +721,7 @@ public:
 	void FixedSamplerWorker(VertexSet & V,
 									  sampler_configuration & sampler_options,
 									  SolverConfiguration & solve_options);
-	int ReportEdgeMaster(VertexSet & V, SolverConfiguration & solve_options);
+	int ReportEdgeMaster(VertexSet & V, sampler_configuration & sampler_options, SolverConfiguration & solve_options);
 	void ReportEdgeWorker(int edge_index, VertexSet const& V, SolverConfiguration & solve_options);
 
 
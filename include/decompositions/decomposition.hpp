@@ -4,6 +4,8 @@
 #include "nag/system_randomizer.hpp"
 #include "nag/witness_set.hpp"
 #include "containers/vertex_set.hpp"
+#include "io/archive.hpp"
+#include "run_profile.hpp"
 
 /**
  \brief base Decomposition class.  curves and surfaces inherit from this.
@@ -93,6 +95,23 @@ public:
 	 */
 	int setup(boost::filesystem::path INfile);
 
+	/**
+	 set up the base decomposition class from the "decomp" chunk of an archive.
+
+	 \return the number 0. seems useless.
+	 \param location The location in the archive of the decomposition.
+	 */
+	int setup(ArchiveLocation const& location);
+
+	/**
+	 set up the base decomposition class from an already-open stream, in the format of the "decomp" file.
+
+	 \return the number 0. seems useless.
+	 \param fin The stream from which to read.
+	 \param directoryName The folder relative to which the name of the input file is taken.
+	 */
+	int setup(std::istream & fin, boost::filesystem::path const& directoryName);
+
 
 	/**
 	 base method for printing decomposition to file.
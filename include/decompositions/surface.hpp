@@ -6,6 +6,8 @@
 /** \file surface.hpp */
 
 
+#include <functional>
+
 #include "nag/solvers/midpoint.hpp"
 #include "decompositions/curve.hpp"
 #include "cells/face.hpp"
@@ -262,6 +264,83 @@ public:
 };
 
 
+/**
+ \brief the stages of a surface Decomposition which do not depend on the bounding sphere.
+
+ The witness set for the critical curve, the deflated singular curves, and the critical points of both are the most costly part of a surface Decomposition, and none of them depends on the sphere.  Surface::main writes them into the folder `sphere_independent` of the Decomposition, along with the systems they refer to, the projections, and a copy of the input file.  A later run with -reuse and another sphere, for the same component, input file and projections, reads them back rather than computing them, and redoes only the sphere curve, the sphere intersections, the critical slice values, the slices and the faces.
+
+ The critical points are kept as they were found, before being filtered for the sphere, so that a larger sphere sees all of them.
+ */
+class SphereIndependentStages
+{
+
+public:
+
+	WitnessSet critcurve; ///< the witness set for the critical curve, in the system of its own input file.
+	std::map< SingularObjectMetadata, WitnessSet > split_sets; ///< the witness sets for the singular curves, each in its deflated system.
+	WitnessSet critcurve_crit; ///< the critical points of the critical curve, real and unique.
+	WitnessSet singular_points_on_critical_curve; ///< the singular points of the critical curve, real and unique.
+	std::map< SingularObjectMetadata, WitnessSet > singular_crit; ///< the critical points of each singular curve, real and unique.
+	std::map< SingularObjectMetadata, WitnessSet > singular_points_on_singular_curve; ///< the singular points of each singular curve, real and unique.
+
+
+	/**
+	 \brief the name of the folder in a Decomposition holding the stages.
+	 */
+	static boost::filesystem::path FolderName()
+	{
+		return "sphere_independent";
+	}
+
+
+	/**
+	 \brief copy the stages of an earlier Decomposition into the workspace, and take its projections.
+
+	 Called before the projections are given to the VertexSet, so that the whole run uses the projections the stages were computed with.  The copy is needed because a Decomposition being redone in place is backed up before it is read.
+
+	 \return whether the earlier Decomposition has stages to reuse.  If not, pi is left alone.
+	 \param decomposition The folder of the earlier Decomposition.
+	 \param pi The projections, to be overwritten.
+	 \param num_vars The number of variables, including the homogenizing one.
+	 */
+	static bool Fetch(boost::filesystem::path const& decomposition, vec_mp *pi, int num_vars);
+
+
+	/**
+	 \brief write the stages into a folder, and the systems they refer to.
+
+	 \param folder The folder to write.  Replaced if it exists.
+	 \param input_file The input file of the surface.
+	 \param W_surf The witness set of the surface.
+	 \param pi The two projections.
+	 */
+	void Write(boost::filesystem::path const& folder, boost::filesystem::path const& input_file, WitnessSet const& W_surf, vec_mp *pi) const;
+
+
+	/**
+	 \brief read the stages fetched into the workspace, and copy the systems they refer to into the workspace.
+
+	 \return whether there were stages for this surface: the same input file, component and projections.  If not, nothing is read.
+	 \param input_file The input file of the surface.
+	 \param W_surf The witness set of the surface.
+	 \param pi The two projections.
+	 */
+	bool Read(boost::filesystem::path const& input_file, WitnessSet const& W_surf, vec_mp *pi);
+
+
+private:
+
+	/**
+	 \brief where Fetch puts the stages, in the workspace.
+	 */
+	static boost::filesystem::path WorkspaceCopy()
+	{
+		return "reused_sphere_independent";
+	}
+};
+
+
+
 /**
  \brief Bertini_real surface Decomposition.
 
@@ -430,14 +509,32 @@ public:
 	 */
 	void read_faces(boost::filesystem::path load_from_me);
 
+	/**
+	 \brief set up the faces in a surface Decomposition from an already-open stream
+
+	 \param fin the stream from which to read, in the format of F.faces.
+	 */
+	void read_faces(std::istream & fin);
+
 
 	/**
 	 \brief set up a Surface from a set of files
 
+	 If the folder contains a DecompositionArchive, the Surface is read from it instead of from the individual files.
+
 	 \param base the folder in which the Decomposition lives.
 	 */
 	void setup(boost::filesystem::path base);
 
+	/**
+	 \brief set up a Surface from a location in a DecompositionArchive.
+
+	 Only the chunks holding the decompositions themselves are read -- the copies of witness data, input files and the like are left untouched.
+
+	 \param location The location of the Surface in the archive.
+	 */
+	void setup(ArchiveLocation const& location);
+
 
 	/**
 	 \brief print a surface Decomposition to a set of files located in folder base.
@@ -518,24 +615,64 @@ public:
 						   SolverConfiguration & solve_options);
 
 	/**
-	 \brief compute the critical points of all singular curves.
+	 \brief compute the critical points of all singular curves, without regard to the sphere.
 
 	 \see deflate_and_split
+	 \see add_singular_crit
 
-	 \param W_singular_crit A return parameter, contains the computed critical points.
+	 \param singular_crit A return parameter, contains the computed critical points of each singular curve.
+	 \param singular_points_on_singular_curve A return parameter, contains the singular points of each singular curve.
 	 \param split_sets The split witness sets for the critical curves, produced by deflate_and_split
-	 \param V the total vertex set into which to deposit the computed points on the surfaces.
 	 \param program_options The current state of Bertini_real
 	 \param solve_options The current state of the Solver.
 	 */
-	void compute_singular_crit(WitnessSet & W_singular_crit,
-							   WitnessSet & W_singular_points_on_singular_curve, // output
+	void compute_singular_crit(std::map<SingularObjectMetadata, WitnessSet> & singular_crit,
+							   std::map<SingularObjectMetadata, WitnessSet> & singular_points_on_singular_curve,
 							   const std::map<SingularObjectMetadata, WitnessSet> & split_sets,
-							   VertexSet & V,
 							   BertiniRealConfig & program_options,
 							   SolverConfiguration & solve_options);
 
 
+	/**
+	 \brief add the critical points of the singular curves which are inside the sphere to the singular curves, and collect them.
+
+	 \param W_singular_crit A return parameter, contains the critical points of all the singular curves, inside the sphere.
+	 \param W_singular_points_on_singular_curve A return parameter, contains the singular points of all the singular curves, inside the sphere.
+	 \param stages The sphere-independent stages, holding the critical points as computed by compute_singular_crit.
+	 \param V the total vertex set into which to deposit the computed points on the surfaces.
+	 \param program_options The current state of Bertini_real
+	 */
+	void add_singular_crit(WitnessSet & W_singular_crit,
+						   WitnessSet & W_singular_points_on_singular_curve,
+						   SphereIndependentStages const& stages,
+						   VertexSet & V,
+						   BertiniRealConfig & program_options);
+
+
+	/**
+	 \brief compute the stages of the Decomposition which do not depend on the sphere: the critical curve, the singular curves, and their critical points.
+
+	 \param stages A return parameter, the computed stages.
+	 \param W_surf the witness set for the surface.
+	 \param program_options The current state of Bertini_real
+	 \param solve_options The current state of the solver.
+	 */
+	void compute_sphere_independent(SphereIndependentStages & stages,
+									const WitnessSet & W_surf,
+									BertiniRealConfig & program_options,
+									SolverConfiguration & solve_options);
+
+
+	/**
+	 \brief set up the randomizers of the critical and singular curves for stages read by SphereIndependentStages::Read, as computing them would have.
+
+	 \param stages The stages read.
+	 \param solve_options The current state of the solver.
+	 */
+	void prepare_reused_stages(SphereIndependentStages const& stages,
+							   SolverConfiguration & solve_options);
+
+
 	/**
 	 \brief decompose all singular curves.
 
@@ -595,6 +732,8 @@ public:
 	/**
 	 \brief compute critical points of the regular critical curve.
 
+	 The points are not filtered for the sphere.
+
 	 \param W_critcurve_crit The computed value, containing the critical points of the critical curve.
 	 \param W_critcurve Witness set for the critical curve.
 	 \param program_options The current state of Bertini_real
@@ -831,9 +970,10 @@ public:
 	/**
 	\brief Sample a face of the surface.
 
+	\return whether every track succeeded.  a face with a failed track is sampled as well as it can be, but is not journaled as complete.
 	\param face_index The integer index of the face to sample.
 	*/
-	void AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configuration & sampler_options,
+	bool AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configuration & sampler_options,
 										SolverConfiguration & solve_options, std::vector<int> const& num_ribs_between_crits);
 
 	void DegenerateSampleFace(int face_index, VertexSet & V, sampler_configuration & sampler_options,
@@ -844,9 +984,41 @@ public:
 
 
 	/**
-	Given straight-line sampled ribs on a face, stitch together to form a triangulation, and add to the samples have for the surface.
+	\brief Sample every face in the range set in sampler_options, resuming from and recording to the face journal.
+
+	Faces already recorded in a compatible journal are replayed rather than sampled.  Each face sampled successfully is appended to this run's journal as soon as it is done.
+
+	\see FaceJournal
+	\param V The vertex set holding the vertices.
+	\param sampler_options The current state of the sampler program.
+	\param sample_face The method sampling a single face, by index.  Returns whether the face completed, and so should be journaled.
+	*/
+	void SampleFaces(VertexSet & V, sampler_configuration & sampler_options,
+					 std::function<bool(int)> const& sample_face);
+
+	/**
+	Given straight-line sampled ribs on a face, stitch together to form a triangulation, and set it as the samples for the face.
+	*/
+	void StitchRibs(std::vector<Rib> const& ribs, VertexSet & V, int face_index);
+
+	/**
+	\brief Stitch straight-line sampled ribs on a face together to form a triangulation, without storing it.
+
+	\return the triangles.
+	\param ribs The ribs, in order from left to right.
+	\param V The vertex set the ribs refer to.
+	*/
+	std::vector< Triangle > TriangulateRibs(std::vector<Rib> const& ribs, VertexSet & V) const;
+
+	/**
+	\brief Triangulate a face as a fan from its midpoint to its bounding edges, using only the vertices of the decomposition.
+
+	This is the coarsest valid mesh of the face, as plotted by the python `plot_surface_raw`.
+
+	\return the triangles, empty for a degenerate face.
+	\param face_index The index of the face.
 	*/
-	void StitchRibs(std::vector<Rib> const& ribs, VertexSet & V);
+	std::vector< Triangle > RawFaceTriangles(int face_index) const;
 
 	/**
 	 \brief Write the results of a sampling run to a folder.
@@ -998,6 +1170,24 @@ int find_matching_singular_witness_points(WitnessSet & W_match,
 
 
 
+/**
+ \brief split the points of a witness set by the corank of the Jacobian of the currently parsed system at each.
+
+ The corank is the first entry of a point's isosingular deflation sequence, so points in different groups cannot share a deflated system.  Grouping them before deflating means each deflation is tried only against the points which might satisfy it.
+
+ Assumes the system is already parsed.
+
+ \return the number of groups.
+ \param groups A computed value, the points of W by corank, each with the linears and patches of W.
+ \param W Input witness set, whose points satisfy the parsed system.
+ \param solve_options The current state of the solver.
+ */
+int group_by_jacobian_corank(std::map<int, WitnessSet> & groups,
+							 const WitnessSet & W,
+							 SolverConfiguration & solve_options);
+
+
+
 
 
 
@@ -1021,4 +1211,20 @@ void read_summary(std::vector<SingularObjectMetadata > & singular_multiplicities
 				  boost::filesystem::path INfile);
 
 
+/**
+ \brief Read the S.surf information from an already-open file.
+
+ \see read_summary
+
+ \param singular_multiplicities A returned value, containing the multiplicity information for the Decomposition.
+ \param temp_num_mid The number of midslices.
+ \param temp_num_crit The number of critslices.  Should be temp_num_mid+1.
+ \param IN The open file from which to read.
+ */
+void read_summary(std::vector<SingularObjectMetadata > & singular_multiplicities,
+				  int & temp_num_mid,
+				  int & temp_num_crit,
+				  FILE *IN);
+
+
 #endif
@@ -0,0 +1,253 @@
+#ifndef _BR_ARCHIVE_H
+#define _BR_ARCHIVE_H
+
+
+/**
+ \file archive.hpp
+
+ A single-file, chunked container for a complete decomposition.
+
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+
+
+
+/**
+ \brief A single-file container for an entire decomposition, with a table of contents.
+
+ A decomposition on disk is a folder full of small text files -- `decomp`, `E.edge`, `F.faces`, `S.surf`, `V.vertex`, and a sub-folder per curve.  The DecompositionArchive packs all of them into one file, so that a reader may seek directly to the part it needs, without opening dozens of files.
+
+ Each chunk is named by its path relative to the decomposition folder, using '/' as the separator, {\em e.g.} `curve_midslice_3/E.edge`.  The contents of a chunk are byte-for-byte the text file which would have been written, so every existing parser works on a chunk.
+
+ The layout of the file is
+
+ [
+ magic (8 bytes, "BRARCHV1")
+ offset of the table of contents (uint64)
+
+ chunk data, back to back
+
+ number of chunks (uint64)
+ for each chunk: length of name (uint64), name, offset (uint64), size (uint64)
+ ]
+
+ Integers are written in the byte order of the writing machine.
+
+ Opening an archive reads only the table of contents.  Chunks are read on request, and cached.
+ */
+class DecompositionArchive
+{
+
+public:
+
+	/**
+	 \brief the name of the archive file inside a decomposition folder.
+	 */
+	static const char * DefaultName()
+	{
+		return "decomposition.brarchive";
+	}
+
+
+	/**
+	 \brief pack every regular file beneath a folder into an archive.
+
+	 Files whose name begins with a '.', and the archive itself, are skipped.  The archive is first written to a temporary name, then renamed into place, so a reader never sees a partial archive.
+
+	 \param base The decomposition folder to pack.
+	 \param archive_name The name of the archive file to write.
+	 */
+	static void Pack(boost::filesystem::path const& base, boost::filesystem::path const& archive_name);
+
+
+	/**
+	 \brief pack every regular file beneath a folder into the default-named archive inside of it.
+
+	 \param base The decomposition folder to pack.
+	 */
+	static void Pack(boost::filesystem::path const& base)
+	{
+		Pack(base, base / DefaultName());
+	}
+
+
+	/**
+	 \brief query whether a folder contains an archive.
+
+	 \return whether the default-named archive exists in folder base.
+	 \param base The decomposition folder.
+	 */
+	static bool ExistsIn(boost::filesystem::path const& base)
+	{
+		return boost::filesystem::is_regular_file(base / DefaultName());
+	}
+
+
+
+
+	/**
+	 \brief open an archive, reading only its table of contents.
+
+	 \throws runtime_error if the file cannot be opened, or is not an archive.
+	 \param archive_name The name of the archive file.
+	 */
+	explicit DecompositionArchive(boost::filesystem::path const& archive_name);
+
+	~DecompositionArchive();
+
+	DecompositionArchive(const DecompositionArchive&) = delete;
+	DecompositionArchive & operator=(const DecompositionArchive&) = delete;
+
+
+
+	/**
+	 \brief query whether the archive holds a chunk.
+
+	 \return whether a chunk with the name is in the table of contents.
+	 \param name The name of the chunk, relative to the decomposition folder.
+	 */
+	bool HasChunk(std::string const& name) const
+	{
+		return toc_.find(name)!=toc_.end();
+	}
+
+
+	/**
+	 \brief get the names of all chunks in the archive.
+
+	 \return the names, in sorted order.
+	 */
+	std::vector<std::string> ChunkNames() const;
+
+
+	/**
+	 \brief read the contents of a chunk.
+
+	 Seeks to the chunk, and reads only it.  The contents are cached, so reading a chunk twice costs one read.
+
+	 \throws out_of_range if there is no such chunk.
+	 \return a reference to the contents of the chunk, valid for the lifetime of the archive.
+	 \param name The name of the chunk.
+	 */
+	const std::string & ReadChunk(std::string const& name) const;
+
+
+	/**
+	 \brief open a chunk as a read-only FILE*, for use with the fscanf and mpf_inp_str family of parsers.
+
+	 The stream is backed by the cached contents of the chunk, not by a file on disk.  Close it with fclose when done.
+
+	 \throws out_of_range if there is no such chunk.
+	 \throws runtime_error if the in-memory stream cannot be opened.
+	 \return an open FILE*, in 'r' mode.
+	 \param name The name of the chunk.
+	 */
+	FILE * OpenChunk(std::string const& name) const;
+
+
+	/**
+	 \brief get the name of the file this archive was read from.
+
+	 \return the path to the archive file.
+	 */
+	boost::filesystem::path filename() const
+	{
+		return filename_;
+	}
+
+private:
+
+	struct TocEntry
+	{
+		uint64_t offset; ///< the position of the first byte of the chunk in the file.
+		uint64_t size; ///< the number of bytes in the chunk.
+	};
+
+	boost::filesystem::path filename_; ///< the name of the archive file.
+	FILE *IN_; ///< the archive file, held open for seeking.
+
+	std::map<std::string, TocEntry> toc_; ///< the table of contents.
+	mutable std::map<std::string, std::string> cache_; ///< the contents of the chunks read so far.
+};
+
+
+
+/**
+ \brief A view into one decomposition inside an archive.
+
+ Nested decompositions (the slices and critical curves of a Surface) are stored in the same archive as their parent, under a prefix.  This little class carries the archive and the prefix together, so a setup method needs only ask for "decomp" or "E.edge".
+ */
+class ArchiveLocation
+{
+public:
+
+	ArchiveLocation(std::shared_ptr<DecompositionArchive> archive, std::string const& prefix = "") : archive_(archive), prefix_(prefix)
+	{}
+
+	/**
+	 \brief get a location nested beneath this one.
+
+	 \return the new location
+	 \param subfolder The name of the sub-folder, {\em e.g.} "curve_crit".
+	 */
+	ArchiveLocation operator/(std::string const& subfolder) const
+	{
+		return ArchiveLocation(archive_, prefix_ + subfolder + "/");
+	}
+
+	/**
+	 \brief get the full chunk name of a file at this location.
+	 \return prefix + name
+	 \param name The name of the file, {\em e.g.} "decomp".
+	 */
+	std::string ChunkName(std::string const& name) const
+	{
+		return prefix_ + name;
+	}
+
+	bool Has(std::string const& name) const
+	{
+		return archive_->HasChunk(ChunkName(name));
+	}
+
+	const std::string & Read(std::string const& name) const
+	{
+		return archive_->ReadChunk(ChunkName(name));
+	}
+
+	FILE * Open(std::string const& name) const
+	{
+		return archive_->OpenChunk(ChunkName(name));
+	}
+
+	/**
+	 \brief get the folder on disk to which this location corresponds.
+
+	 \return the folder containing the archive, with the prefix appended.
+	 */
+	boost::filesystem::path Folder() const
+	{
+		return archive_->filename().parent_path() / prefix_;
+	}
+
+	std::shared_ptr<DecompositionArchive> archive() const
+	{
+		return archive_;
+	}
+
+private:
+	std::shared_ptr<DecompositionArchive> archive_;
+	std::string prefix_;
+};
+
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef _BR_FACE_JOURNAL_H
+#define _BR_FACE_JOURNAL_H
+
+
+/**
+ \file face_journal.hpp
+
+ A restartable, append-only record of the faces of a surface which have been sampled.
+
+ */
+
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+#include "containers/vertex_set.hpp"
+#include "decompositions/surface.hpp"
+
+
+
+
+/**
+ \brief An append-only journal of completed faces, so that an interrupted surface sampling may be resumed, and so that ranges of faces sampled by independent jobs may be merged.
+
+ Journals live in the folder `sampling_journal` inside the decomposition.  Each run writes its own file -- `faces_all.journal` for a run over every face, or `faces_a-b.journal` for a run restricted with `-faces a-b` -- and on startup, every journal in the folder is read.  A journal is used only if it was written with the same sampler settings, for the same decomposition (by a hash of its vertex set, summary and faces), and for a surface with the same number of faces; others are ignored.
+
+ Each completed face is one record, appended and flushed as soon as the face is done.  A record holds the vertices the face's triangles refer to, and the triangles by local index into them.  Vertices which existed before the face was sampled (curve samples, mostly) are stored with their index, so that on replay they are re-used if the VertexSet is in the same order, and found by search otherwise.
+
+ The layout of a journal file is
+
+ [
+ magic (8 bytes, "BRFJRNL1")
+ length of settings signature (uint64), signature
+ number of faces of the surface (int32)
+
+ records, each as
+ 	begin marker (uint32)
+ 	face index (int32)
+ 	number of vertices (int32)
+ 	for each vertex: index before the face, or -1 if new (int64), type (int32), point (write_vec_mp_raw)
+ 	number of triangles (int32)
+ 	for each triangle: three local vertex indices (int32)
+ 	end marker (uint32)
+ ]
+
+ A record missing its end marker, as left by a run which died mid-write, is ignored, and truncated away before this run appends to the file.
+ */
+class FaceJournal
+{
+
+public:
+
+	/**
+	 \brief the folder in which journals are kept.
+
+	 \return output_dir / "sampling_journal"
+	 \param output_dir The decomposition folder.
+	 */
+	static boost::filesystem::path Directory(boost::filesystem::path const& output_dir)
+	{
+		return output_dir / "sampling_journal";
+	}
+
+
+	/**
+	 \brief open this run's journal for appending, and read all the journals in the folder.
+
+	 \param output_dir The decomposition folder.
+	 \param run_name The name of this run's journal, without extension, {\em e.g.} "faces_all".
+	 \param signature The sampler settings and the decomposition's hash, as text.  A journal is used only if its signature matches exactly.
+	 \param num_faces The number of faces of the surface being sampled.
+	 */
+	FaceJournal(boost::filesystem::path const& output_dir, std::string const& run_name, std::string const& signature, unsigned num_faces);
+
+	~FaceJournal();
+
+	FaceJournal(const FaceJournal&) = delete;
+	FaceJournal & operator=(const FaceJournal&) = delete;
+
+
+
+	/**
+	 \brief put the faces recorded in the journals back into a vertex set and triangulation.
+
+	 If a face appears in more than one journal, the first one read wins.
+
+	 \return the number of faces replayed.
+	 \param V The vertex set into which to add the vertices of the replayed faces.
+	 \param samples The triangulation, one entry per face.  The entries for replayed faces are set.
+	 */
+	unsigned Replay(VertexSet & V, std::vector< std::vector< Triangle > > & samples);
+
+
+	/**
+	 \brief query whether a face was recorded as complete, by this run or a previous one.
+
+	 \return whether the face is done.
+	 \param face_index The index of the face.
+	 */
+	bool IsComplete(int face_index) const
+	{
+		return completed_.find(face_index)!=completed_.end();
+	}
+
+
+	/**
+	 \brief append a completed face to this run's journal, and flush it to disk.
+
+	 \param face_index The index of the face.
+	 \param triangles The triangles of the face.
+	 \param V The vertex set the triangles refer to.
+	 \param first_new_vertex The number of vertices in V before this face was sampled.  Vertices at or past this index are stored as new.
+	 */
+	void Record(int face_index, std::vector< Triangle > const& triangles, VertexSet & V, unsigned first_new_vertex);
+
+
+	/**
+	 \brief get the name of the file this run appends to.
+	 \return the path to the journal file.
+	 */
+	boost::filesystem::path filename() const
+	{
+		return filename_;
+	}
+
+private:
+
+	struct JournalVertex
+	{
+		long long original_index; ///< the index in the vertex set at the time of recording, or -1 if the vertex was new with the face.
+		Vertex vertex; ///< the point and its type.
+	};
+
+	struct FaceRecord
+	{
+		int face_index;
+		std::vector< JournalVertex > vertices;
+		std::vector< int > triangles; ///< local vertex indices, three per triangle.
+	};
+
+
+	bool ReadHeader(FILE *IN) const;
+	void WriteHeader(FILE *OUT) const;
+
+	/**
+	 \brief read one journal, appending its complete records to records_.
+
+	 \return the offset of the end of the last complete record.
+	 */
+	long ReadJournal(boost::filesystem::path const& journal_name);
+
+
+	std::string signature_; ///< the sampler settings, as text, used to decide whether a journal is compatible.
+	unsigned num_faces_; ///< the number of faces of the surface.
+
+	boost::filesystem::path filename_; ///< this run's journal.
+	FILE *OUT_; ///< this run's journal, open for appending.
+
+	std::vector< FaceRecord > records_; ///< the records read at startup, to be replayed.
+	std::set<int> completed_; ///< the indices of the faces which are done.
+};
+
+
+#endif
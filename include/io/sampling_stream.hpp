@@ -0,0 +1,120 @@
+#ifndef _BR_SAMPLING_STREAM_H
+#define _BR_SAMPLING_STREAM_H
+
+
+/**
+ \file sampling_stream.hpp
+
+ A progressive, append-only text stream of sampling results, for viewers to follow while the sampler runs.
+
+ */
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+#include "containers/vertex_set.hpp"
+#include "decompositions/surface.hpp"
+
+
+
+
+/**
+ \brief A streaming record of a sampling run, written as it progresses, coarse to fine.
+
+ The sampler writes the decomposition's own cells first, as level 0, then each refinement pass of each face or edge as the next level.  A viewer keeps the most recent block for each face and edge, which is always the finest so far; at any moment, that collection is a valid mesh, which gets finer as the run goes on.  Level -1 marks a face or edge which arrives already at its finest: a face restored from a FaceJournal, or an edge sampled by an MPI worker, whose passes the master does not see.  The file is `samp.stream`, in the decomposition folder.
+
+ The file is line-oriented text, and every block ends with a line `end`, so a reader tailing the file can stop at the last complete block, and pick up from there later.  The blocks are
+
+ [
+ bertini_real_stream 1 <num_coordinates>     (once, first)
+
+ vertices <first_index> <count>
+ <count lines of num_coordinates dehomogenized, real coordinates>
+ end
+
+ face <face_index> <level> <num_triangles>
+ <num_triangles lines of three vertex indices>
+ end
+
+ edge <curve_name> <edge_index> <level> <num_samples>
+ <one line of num_samples vertex indices>
+ end
+
+ done                                          (once, last, if the run completed)
+ ]
+
+ Vertices are written before any face or edge which refers to them.  The curve name is the name of the folder of the curve's decomposition, {\em e.g.} `curve_midslice_3`.
+ */
+class SamplingStream
+{
+
+public:
+
+	/**
+	 \brief the name of the stream file inside a decomposition folder.
+	 */
+	static const char * DefaultName()
+	{
+		return "samp.stream";
+	}
+
+
+	/**
+	 \brief start a new stream, replacing any old one.
+
+	 \param filename The name of the file to write.
+	 \param num_natural_variables The number of natural variables, including the homogenizing one.
+	 */
+	SamplingStream(boost::filesystem::path const& filename, int num_natural_variables);
+
+	~SamplingStream();
+
+	SamplingStream(const SamplingStream&) = delete;
+	SamplingStream & operator=(const SamplingStream&) = delete;
+
+
+	/**
+	 \brief write a level of refinement of a face.
+
+	 \param face_index The index of the face.
+	 \param level The level of refinement.  0 is the raw decomposition, and -1 a face restored from a journal.
+	 \param triangles The triangulation of the face at this level.
+	 \param V The vertex set the triangles refer to.  New vertices are written first.
+	 */
+	void Face(int face_index, int level, std::vector< Triangle > const& triangles, VertexSet const& V);
+
+
+	/**
+	 \brief write a level of refinement of an edge of a curve.
+
+	 \param curve_name The name of the curve.
+	 \param edge_index The index of the edge.
+	 \param level The level of refinement.  0 is the raw decomposition, and -1 an edge sampled by a worker.
+	 \param indices The samples on the edge at this level, in order.
+	 \param V The vertex set the indices refer to.  New vertices are written first.
+	 */
+	void Edge(std::string const& curve_name, int edge_index, int level, std::vector<int> const& indices, VertexSet const& V);
+
+
+	/**
+	 \brief mark the stream as complete.
+	 */
+	void Finish();
+
+private:
+
+	/**
+	 \brief write any vertices of V not yet written.
+	 */
+	void SyncVertices(VertexSet const& V);
+
+	FILE *OUT_; ///< the stream file.
+	int num_natural_variables_; ///< the number of natural variables, including the homogenizing one.
+	unsigned num_written_vertices_; ///< how many of the vertex set's vertices have been written already.
+};
+
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef BR_JOB_SERVICE_H
+#define BR_JOB_SERVICE_H
+
+/**
+ \file job_service.hpp
+
+ contains the long-lived service which runs decomposition and sampling jobs, one after another, on one set of MPI processes.
+ */
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "programConfiguration.hpp"
+
+
+
+
+/**
+ \brief runs jobs submitted to a queue folder, on processes started once.
+
+ Starting MPI, and the processes, once per run costs more than the small runs of a decompose-sample-resample pipeline.  A JobService keeps the processes, and what they cache from one job to the next, such as the SLPs in the SystemCache, and runs each job as the program would have been run from the command line.
+
+ A job is a file `<name>.job` in the queue folder, whose first line is the program, `bertini_real` or `sampler`; whose second line is the folder in which to run it, in which the program would have been called; and whose remaining lines are the command line arguments, one per line.  Write it under another name and rename it into place, so that the service never sees half of it.  Jobs are run in order of their names.  The head claims a job by renaming it `<name>.running`, writes what it prints to `<name>.log`, and when it is done renames it `<name>.done`, or `<name>.failed` if the program threw or returned nonzero.  A file named `stop` in the queue folder ends the service once the job in progress is done.
+
+ A job fails if it fails on any process; the processes agree on this before going on to the next job.  bertini_real and sampler dismiss their workers even when the head throws, so a failed job leaves the processes in step, unless the head threw in the middle of a solve, with the workers busy in it.  A worker which throws aborts the run, and so the service, since the head is waiting on it; so does a job which exits, rather than throwing.
+ */
+class JobService
+{
+
+public:
+
+	/**
+	 \brief a program which can be run as a job.  It gets the job's command line, with the program's name first, and is run on every process, in the job's folder.
+	 */
+	typedef std::function<int(int, char**)> Program;
+
+
+	/**
+	 \param queue The queue folder.  Made if it does not exist.
+	 \param mpi_config The processes to run the jobs on.
+	 */
+	JobService(boost::filesystem::path const& queue, ParallelismConfig const& mpi_config);
+
+
+	/**
+	 \brief make a program available to jobs.
+
+	 \param name The name of the program, as given on the first line of a job.
+	 \param program The program.
+	 */
+	void Add(std::string const& name, Program program)
+	{
+		programs_[name] = program;
+	}
+
+
+	/**
+	 \brief run jobs until told to stop.
+
+	 Collective over the communicator of the service.  The head watches the queue, and broadcasts each job to the other processes, which wait for it.
+
+	 \return the number of jobs which failed.
+	 */
+	int Serve();
+
+private:
+
+	/**
+	 \brief on the head, wait for the next job, and claim it.
+
+	 Jobs which cannot be run, because the file is malformed, names an unknown program, or names a folder which does not exist, are marked failed here, and skipped.
+
+	 \return whether there is a job.  false means stop.
+	 \param[out] job The program, the folder, and the arguments.
+	 \param[out] name The name of the job, without extension.
+	 */
+	bool Claim(std::vector<std::string> & job, std::string & name) const;
+
+
+	/**
+	 \brief run a job, on every process.
+
+	 \return the value returned by the program, or 1 if it threw.
+	 \param job The program, the folder, and the arguments.
+	 \param log On the head, the file into which to write what the job prints.  Empty on the others.
+	 */
+	int Run(std::vector<std::string> const& job, boost::filesystem::path const& log) const;
+
+
+	/**
+	 \brief on the head, move a job from one state to another, by renaming its file.
+	 */
+	void Mark(std::string const& name, std::string const& from, std::string const& to) const;
+
+
+	boost::filesystem::path queue_; ///< the queue folder.
+	ParallelismConfig mpi_config_; ///< the processes the jobs run on.
+	std::map<std::string, Program> programs_; ///< the programs jobs may run, by name.
+	unsigned poll_seconds_ = 1; ///< how long the head waits between looks at an empty queue.
+};
+
+
+#endif
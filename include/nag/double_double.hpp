@@ -0,0 +1,210 @@
+#ifndef _BR_DOUBLE_DOUBLE_H
+#define _BR_DOUBLE_DOUBLE_H
+
+/**
+ \file double_double.hpp
+
+ A fixed size, unevaluated-sum-of-two-doubles number type, for arithmetic at about 106 bits without the allocation and dispatch of MPFR.
+ */
+
+#include <cmath>
+
+#include "bertini1/bertini_headers.hpp"
+
+
+
+
+/**
+ \brief a real number as the unevaluated sum hi+lo of two doubles, with |lo| <= ulp(hi)/2.
+
+ The algorithms are the usual ones of Dekker and of Hida, Li and Bailey, with the products' errors from fma.  Every operation is a handful of hardware double operations, so loops of them stay in registers and vectorize.
+ */
+struct DoubleDouble
+{
+	double hi; ///< the leading part.
+	double lo; ///< the trailing part.
+
+
+	/**
+	 \brief the number of bits of precision carried.  Working precisions at or below this, as asked for rather than as rounded up to whole limbs by GMP, are computed just as well in DoubleDouble.
+
+	 test/double_double/test_double_double.cpp checks the arithmetic against mpf to this many bits.
+	 */
+	static constexpr int kBits = 104;
+};
+
+
+
+/**
+ \brief a complex number with DoubleDouble real and imaginary parts.
+ */
+struct ComplexDoubleDouble
+{
+	DoubleDouble r; ///< the real part.
+	DoubleDouble i; ///< the imaginary part.
+};
+
+
+
+
+/**
+ \brief the sum of two doubles, assuming |a|>=|b|.
+ */
+inline DoubleDouble quick_two_sum(double a, double b)
+{
+	double s = a+b;
+	return DoubleDouble{s, b-(s-a)};
+}
+
+
+/**
+ \brief the exact sum of two doubles.
+ */
+inline DoubleDouble two_sum(double a, double b)
+{
+	double s = a+b;
+	double bb = s-a;
+	return DoubleDouble{s, (a-(s-bb)) + (b-bb)};
+}
+
+
+/**
+ \brief the exact product of two doubles.
+ */
+inline DoubleDouble two_prod(double a, double b)
+{
+	double p = a*b;
+	return DoubleDouble{p, std::fma(a,b,-p)};
+}
+
+
+
+inline DoubleDouble operator+(DoubleDouble const& a, DoubleDouble const& b)
+{
+	DoubleDouble s = two_sum(a.hi, b.hi);
+	DoubleDouble t = two_sum(a.lo, b.lo);
+	s.lo += t.hi;
+	s = quick_two_sum(s.hi, s.lo);
+	s.lo += t.lo;
+	return quick_two_sum(s.hi, s.lo);
+}
+
+
+inline DoubleDouble operator-(DoubleDouble const& a)
+{
+	return DoubleDouble{-a.hi, -a.lo};
+}
+
+
+inline DoubleDouble operator-(DoubleDouble const& a, DoubleDouble const& b)
+{
+	return a + (-b);
+}
+
+
+inline DoubleDouble operator*(DoubleDouble const& a, DoubleDouble const& b)
+{
+	DoubleDouble p = two_prod(a.hi, b.hi);
+	p.lo += a.hi*b.lo + a.lo*b.hi;
+	return quick_two_sum(p.hi, p.lo);
+}
+
+
+inline DoubleDouble operator*(DoubleDouble const& a, double b)
+{
+	DoubleDouble p = two_prod(a.hi, b);
+	p.lo += a.lo*b;
+	return quick_two_sum(p.hi, p.lo);
+}
+
+
+
+
+inline ComplexDoubleDouble operator+(ComplexDoubleDouble const& a, ComplexDoubleDouble const& b)
+{
+	return ComplexDoubleDouble{a.r+b.r, a.i+b.i};
+}
+
+
+inline ComplexDoubleDouble operator*(ComplexDoubleDouble const& a, ComplexDoubleDouble const& b)
+{
+	return ComplexDoubleDouble{a.r*b.r - a.i*b.i, a.r*b.i + a.i*b.r};
+}
+
+
+inline ComplexDoubleDouble operator*(ComplexDoubleDouble const& a, double b)
+{
+	return ComplexDoubleDouble{a.r*b, a.i*b};
+}
+
+
+/**
+ \brief whether a number is exactly zero.
+ */
+inline bool is_zero(ComplexDoubleDouble const& a)
+{
+	return a.r.hi==0 && a.i.hi==0;
+}
+
+
+
+
+/**
+ \brief round an MPFR number to the nearest DoubleDouble.
+
+ \return the rounded number.
+ \param x The number to round.
+ \param temp An initialized temporary, of at least the precision of x.
+ */
+inline DoubleDouble mpf_to_dd(mpf_t x, mpf_t temp)
+{
+	double hi = mpf_get_d(x);
+	mpf_set_d(temp, hi);
+	mpf_sub(temp, x, temp);
+	return quick_two_sum(hi, mpf_get_d(temp));
+}
+
+
+/**
+ \brief set an MPFR number to a DoubleDouble, rounded to its precision.
+
+ \param x The number to set.
+ \param a The value.
+ \param temp An initialized temporary.
+ */
+inline void dd_to_mpf(mpf_t x, DoubleDouble const& a, mpf_t temp)
+{
+	mpf_set_d(x, a.hi);
+	mpf_set_d(temp, a.lo);
+	mpf_add(x, x, temp);
+}
+
+
+/**
+ \brief round a multiple precision complex number to the nearest ComplexDoubleDouble.
+
+ \return the rounded number.
+ \param x The number to round.
+ \param temp An initialized temporary, of at least the precision of x.
+ */
+inline ComplexDoubleDouble mp_to_dd(comp_mp x, mpf_t temp)
+{
+	return ComplexDoubleDouble{mpf_to_dd(x->r, temp), mpf_to_dd(x->i, temp)};
+}
+
+
+/**
+ \brief set a multiple precision complex number to a ComplexDoubleDouble, rounded to its precision.
+
+ \param x The number to set.
+ \param a The value.
+ \param temp An initialized temporary.
+ */
+inline void dd_to_mp(comp_mp x, ComplexDoubleDouble const& a, mpf_t temp)
+{
+	dd_to_mpf(x->r, a.r, temp);
+	dd_to_mpf(x->i, a.i, temp);
+}
+
+
+#endif
@@ -317,6 +317,10 @@ private:
 	std::vector< std::vector< int> > homogenization_matrix_;
 	int num_variables_;
 
+	boost::filesystem::path filename_; ///< the witness_data file, from which the points are read as they are wanted.
+	std::vector<long> point_offsets_; ///< where each point starts in the file, by its index in point_metadata.
+	std::vector<int> loaded_index_; ///< where each point is in the PointHolder, once read by solution().  -1 until then.
+
 public:
 
 
@@ -341,15 +345,30 @@ public:
 		linear_metadata.resize(0);
 		patch_metadata.resize(0);
 
+		point_offsets_.resize(0);
+		loaded_index_.resize(0);
+
 	}
 
 
 	/** fills this object with the sets in witness_data.
+
+	 Only the metadata of the points, the linears and the patches are read; the coordinates of the points are skipped, and read by solution() when a witness set containing them is formed, so that the components which are not chosen cost only a pass over their text.
+
 	 \param T the current state of the tracker configuration
 	 */
 	void populate(tracker_config_t * T);
 
 
+	/**
+	 \brief get a witness point, reading it from witness_data the first time it is asked for.
+
+	 \return the point.
+	 \param index The index of the point, as in index_tracker.
+	 */
+	vec_mp & solution(int index);
+
+
 
 	/**
 	 \brief outermost method for choosing a witness set to construct.
@@ -362,6 +381,18 @@ public:
 	WitnessSet choose(BertiniRealConfig & options);
 
 
+	/**
+	 \brief pick the components to decompose in batch mode.
+
+	 The dimension is the target dimension if the user gave one, else the only nonempty dimension.  The components are those the user listed with -components, or all of that dimension.  Components which do not exist are reported and skipped.
+
+	 \param options The current state of the program.
+	 \param[out] dim The dimension of the components.
+	 \return the component numbers, in increasing order.  empty if the dimension could not be determined, or has none of the listed components.
+	 */
+	std::vector<int> choose_batch(BertiniRealConfig & options, int & dim);
+
+
 	/**
 	 form a witness set automagically, based on the user's call time options.
 
@@ -394,6 +425,39 @@ public:
 	WitnessSet form_specific_witness_set(int dim, int comp)	;
 
 
+	/**
+	 \brief get the components, by dimension.
+	 \return for each nonempty dimension, the number of points of each of its components.
+	 */
+	std::map<int,std::map<int,int> > const& components() const
+	{
+		return dimension_component_counter;
+	}
+
+
+	/**
+	 \brief get the points of a component.
+	 \return the indices of its points, as taken by solution(), in the order form_specific_witness_set adds them.
+	 \param dim The dimension.
+	 \param comp The component number, which must exist.
+	 */
+	std::vector<int> const& component_indices(int dim, int comp) const
+	{
+		return index_tracker.at(dim).at(comp);
+	}
+
+
+	/**
+	 \brief write a copy of witness_data, with some of the points replaced.
+
+	 Everything but the coordinates of the replaced points is copied as it is, so the metadata, the randomization, the slices and the patches stay.  Both of the approximations Bertini keeps of a point are replaced by the new one.
+
+	 \param filename The file to write.  Must not be the one read by populate().
+	 \param replacements The new points, by the index of the point they replace, as taken by solution().  They must be on the patch of their dimension.
+	 */
+	void write_with_points(boost::filesystem::path const& filename, std::map<int, vec_mp*> const& replacements) const;
+
+
 
 //	friend std::ostream & operator<<(std::ostream &os, witness_data & c)
 //	{
@@ -490,12 +554,12 @@ private:
 	}
 
 
-	int add_solution(vec_mp pt, const WitnessPointMetadata & meta)
+	int add_solution(long offset, const WitnessPointMetadata & meta)
 	{
-
-		int ind = add_point(pt);
+		point_offsets_.push_back(offset);
+		loaded_index_.push_back(-1);
 		point_metadata.push_back(meta);
-		return ind;
+		return point_metadata.size()-1;
 	}
 
 
@@ -0,0 +1,172 @@
+#ifndef BR_PARAMETER_SWEEP_H
+#define BR_PARAMETER_SWEEP_H
+
+/**
+ \file parameter_sweep.hpp
+
+ contains the sweep of a decomposition through a family of systems, given by values of the constants of the input file.
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "nag/nid.hpp"
+#include "io/fileops.hpp"
+
+
+
+
+/**
+ \brief the values of some constants of an input file at each step of a sweep, and the continuation of witness data from one step to the next.
+
+ The sweep file names the constants on its first line, and on each later line gives their values at one step, separated by whitespace:
+
+	a1 a3
+	1.1 1
+	1.2 0.9
+	1.3 0.5+0.1*I
+
+ The values are Bertini expressions without spaces.  The input file, with the constants as it assigns them, is step 0; the lines of the file are steps 1, 2, ...
+
+ Rather than computing the witness data at each step from scratch, with a cascade or regeneration from a generic start system, the witness points of the swept component at the previous step are carried to the new values by a parameter homotopy, a Bertini user homotopy.  It tracks the points of the component along with their own slices, with the constants moving from the old values to the new along a complex detour, so the path misses the discriminant.  The slices, patches and randomizations of the witness data are generic, so they serve at the new values as well, and only the coordinates of the points are replaced.
+
+ Only the witness points are continued.  The critical points, slices and midpoints of the decomposition at each step are solved for afresh, as continuing them would need every solver to take a parameterized system.
+ */
+class ParameterSweep
+{
+
+public:
+
+	/**
+	 \brief read a sweep file.  throws if it is malformed.
+	 \param filename The sweep file.
+	 */
+	void Read(boost::filesystem::path const& filename);
+
+
+	/**
+	 \brief the number of steps after step 0.
+	 \return the number of lines of values.
+	 */
+	unsigned NumSteps() const
+	{
+		return values_.size();
+	}
+
+
+	/**
+	 \brief the names of the swept constants.
+	 \return the names.
+	 */
+	std::vector<std::string> const& Names() const
+	{
+		return names_;
+	}
+
+
+	/**
+	 \brief write the input file of a step: the input file, with the swept constants assigned their values at the step.
+
+	 \param input The input file of step 0.
+	 \param output The input file to write.
+	 \param step The step, from 1 to NumSteps().
+	 */
+	void WriteInput(boost::filesystem::path const& input, boost::filesystem::path const& output, unsigned step) const;
+
+
+	/**
+	 \brief carry the witness points of one component from one input file to another, which differs only in the values of the swept constants.
+
+	 Only the points of the component are tracked.  The new witness data is a copy of the old, with the component's points replaced, so the points of the other components are left at the old values.  The decomposition of the component asks of the witness data only whether a point and its conjugate lie on the same component, which a point of the swept component still answers, as the stale components' points do not track to points of the new system.
+
+	 The continuation fails, and nothing is written, if the component's endpoints are not as many distinct nonsingular points as it had, which is when its degree or multiplicity changes, or it breaks up, or a path fails.  Then the witness data at the new values must be computed from scratch, and the component found again among it by FindComponent, from whichever points did come through.
+
+	 Runs Bertini, with the workers' help.  Call on the head only.
+
+	 \return whether every point was carried.
+	 \param witness_data The witness data of from_input.
+	 \param dim The dimension of the component.
+	 \param comp The number of the component.
+	 \param from_input The input file the witness data is of.
+	 \param to_input The input file to carry it to.
+	 \param output The file to write the new witness data to.
+	 \param same_point_tolerance The distance within which two endpoints are the same point.
+	 \param program_options The current state of bertini_real.
+	 \param[out] carried The nonsingular endpoints, on the patch of the component, in no particular order.  Filled even if the continuation fails.  Must be empty.
+	 */
+	bool Continue(NumericalIrreducibleDecomposition & witness_data, int dim, int comp,
+				  boost::filesystem::path const& from_input,
+				  boost::filesystem::path const& to_input,
+				  boost::filesystem::path const& output,
+				  double same_point_tolerance,
+				  BertiniRealConfig & program_options,
+				  PointHolder & carried) const;
+
+
+	/**
+	 \brief find the component containing some points, among witness data computed from scratch, which Bertini numbers afresh.
+
+	 Runs Bertini's membership test on the head alone, on the points in turn until one lies on a component.  Overwrites the parser's files in the current folder, so parse the input again afterward.
+
+	 \return whether a component was found.
+	 \param witness_data The witness data, as in witness_data in the current folder.
+	 \param carried Points on the component sought, such as those Continue carried.
+	 \param to_input The input file the witness data is of.
+	 \param program_options The current state of bertini_real.
+	 \param[out] dim The dimension of the component.
+	 \param[out] comp The number of the component.
+	 */
+	bool FindComponent(NumericalIrreducibleDecomposition const& witness_data, PointHolder const& carried,
+					   boost::filesystem::path const& to_input, BertiniRealConfig & program_options,
+					   int & dim, int & comp) const;
+
+private:
+
+	/**
+	 \brief an input file, split into statements by partition_parse.
+	 */
+	struct InputStatements
+	{
+		std::vector<std::string> config; ///< the statements of the CONFIG section.
+		std::vector<std::string> input; ///< the statements of the INPUT section, in order.
+		std::vector<std::string> variables; ///< the variables of the variable_group, or empty if the variables are not in a single affine group.
+		std::vector<std::string> functions; ///< the names of the functions.
+		std::map<std::string, std::string> swept; ///< the right hand side assigned to each swept constant.
+	};
+
+
+	/**
+	 \brief split an input file into its statements, and find the variables, the functions, and the swept constants.  throws if a swept constant is not assigned.
+	 */
+	InputStatements Split(boost::filesystem::path const& input) const;
+
+
+	/**
+	 \brief whether a statement assigns a swept constant.
+	 \return the name, or empty.
+	 */
+	std::string AssignedName(std::string const& statement) const;
+
+
+	/**
+	 \brief carry the points of one witness set from the old values of the swept constants to the new, by one run of Bertini.
+
+	 \return whether every point came through nonsingular, and distinct.
+	 \param W The witness set, of a component of the old system.
+	 \param from The old input file.
+	 \param to The new input file.
+	 \param same_point_tolerance The distance within which two endpoints are the same point.
+	 \param program_options The current state of bertini_real.
+	 \param[out] carried The nonsingular endpoints, on the patch of W.  Bertini does not keep the order of the paths.
+	 */
+	bool Track(WitnessSet const& W, InputStatements const& from, InputStatements const& to,
+			   double same_point_tolerance, BertiniRealConfig & program_options, PointHolder & carried) const;
+
+
+	std::vector<std::string> names_; ///< the names of the swept constants.
+	std::vector<std::vector<std::string> > values_; ///< the values of the swept constants, one vector per step after step 0.
+};
+
+
+#endif
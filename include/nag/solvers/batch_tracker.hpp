@@ -0,0 +1,196 @@
+#ifndef SOLVER_BATCH_TRACKER_H
+#define SOLVER_BATCH_TRACKER_H
+
+/**
+ \file batch_tracker.hpp
+
+ contains the lockstep, double precision tracker used to advance blocks of paths to near the endgame boundary before the per-path tracker takes over.
+ */
+
+#include <vector>
+
+#include "bertini1/bertini_headers.hpp"
+
+
+
+
+/**
+ \brief a set of square complex linear systems of the same size, stored so that the same entry of every system is contiguous.
+
+ Entry (i,j) of system b lives at index (i*n+j)*capacity + b of the real and imaginary arrays, and entry i of the right hand side of system b at i*capacity + b.  The innermost loops of the elimination run over b, so are contiguous and independent, and the compiler can vectorize them.
+ */
+class BatchedLinearSystems
+{
+
+public:
+
+	/**
+	 \brief size the storage for a number of systems of a given size.
+
+	 \param n The number of rows and columns of each system.
+	 \param capacity The greatest number of systems which will be solved at once.
+	 */
+	void resize(int n, int capacity);
+
+
+	/**
+	 \brief put a system into a slot.
+
+	 \param b The slot.
+	 \param A The square matrix.
+	 \param rhs The right hand side.
+	 \param negate Whether to put -rhs rather than rhs.
+	 */
+	void set(int b, mat_d A, vec_d rhs, bool negate);
+
+
+	/**
+	 \brief solve the first num_systems systems in place, by Gaussian elimination with partial pivoting.
+
+	 On return, the right hand sides hold the solutions.  For each system, the ratio of largest to smallest pivot, a cheap under-estimate of the condition number, is stored in condition_estimate; a system with a zero pivot gets infinity.
+
+	 \param num_systems How many of the slots, from 0, to solve.
+	 */
+	void solve(int num_systems);
+
+
+	/**
+	 \brief get the solution of a system, after solve().
+
+	 \param x The vector into which to copy the solution.
+	 \param b The slot.
+	 */
+	void solution(vec_d x, int b) const;
+
+
+	/**
+	 \brief the ratio of largest to smallest pivot of a system, from the latest solve().
+	 \return the estimate.
+	 \param b The slot.
+	 */
+	double condition_estimate(int b) const
+	{
+		return condition_estimate_[b];
+	}
+
+private:
+
+	int n_ = 0; ///< the size of each system.
+	int capacity_ = 0; ///< the number of slots.
+
+	std::vector<double> A_re_, A_im_; ///< the matrices, entry-major.
+	std::vector<double> rhs_re_, rhs_im_; ///< the right hand sides, entry-major.
+	std::vector<double> multiplier_re_, multiplier_im_; ///< the elimination multipliers for one row, one per system.
+	std::vector<double> condition_estimate_; ///< the pivot ratio of each system.
+};
+
+
+
+
+
+
+/**
+ \brief advances a block of paths together, in double precision, from their start time to near the endgame boundary.
+
+ Every path in the block takes the same kind of step at the same time -- the four stages of a Runge-Kutta predictor, then Newton corrections -- so that the linear solves for the whole block are done at once, by a BatchedLinearSystems.  Each path keeps its own time and step size, adapted as Bertini's tracker does, from the settings in the tracker config.
+
+ A path leaves the block, unadvanced, when its step size falls below the minimum, when it takes too many steps, when it gets too large, or when the pivots of its jacobian say double precision no longer carries enough digits for the Newton tolerance.  Such paths, and any time the block cannot be used at all, are left to the usual per-path AMP tracker, from their original start points.
+
+ The block stops short of the endgame boundary, leaving the last tenth of the way to the per-path tracker, so that it settles its own step size before its endgame starts.
+ */
+class BatchTrackerDouble
+{
+
+public:
+
+	/**
+	 \brief the type of the double precision evaluator functions of the solvers.
+	 */
+	typedef int (*EvalFunction)(point_d, point_d, vec_d, mat_d, mat_d, point_d, comp_d, void const *);
+
+
+	/**
+	 \param batch_size The greatest number of paths to advance together.
+	 */
+	BatchTrackerDouble(int batch_size);
+
+	~BatchTrackerDouble();
+
+	BatchTrackerDouble(const BatchTrackerDouble&) = delete;
+	BatchTrackerDouble & operator=(const BatchTrackerDouble&) = delete;
+
+
+	/**
+	 \brief advance a block of start points toward the endgame boundary.
+
+	 \return the number of paths which were advanced.
+	 \param advanced_pts The output points, one per start point.  Those with advanced[ii] set hold the advanced point and its time.  Must be initialized.
+	 \param advanced Set to whether each path was advanced.  Resized to num_points.
+	 \param start_pts The start points.  Not changed.
+	 \param num_points The number of start points.
+	 \param T The tracker config, whose step size and tolerance settings are used.
+	 \param ED The evaluator data, passed to eval.
+	 \param eval The double precision evaluator.
+	 */
+	int advance(point_data_d *advanced_pts, std::vector<bool> & advanced,
+				point_data_d *start_pts, int num_points,
+				tracker_config_t const& T,
+				void const *ED, EvalFunction eval);
+
+private:
+
+	/**
+	 \brief the state of one path in the block.
+	 */
+	struct PathState
+	{
+		int index; ///< which start point this is.
+		bool active; ///< whether the path is still in the block.
+		double time; ///< the current time.
+		double stop_time; ///< the time at which to hand the path back.
+		double step_size; ///< the current step size.
+		int num_consecutive_successes; ///< how many steps have succeeded since the step size last changed.
+		int num_steps; ///< how many steps have been attempted.
+		point_d point; ///< the current point.
+		point_d trial_point; ///< the point being predicted and corrected.
+		vec_d stage[4]; ///< the Runge-Kutta stage derivatives.
+		bool converged; ///< whether the corrector has converged on the current step.
+		bool step_failed; ///< whether the current step has failed.
+	};
+
+
+	/**
+	 \brief evaluate the homotopy at the trial point of each listed path, and put into the batch the system for either dx/dt or a Newton correction.
+
+	 \param which The indices into paths_ of the paths to evaluate.  Path which[b] goes in slot b.
+	 \param times The time at which to evaluate each listed path.
+	 \param for_newton Whether to load J dx = -H, or J dx = -dH/dt.
+	 \param ED The evaluator data.
+	 \param eval The evaluator.
+	 */
+	void load_systems(std::vector<int> const& which, std::vector<double> const& times, bool for_newton, void const *ED, EvalFunction eval);
+
+
+	/**
+	 \brief whether a pivot ratio leaves too few digits in double precision to meet the Newton tolerance.
+	 */
+	bool needs_higher_precision(double condition_estimate, tracker_config_t const& T) const;
+
+
+	int batch_size_; ///< the greatest number of paths in the block.
+
+	std::vector<PathState> paths_; ///< the paths of the current block.
+
+	BatchedLinearSystems systems_; ///< the linear systems of the current stage.
+
+	point_d funcVals_; ///< evaluator output.
+	point_d parVals_; ///< evaluator output.
+	vec_d parDer_; ///< evaluator output.
+	mat_d Jv_; ///< evaluator output.
+	mat_d Jp_; ///< evaluator output.
+	vec_d dH_dt_; ///< the derivative of the homotopy with respect to time.
+};
+
+
+
+#endif
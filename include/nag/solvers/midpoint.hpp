@@ -24,8 +24,6 @@ class midpoint_eval_data_d;
 
 
 
-extern bool print_this_path;
-extern FILE* g_path_file;
 
 
 
@@ -268,6 +266,16 @@ class midpoint_eval_data_mp : public SolverMultiplePrecision
 {
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "midpoint"
+	 */
+	std::string name() const override
+	{
+		return "midpoint";
+	}
+
+
 	int num_mid_vars; ///< the number of variables for the middle of the face.
 	int num_bottom_vars; ///< the number of variables for the bottom edge.
 	int num_top_vars; ///< the number of variables for the top edge.
@@ -424,6 +432,13 @@ public:
               const WitnessSet & W,
               SolverConfiguration & solve_options);
 
+	/**
+	 \brief ensure the persistent temporaries used by midpoint_eval_mp exist, and are large enough for the three systems.
+
+	 Called by setup(), so that evaluation does no allocating, and again at the start of each evaluation, when it is only a few comparisons.
+	 */
+	void reserve_temporaries();
+
 
 
 	/**
@@ -597,6 +612,16 @@ class midpoint_eval_data_d : public SolverDoublePrecision
 {
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "midpoint"
+	 */
+	std::string name() const override
+	{
+		return "midpoint";
+	}
+
+
 	midpoint_eval_data_mp *BED_mp; ///< pointer to an MP type midpoint eval data. used only for AMP
 
 	int num_mid_vars; ///< the number of variables in the mid system
@@ -743,6 +768,13 @@ public:
               const WitnessSet & W,
               SolverConfiguration & solve_options);
 
+	/**
+	 \brief ensure the persistent temporaries used by midpoint_eval_d exist, and are large enough for the three systems.
+
+	 Called by setup(), so that evaluation does no allocating, and again at the start of each evaluation, when it is only a few comparisons.
+	 */
+	void reserve_temporaries();
+
 	/**
 	 \brief add a projection to the solver.
 	 \param proj the new projection to add.
@@ -866,10 +898,38 @@ int midpoint_solver_master_entry_point(const WitnessSet & W, // carries with it
 
 
 
+/**
+ \brief time repeated evaluation of the midpoint homotopy, at the start point of a track, and print the rates to the screen.
+
+ Evaluates in double precision, and in multiple precision at 64, 128 and 256 bits, depending on the MPType of the solver.  The evaluators are set up once, as for a track, and then evaluated num_evaluations times at the same point, at t=0.5, so the rate measured is that of evaluation alone.  Reached from the sampler's -benchmark, in builds with evaluator_benchmark defined.
+
+ \param W the input witness set with the start point and patches
+ \param md_config the configuration for the track
+ \param solve_options the current state of the solver
+ \param num_evaluations the number of evaluations to time, for each precision
+ */
+void midpoint_eval_benchmark(const WitnessSet & W,
+							 MidpointConfiguration & md_config,
+							 SolverConfiguration & solve_options,
+							 int num_evaluations);
+
+
+
 /**
  \brief Evaluator function for the midpoint solver.
 
- \todo: explain with diagram how this works
+ The variables are the mid, bottom and top points, in that order, and Jv has the block structure
+
+ [
+ R_mid*J_mid       0                 0
+ 0                 R_bottom*J_bottom 0
+ 0                 0                 R_top*J_top
+ pi_0 rows, one per point, each nonzero only in its own point's natural variables
+ pi_1 midpoint row, nonzero in the natural variables of all three points
+ patch rows
+ ]
+
+ The diagonal blocks and patch rows are written in full, and only the entries outside them are zeroed.  That is the only use made of the structure: Bertini's tracker takes Jv as a dense matrix and factors it itself, so the linear solves are not done by blocks.
 
  this function makes use of the TemporariesMultiplePrecision class for persistence of temporaries.
 
@@ -889,7 +949,7 @@ int midpoint_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, m
 /**
  \brief Evaluator function for the midpoint solver.
 
- \todo: explain with diagram how this works
+ \see midpoint_eval_d for the layout of Jv.
 
  this function makes use of the TemporariesMultiplePrecision class for persistence of temporaries.
 
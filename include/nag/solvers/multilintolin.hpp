@@ -15,8 +15,6 @@
 
 
 
-extern bool print_this_path;
-extern FILE* g_path_file;
 
 
 /**
@@ -122,7 +120,7 @@ public:
 
 		//TODO: should i assume here that the input file is already parsed??
 		this->MPType = solve_options.T.MPType;
-		solve_options.T.numVars = setupProg(SLP, solve_options.T.Precision, solve_options.T.MPType);
+		solve_options.T.numVars = setup_prog(SLP, solve_options.T.Precision, solve_options.T.MPType);
 		//make randomizer matrix here
 		SLP_memory.capture_globals();
 		SLP_memory.set_globals_null();
@@ -164,7 +162,7 @@ public:
 
 
 		SLP_memory.set_globals_to_this();
-		clearProg(SLP, this->MPType, 1); // 1 means call freeprogeval()
+		clear_prog(SLP, this->MPType, 1); // 1 means call freeprogeval()
 		delete SLP;
 	}
 
@@ -218,6 +216,16 @@ class multilintolin_eval_data_mp : public SolverMultiplePrecision
 {
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "multilintolin"
+	 */
+	std::string name() const override
+	{
+		return "multilintolin";
+	}
+
+
 
 	int num_linears; ///< how many linears it currently has.
 
@@ -307,6 +315,13 @@ public:
 			  vec_mp * target_linears,
 			  SolverConfiguration & solve_options);
 
+	/**
+	 \brief ensure the persistent temporaries used by multilin_to_lin_eval_mp exist, and are large enough for the system.
+
+	 Called by setup(), so that evaluation does no allocating, and again at the start of each evaluation, when it is only a few comparisons.
+	 */
+	void reserve_temporaries();
+
 
 
 protected:
@@ -409,6 +424,16 @@ class multilintolin_eval_data_d : public SolverDoublePrecision
 {
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "multilintolin"
+	 */
+	std::string name() const override
+	{
+		return "multilintolin";
+	}
+
+
 	multilintolin_eval_data_mp * BED_mp; ///< a pointer to the MP eval data, for AMP mode
 	int num_linears; ///< the number of linears.
 
@@ -515,6 +540,13 @@ public:
 			  vec_mp * target_linears,
 			  SolverConfiguration & solve_options);
 
+	/**
+	 \brief ensure the persistent temporaries used by multilin_to_lin_eval_d exist, and are large enough for the system.
+
+	 Called by setup(), so that evaluation does no allocating, and again at the start of each evaluation, when it is only a few comparisons.
+	 */
+	void reserve_temporaries();
+
 
 
 protected:
@@ -19,8 +19,6 @@ namespace nullspace_handedness{
 	enum {LEFT=0, RIGHT};
 }
 
-extern bool print_this_path;
-extern FILE* g_path_file;
 
 
 /**
@@ -132,6 +130,16 @@ class nullspacejac_eval_data_mp : public SolverMultiplePrecision
 
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "nullspace"
+	 */
+	std::string name() const override
+	{
+		return "nullspace";
+	}
+
+
 	int side(){ return side_;};
 
 
@@ -570,6 +578,16 @@ class nullspacejac_eval_data_d : public SolverDoublePrecision
 
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "nullspace"
+	 */
+	std::string name() const override
+	{
+		return "nullspace";
+	}
+
+
 	int side()
 	{
 		return side_;
@@ -983,6 +1001,36 @@ int nullspacejac_left_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer
 
 
 
+/**
+ \brief compute, for each of a list of values, the product of all the others, times a scale.
+
+ products[ii] = scale * prod_{jj!=ii} values[jj].  This is the product rule for a product of linears.  It uses prefix and suffix products, so takes O(num_values) multiplications rather than O(num_values^2), and no division, so zero values are fine.
+
+ \param products The computed products.
+ \param values The values, contiguous.
+ \param num_values How many values there are.
+ \param scale The number by which to multiply every product.
+ \param running Temporary.
+ */
+void leave_one_out_products_d(vec_d products, _comp_d *values, int num_values, comp_d scale, comp_d running);
+
+
+/**
+ \brief compute, for each of a list of values, the product of all the others, times a scale.
+
+ \see leave_one_out_products_d
+
+ \param products The computed products.
+ \param values The values, contiguous.
+ \param num_values How many values there are.
+ \param scale The number by which to multiply every product.
+ \param running Temporary, at the precision of the values.
+ */
+void leave_one_out_products_mp(vec_mp products, _comp_mp *values, int num_values, comp_mp scale, comp_mp running);
+
+
+
+
 /**
  \brief Evaluator function for the right nullspace solver.
 
@@ -0,0 +1,121 @@
+#ifndef SOLVER_PATH_TELEMETRY_H
+#define SOLVER_PATH_TELEMETRY_H
+
+/**
+ \file path_telemetry.hpp
+
+ contains the per-path records of a solve, and their export.
+ */
+
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+
+
+
+
+/**
+ \brief what happened on one path, as the tracker loops see it.
+
+ Plain data, so packets of records go between processes as bytes.
+ */
+struct PathRecord
+{
+	int path_number; ///< the index of the start point.
+	int worker; ///< the id of the process which tracked the path.
+	int final_precision; ///< the precision at the end of the path, in bits.  52 for double.
+	int num_passes; ///< how many times the path was tracked: one, plus robust retries, plus a retrack from the start point if the batch-advanced point failed.
+	int retVal; ///< the final return value of the tracker.
+	int batched; ///< whether the batch tracker advanced the path.
+	long long num_evaluations; ///< how many times the evaluators were called for the path.
+	double wall_time; ///< the wall time spent on the path, in seconds, including sharpening.
+};
+
+
+
+
+/**
+ \brief the records of all the paths of one solve.
+
+ Every solve's records are appended to one CSV file, `path_telemetry.csv` in the working folder, with the solve's number and solver name on each line, so that solves can be compared after the run, {\em e.g.} to tune tracker configs.  Solve numbers continue from the largest already in the file, so they stay unique across runs appending to it.  The columns are
+
+ solve, solver, path, worker, seconds, evaluations, passes, precision, batched, retval
+ */
+class PathTelemetry
+{
+
+public:
+
+	/**
+	 \brief the name of the file into which records are written.
+	 */
+	static const char * DefaultName()
+	{
+		return "path_telemetry.csv";
+	}
+
+
+	/**
+	 \param solver_name The kind of solver, {\em e.g.} "midpoint".
+	 */
+	PathTelemetry(std::string const& solver_name) : solver_name_(solver_name)
+	{}
+
+
+	/**
+	 \brief add a record.
+	 \param record The record to add.
+	 */
+	void Add(PathRecord const& record)
+	{
+		records_.push_back(record);
+	}
+
+
+	/**
+	 \brief add a packet of records.
+	 \param records The records.
+	 \param num_records How many.
+	 */
+	void Add(PathRecord const* records, int num_records)
+	{
+		records_.insert(records_.end(), records, records+num_records);
+	}
+
+
+	/**
+	 \brief get the records.
+	 \return the records, in the order added.
+	 */
+	std::vector<PathRecord> const& Records() const
+	{
+		return records_;
+	}
+
+
+	/**
+	 \brief append the records to the telemetry file, starting it with a header line if it does not exist.
+
+	 The first write of a process numbers its solve one past the largest number in the file.
+
+	 \param filename The file to append to.
+	 */
+	void Write(boost::filesystem::path const& filename) const;
+
+
+	/**
+	 \brief print totals, the slowest paths, and counts by precision and return value.
+
+	 \param os The stream to print to.
+	 */
+	void PrintSummary(std::ostream & os) const;
+
+private:
+
+	std::string solver_name_; ///< the kind of solver.
+	std::vector<PathRecord> records_; ///< the records, one per path.
+};
+
+
+#endif
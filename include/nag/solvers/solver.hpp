@@ -9,6 +9,8 @@
 
 #include "io/fileops.hpp"
 #include "programConfiguration.hpp"
+#include "nag/solvers/path_telemetry.hpp"
+#include "nag/solvers/system_cache.hpp"
 #include "nag/solvers/postProcessing.hpp"
 #include "nag/system_randomizer.hpp"
 #include "decompositions/decomposition.hpp"
@@ -29,8 +31,6 @@ extern int *size_mp;  // size of mem_mp
 extern int *mem_needs_init_d; // determine if mem_d has been initialized
 extern int *mem_needs_init_mp; // determine if mem_mp has been initialized
 
-extern bool print_this_path;
-extern FILE* g_path_file;
 
 
 
@@ -260,7 +260,7 @@ public:
 		randomizer_->bcast_send(mpi_config);
 
 		memory_.set_globals_to_this();
-		bcast_prog_t(SLP_, this->MPType, 0, 0); // last two arguments are: myid, headnode
+		bcast_send_prog(SLP_, this->MPType, mpi_config);
 		memory_.set_globals_null();
 	}
 
@@ -276,7 +276,7 @@ public:
 
 		if (have_SLP_) {
 			memory_.set_globals_to_this();
-			clearProg(SLP_, this->MPType, 1); // 1 means call freeprogeval()
+			clear_prog(SLP_, this->MPType, 1); // 1 means call freeprogeval()
 		}
 		else
 		{
@@ -301,7 +301,7 @@ public:
 
 
 
-		bcast_prog_t(SLP_, MPType, 1, 0); // last two arguments are: myid, headnode
+		bcast_receive_prog(SLP_, MPType, mpi_config);
 		initEvalProg(MPType);
 		memory_.capture_globals();
 		memory_.set_globals_null();
@@ -368,7 +368,7 @@ public:
 
 		if (this->have_SLP_) {
 			this->memory_.set_globals_to_this();
-			clearProg(this->SLP_, this->MPType, 1); // 1 means call freeprogeval()
+			clear_prog(this->SLP_, this->MPType, 1); // 1 means call freeprogeval()
 
 			if (!other.have_SLP_) {
 				delete this->SLP_;
@@ -386,7 +386,7 @@ public:
 
 
 
-			cp_prog_t(this->SLP_, other.SLP_);
+			copy_prog(this->SLP_, other.SLP_);
 			this->memory_.set_globals_null();
 			initEvalProg(this->MPType);
 			this->memory_.capture_globals();
@@ -408,7 +408,7 @@ public:
 
 		if (have_SLP_) {
 			memory_.set_globals_to_this();
-			clearProg(SLP_, this->MPType, 1); // 1 means call freeprogeval()
+			clear_prog(SLP_, this->MPType, 1); // 1 means call freeprogeval()
 			delete SLP_;
 			have_SLP_ = false;
 		}
@@ -429,7 +429,7 @@ public:
 	{
 		if (have_SLP_) {
 			memory_.set_globals_to_this();
-			clearProg(SLP_, this->MPType, 1); // 1 means call freeprogeval()
+			clear_prog(SLP_, this->MPType, 1); // 1 means call freeprogeval()
 		}
 		else{
 			SLP_ = new prog_t;
@@ -448,7 +448,7 @@ public:
 
 
 		//	// setup a straight-line program, using the file(s) created by the parser
-		int numVars = setupProg(SLP_, T->Precision, T->MPType);
+		int numVars = setup_prog(SLP_, T->Precision, T->MPType);
 		if (num_variables() != numVars) {
 			std::cout << "numvars is incorrect...  setupprog gives " << numVars << ", but should be " << num_variables() << "." << std::endl;
 			mypause();
@@ -484,7 +484,7 @@ public:
 	{
 		if (have_SLP_) {
 			memory_.set_globals_to_this();
-			clearProg(SLP_, this->MPType, 1); // 1 means call freeprogeval()
+			clear_prog(SLP_, this->MPType, 1); // 1 means call freeprogeval()
 		}
 		else{
 			SLP_ = new prog_t;
@@ -502,7 +502,7 @@ public:
 
 
 		//	// setup a straight-line program, using the file(s) created by the parser
-		num_variables_ = setupProg(SLP_, T->Precision, T->MPType);
+		num_variables_ = setup_prog(SLP_, T->Precision, T->MPType);
 
 		preproc_data PPD;
 		parse_preproc_data("preproc_data", &PPD);
@@ -532,7 +532,7 @@ public:
 	{
 		if (have_SLP_) {
 			memory_.set_globals_to_this();
-			clearProg(SLP_, this->MPType, 1); // 1 means call freeprogeval()
+			clear_prog(SLP_, this->MPType, 1); // 1 means call freeprogeval()
 		}
 		else{
 			SLP_ = new prog_t;
@@ -551,7 +551,7 @@ public:
 
 
 		//	// setup a straight-line program, using the file(s) created by the parser
-		num_variables_ = setupProg(SLP_, T->Precision, T->MPType);
+		num_variables_ = setup_prog(SLP_, T->Precision, T->MPType);
 		have_SLP_ = true;
 
 		preproc_data PPD;
@@ -584,7 +584,7 @@ public:
 	{
 		if (have_SLP_) {
 			memory_.set_globals_to_this();
-			clearProg(SLP_, this->MPType, 1); // 1 means call freeprogeval()
+			clear_prog(SLP_, this->MPType, 1); // 1 means call freeprogeval()
 		}
 		else{
 			SLP_ = new prog_t;
@@ -602,7 +602,7 @@ public:
 
 
 		//	// setup a straight-line program, using the file(s) created by the parser
-		num_variables_ = setupProg(SLP_, T->Precision, T->MPType);
+		num_variables_ = setup_prog(SLP_, T->Precision, T->MPType);
 		have_SLP_ = true;
 
 
@@ -775,7 +775,7 @@ public:
 		else{
 			scalars = (comp_mp *) br_realloc(scalars,(num_scalars+1)*sizeof(comp_mp));
 		}
-		init_mp(scalars[new_index]);
+		init_mp2(scalars[new_index],curr_prec);
 
 		num_scalars++;
 		return new_index;
@@ -795,7 +795,7 @@ public:
 		else {
 			vectors = (vec_mp *) br_realloc(vectors,(num_vectors+1)*sizeof(vec_mp));
 		}
-		init_vec_mp(vectors[new_index],1);
+		init_vec_mp2(vectors[new_index],1,curr_prec);
 		vectors[new_index]->size = 1;
 
 		num_vectors++;
@@ -818,7 +818,7 @@ public:
 		else {
 			matrices = (mat_mp *) br_realloc(matrices,(num_matrices+1)*sizeof(mat_mp));
 		}
-		init_mat_mp(matrices[new_index],1,1);
+		init_mat_mp2(matrices[new_index],1,1,curr_prec);
 		matrices[new_index]->rows = matrices[new_index]->cols = 1;
 
 		num_matrices++;
@@ -1155,6 +1155,8 @@ public:
 	int path_counter_modulus;
 
 	bool robust; ///< whether to use robust mode
+	int batch_size; ///< how many paths to advance together in double precision before the endgame.  0 or 1 tracks each path alone.
+	bool path_telemetry; ///< whether to write per-path records of each solve to path_telemetry.csv, and print a summary.
 	tracker_config_t T; ///< the ubiquitous Bertini tracker configuration
 
 
@@ -1291,6 +1293,8 @@ public:
 
 		this->total_num_paths_tracked = other.total_num_paths_tracked;
 		this->robust = other.robust;
+		this->batch_size = other.batch_size;
+		this->path_telemetry = other.path_telemetry;
 
 		cp_preproc_data(&(this->PPD), other.PPD);
 
@@ -1698,6 +1702,16 @@ public:
 	int num_steps; ///< the number of evaluations made using this evaluator
 
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return the name.
+	 */
+	virtual std::string name() const
+	{
+		return "solver";
+	}
+
+
 
 
 
@@ -2096,13 +2110,15 @@ void master_solver(SolverOutput & solve_out, const WitnessSet & W,
  \param ED_d already populated abstract evaluator data in double.
  \param ED_mp already populated abstract evaluator data in mp.
  \param solve_options The current state of the Solver config.
+ \param telemetry collects a record of each path.
  */
 void serial_tracker_loop(trackingStats *trackCount,
 						  FILE * OUT, FILE * midOUT,
 						  const WitnessSet & W,  // was the startpts file pointer.
 						  post_process_t *endPoints,
 						  SolverDoublePrecision * ED_d, SolverMultiplePrecision * ED_mp,
-						  SolverConfiguration & solve_options);
+						  SolverConfiguration & solve_options,
+						  PathTelemetry & telemetry);
 
 /**
  \brief the main loop for solving in parallel.
@@ -2115,13 +2131,15 @@ void serial_tracker_loop(trackingStats *trackCount,
  \param ED_d already populated abstract evaluator data in double.
  \param ED_mp already populated abstract evaluator data in mp.
  \param solve_options The current state of the Solver config.
+ \param telemetry collects a record of each path, as sent by the workers.
  */
 void master_tracker_loop(trackingStats *trackCount,
 						 FILE * OUT, FILE * MIDOUT,
 						 const WitnessSet & W,  // was the startpts file pointer.
 						 post_process_t *endPoints,
 						 SolverDoublePrecision * ED_d, SolverMultiplePrecision * ED_mp,
-						 SolverConfiguration & solve_options);
+						 SolverConfiguration & solve_options,
+						 PathTelemetry & telemetry);
 
 
 /**
@@ -2171,13 +2189,15 @@ void send_start_points(int next_worker, int num_packets,
  \param ED_d pointer to the double evaluator_data
  \param ED_mp pointer to the mp evaluator_data
  \param solve_options The current state of the Solver config.
+ \param telemetry into which to put the worker's records of the paths.
  */
 int receive_endpoints(trackingStats *trackCount,
 					  endgame_data_t **EG_receives, int & max_incoming,
 					  int & solution_counter,
 					  post_process_t *endPoints,
 					  SolverDoublePrecision * ED_d, SolverMultiplePrecision * ED_mp,
-					  SolverConfiguration & solve_options);
+					  SolverConfiguration & solve_options,
+					  PathTelemetry & telemetry);
 
 
 
@@ -2238,9 +2258,10 @@ void generic_track_path(int pathNum, endgame_data_t *EG_out,
  \param eval_func_mp pointer to the mp evaluator function.
  \param change_prec pointer to the precision changing function
  \param find_dehom pointer to the dehomogenizing function
+ \return the number of passes made on the path, one more than the number of retries.
  */
 
-void robust_track_path(int pathNum, endgame_data_t *EG_out,
+int robust_track_path(int pathNum, endgame_data_t *EG_out,
 					   point_data_d *Pin, point_data_mp *Pin_mp,
 					   FILE *OUT, FILE *MIDOUT,
 					   SolverConfiguration & solve_options,
@@ -2251,6 +2272,50 @@ void robust_track_path(int pathNum, endgame_data_t *EG_out,
 					   int (*find_dehom)(point_d, point_mp, int *, point_d, point_mp, int, void const *, void const *));
 
 
+
+/**
+ \brief track a path with robust_track_path or generic_track_path, according to solve_options, starting from the point the batch tracker advanced it to, if there is one.
+
+ If the path fails from the advanced point, it is retracked from its start point, so the batch tracker can cost time, but not solutions.  Only the accepted attempt is written to OUT and MIDOUT; the first goes to scratch files until it is known to be.
+
+ \param pathNum the ID of the path
+ \param EG_out the output data structure
+ \param Pin the input point data, double format.  may be NULL
+ \param Pin_mp the input point data, mp format, may be NULL depending on MPtype
+ \param advanced_pt the point the batch tracker advanced this path to, or NULL if it was not advanced.
+ \param OUT open file into which to print data
+ \param MIDOUT open file into which to print midpath data.
+ \param solve_options the current state of the Solver
+ \param ED_d double format Solver derived type
+ \param ED_mp mp format Solver derived type
+ \param eval_func_d pointer to the double evaluator function.
+ \param eval_func_mp pointer to the mp evaluator function.
+ \param change_prec pointer to the precision changing function
+ \param find_dehom pointer to the dehomogenizing function
+ \return the number of passes made on the path, over both starts.
+ */
+int track_path_from_best_start(int pathNum, endgame_data_t *EG_out,
+								point_data_d *Pin, point_data_mp *Pin_mp, point_data_d *advanced_pt,
+								FILE *OUT, FILE *MIDOUT,
+								SolverConfiguration & solve_options,
+								SolverDoublePrecision *ED_d, SolverMultiplePrecision *ED_mp,
+								int (*eval_func_d)(point_d, point_d, vec_d, mat_d, mat_d, point_d, comp_d, void const *),
+								int (*eval_func_mp)(point_mp, point_mp, vec_mp, mat_mp, mat_mp, point_mp, comp_mp, void const *),
+								int (*change_prec)(void const *, int),
+								int (*find_dehom)(point_d, point_mp, int *, point_d, point_mp, int, void const *, void const *));
+
+
+/**
+ \brief the total number of evaluations made so far by the evaluators in use for an MPType, from their num_steps.
+
+ \return the number of evaluations.
+ \param ED_d double format Solver derived type.  used unless MPType is 1.
+ \param ED_mp mp format Solver derived type.  used unless MPType is 0.
+ \param MPType the tracker's precision type.
+ */
+long long num_evaluations_so_far(SolverDoublePrecision const* ED_d, SolverMultiplePrecision const* ED_mp, int MPType);
+
+
 /**
 \brief Indicates which retvals from the bertini1 tracker are acceptable for use.
 */
@@ -2263,10 +2328,4 @@ bool IsAcceptableRetval(int);
 bool IsUnRetrackable(int);
 
 
-
-
-int print_path(comp_d pathVars, mat_d AtimesJ, vec_d current_variable_values, vec_d funcVals, mat_d Jv);
-
-int print_path(comp_mp pathVars, mat_mp AtimesJ, vec_mp current_variable_values, vec_mp funcVals, mat_mp Jv);
-
 #endif
@@ -14,8 +14,6 @@
 
 
 
-extern bool print_this_path;
-extern FILE* g_path_file;
 
 
 /**
@@ -220,7 +218,7 @@ protected:
 
 
 		SLP_memory.set_globals_to_this();
-		clearProg(SLP, this->MPType, 1); // 1 means call freeprogeval()
+		clear_prog(SLP, this->MPType, 1); // 1 means call freeprogeval()
 		delete SLP;
 	}
 };
@@ -253,6 +251,16 @@ class sphere_eval_data_mp : public SolverMultiplePrecision
 {
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "sphere"
+	 */
+	std::string name() const override
+	{
+		return "sphere";
+	}
+
+
     int num_natural_vars; ///< the number of non-synthetic variables, including the homogenizing variable
 
 	comp_mp two, two_full_prec; ///< the number two.
@@ -345,6 +353,13 @@ public:
 			  const WitnessSet & W,
 			  SolverConfiguration & solve_options);
 
+	/**
+	 \brief ensure the persistent temporaries used by sphere_eval_mp exist, and are large enough for the system.
+
+	 Called by setup(), so that evaluation does no allocating, and again at the start of each evaluation, when it is only a few comparisons.
+	 */
+	void reserve_temporaries();
+
 
 
 protected:
@@ -474,6 +489,16 @@ class sphere_eval_data_d : public SolverDoublePrecision
 {
 public:
 
+	/**
+	 \brief the name of the kind of solver, for reports.
+	 \return "sphere"
+	 */
+	std::string name() const override
+	{
+		return "sphere";
+	}
+
+
     int num_natural_vars; ///< the number of non-synthetic variables, including the homogenizing variable
 
 	sphere_eval_data_mp * BED_mp; ///< a pointer to the MP eval data, for AMP mode.
@@ -581,6 +606,13 @@ public:
 			  const WitnessSet & W,
 			  SolverConfiguration & solve_options);
 
+	/**
+	 \brief ensure the persistent temporaries used by sphere_eval_d exist, and are large enough for the system.
+
+	 Called by setup(), so that evaluation does no allocating, and again at the start of each evaluation, when it is only a few comparisons.
+	 */
+	void reserve_temporaries();
+
 
 
 protected:
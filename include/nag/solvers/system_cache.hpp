@@ -0,0 +1,199 @@
+#ifndef SOLVER_SYSTEM_CACHE_H
+#define SOLVER_SYSTEM_CACHE_H
+
+/**
+ \file system_cache.hpp
+
+ contains the cache of straight-line programs which lets a solver's system go to the workers once, rather than once per solve.
+ */
+
+#include <cstdint>
+#include <list>
+#include <map>
+
+#include "programConfiguration.hpp"
+
+
+
+
+/**
+ \brief make an SLP from the parser outputs in the current folder, remembering which system it came from.
+
+ A wrapper around Bertini's setupProg(); every SLP which might be broadcast to the workers should be made by this, or copied by copy_prog, so that bcast_send_prog can tell whether the workers already have it.
+
+ \return the number of variables, as setupProg() returns.
+ \param SLP The SLP to set up.
+ \param precision The precision at which to set it up.
+ \param MPType The MPType.
+ */
+int setup_prog(prog_t *SLP, int precision, int MPType);
+
+
+/**
+ \brief copy an SLP, and what setup_prog remembered about it.
+
+ A wrapper around Bertini's cp_prog_t().
+
+ \param dest The SLP to copy into.  Must not be set up.
+ \param src The SLP to copy.
+ */
+void copy_prog(prog_t *dest, prog_t *src);
+
+
+/**
+ \brief clear an SLP, and forget what setup_prog or copy_prog remembered about it.
+
+ A wrapper around Bertini's clearProg(); every SLP made by setup_prog or copy_prog should be cleared by this, so that a later SLP at the same address is not taken for it.
+
+ \param SLP The SLP to clear.
+ \param MPType The MPType of the SLP.
+ \param freeEvalProg Whether to call freeprogeval(), as for clearProg().
+ */
+void clear_prog(prog_t *SLP, int MPType, int freeEvalProg);
+
+
+/**
+ \brief broadcast an SLP from the head, unless the workers already have it.
+
+ Collective over mpi_config's communicator, paired with bcast_receive_prog.  An SLP is identified by the hash of the parsed system it was made from, its MPType and its current precision; the first time one is sent it goes over Bertini's bcast_prog_t, and each worker keeps a copy in its SystemCache.  After that only the hash is sent, and the workers copy their own.
+
+ An SLP not made by setup_prog or copy_prog is always sent in full.
+
+ \param SLP The SLP to send.
+ \param MPType The MPType of the SLP.
+ \param mpi_config The current state of MPI.
+ */
+void bcast_send_prog(prog_t *SLP, int MPType, ParallelismConfig & mpi_config);
+
+
+/**
+ \brief receive an SLP sent by bcast_send_prog, from the cache if the head says it is there.
+
+ \param SLP The SLP to receive into.  Must not be set up.
+ \param MPType The MPType of the SLP.
+ \param mpi_config The current state of MPI.
+ */
+void bcast_receive_prog(prog_t *SLP, int MPType, ParallelismConfig & mpi_config);
+
+
+
+
+/**
+ \brief the SLPs which have gone from the head to the workers, by hash.
+
+ The head and each worker hold one of these, and update them in step, one entry per bcast_send_prog/bcast_receive_prog; the head's records only the hashes, and tells the workers whether each SLP is one they hold, while the workers' hold a copy of each SLP.  At most Capacity() are kept, the least recently sent being dropped first, identically on every process.
+
+ The head's records stand for the workers' only because every process takes part in every bcast_send_prog, in the same order, so all see the same sequence of SLPs.  That holds because these broadcasts, like Bertini's, go over the whole of MPI_COMM_WORLD.  Were solves ever run concurrently on separate groups of processes, each group would need a cache of its own, kept by its own head.
+
+ There is one per process, got from Instance().
+ */
+class SystemCache
+{
+
+public:
+
+	/**
+	 \brief get the cache of this process.
+	 \return the cache.
+	 */
+	static SystemCache & Instance();
+
+
+	/**
+	 \brief the most SLPs kept.
+	 \return the capacity.
+	 */
+	static unsigned Capacity()
+	{
+		return 16;
+	}
+
+
+	/**
+	 \brief the hash of the system an SLP was made from, as recorded by setup_prog.
+	 \return the hash, or 0 if the SLP was not made by setup_prog or copy_prog.
+	 \param SLP The SLP.
+	 */
+	uint64_t SystemHash(prog_t const* SLP) const
+	{
+		auto found = system_hashes_.find(SLP);
+		return found==system_hashes_.end() ? 0 : found->second;
+	}
+
+
+	/**
+	 \brief record the hash of the system an SLP was made from.
+	 \param SLP The SLP.
+	 \param hash The hash.
+	 */
+	void SetSystemHash(prog_t const* SLP, uint64_t hash)
+	{
+		system_hashes_[SLP] = hash;
+	}
+
+
+	/**
+	 \brief forget the hash recorded for an SLP, as when it is cleared.
+	 \param SLP The SLP.
+	 */
+	void ForgetSystemHash(prog_t const* SLP)
+	{
+		system_hashes_.erase(SLP);
+	}
+
+
+	/**
+	 \brief look up an SLP, and mark it as the most recently sent.
+	 \return whether it is in the cache.
+	 \param key The key of the SLP.
+	 */
+	bool Touch(uint64_t key);
+
+
+	/**
+	 \brief add an SLP, dropping the least recently sent if the cache is full.
+	 \param key The key of the SLP.
+	 \param SLP On a worker, the SLP, a copy of which is kept.  NULL on the head.
+	 \param MPType The MPType of the SLP.
+	 */
+	void Insert(uint64_t key, prog_t *SLP, int MPType);
+
+
+	/**
+	 \brief get the copy of an SLP held by a worker.
+	 \return the SLP.
+	 \param key The key of the SLP, which must be in the cache.
+	 */
+	prog_t * Get(uint64_t key);
+
+
+	~SystemCache();
+
+	SystemCache(const SystemCache&) = delete;
+	SystemCache & operator=(const SystemCache&) = delete;
+
+private:
+
+	SystemCache() = default;
+
+	/**
+	 \brief an SLP in the cache.
+	 */
+	struct Entry
+	{
+		uint64_t key; ///< the hash of the system, MPType and precision.
+		prog_t *SLP; ///< the copy of the SLP, on a worker.  NULL on the head.
+		int MPType; ///< the MPType of the SLP, for clearing it.
+	};
+
+	/**
+	 \brief clear the SLP of an entry, if it holds one.
+	 */
+	static void Clear(Entry & entry);
+
+	std::list<Entry> entries_; ///< the SLPs, most recently sent first.
+	std::map<prog_t const*, uint64_t> system_hashes_; ///< the hashes recorded by setup_prog and copy_prog, by the address of the SLP.  erased by clear_prog, since the address may be reused.
+};
+
+
+#endif
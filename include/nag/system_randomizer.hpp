@@ -2,7 +2,11 @@
 
 /** \file data_type.hpp */
 
+#include <algorithm>
+#include <vector>
+
 #include "bertini1/bertini_extensions.hpp"
+#include "nag/double_double.hpp"
 #include "programConfiguration.hpp"
 /**
  \brief Comprehensive system randomization, based on deg.out.
@@ -45,12 +49,20 @@ private:
 
 
 	vec_d integer_coeffs_d;
-	mat_d single_row_input_d;
 	vec_d temp_homogenizer_d;
-	vec_d temp_funcs_d;
-	mat_d temp_jac_d;
-	mat_d temp_mat_d;
-	vec_d temp_vec_d;
+
+	std::vector<double> randomizer_re_d; ///< the real parts of randomizer_matrix_d, row major.
+	std::vector<double> randomizer_im_d; ///< the imaginary parts of randomizer_matrix_d, row major.
+	std::vector<double> scaled_re_d, scaled_im_d; ///< the randomizer, times the powers of the hom var, for the current call to randomize.
+	std::vector<double> product_rule_re_d, product_rule_im_d; ///< the randomizer, times the derivatives of the powers of the hom var, for the current call to randomize.
+	std::vector<double> jac_re_d, jac_im_d; ///< the input jacobian, split and contiguous, for the current call to randomize.
+	std::vector<double> out_re_d, out_im_d; ///< one row of the randomized jacobian, being accumulated.
+
+	std::vector<ComplexDoubleDouble> randomizer_dd; ///< the full precision randomizer, rounded to double-double, row major.
+	std::vector<ComplexDoubleDouble> scaled_dd; ///< the randomizer, times the powers of the hom var, for the current call to randomize_dd.
+	std::vector<ComplexDoubleDouble> product_rule_dd; ///< the randomizer, times the derivatives of the powers of the hom var, for the current call to randomize_dd.
+	std::vector<ComplexDoubleDouble> jac_dd; ///< the input jacobian, row major, for the current call to randomize_dd.
+	std::vector<ComplexDoubleDouble> out_dd; ///< one row of the randomized jacobian, being accumulated.
 
 
 public:
@@ -191,22 +203,17 @@ public:
 
 
 
-		clear_mat_d(single_row_input_d);
 		clear_mat_mp(single_row_input_mp);
 
 
 
-		clear_vec_d(temp_funcs_d);
 		clear_vec_mp(temp_funcs_mp);
 
-		clear_mat_d(temp_jac_d);
 		clear_mat_mp(temp_jac_mp);
 
 
-		clear_mat_d(temp_mat_d);
 		clear_mat_mp(temp_mat_mp);
 
-		clear_vec_d(temp_vec_d);
 		clear_vec_mp(temp_vec_mp);
 
 
@@ -349,6 +356,27 @@ public:
 				   vec_mp func_vals, mat_mp jacobian_vals,
 				   comp_mp hom_var);
 
+private:
+
+	/**
+	 \brief the body of the multiple precision randomize, computed in double-double, for working precisions of at most DoubleDouble::kBits.
+
+	 The working precision is the curr_prec of the outputs, as the caller asked for it.  GMP rounds mpf precisions up to whole limbs, so it cannot be read from the numbers themselves.
+
+	 The inputs are rounded to double-double, the products are formed there, and the outputs are rounded back to their own precision.  At these precisions, this is as accurate as doing it in MPFR, and several times faster.
+
+	 \param randomized_func_vals output argument, set to R*f.  Already sized.
+	 \param randomized_jacobian output jacobian, set to R*J.  Already sized.
+	 \param func_vals input function values.
+	 \param jacobian_vals input jacobian.
+	 \param hom_var the coordinate of the single homogenizing variable.
+	 */
+	void randomize_dd(vec_mp randomized_func_vals, mat_mp randomized_jacobian,
+					  vec_mp func_vals, mat_mp jacobian_vals,
+					  comp_mp hom_var);
+
+public:
+
 
 	/**
 	 \brief sets up randomizer using 'deg.out'.
@@ -391,11 +419,11 @@ public:
 
 
 	/**
-	 \brief collective MPI_COMM_WORLD broadcast send
+	 \brief collective broadcast send, over mpi_config's communicator
 
 	 \see VertexSet::bcast_receive
 
-	 Send the SystemRandomizer to everyone in MPI_COMM_WORLD.
+	 Send the SystemRandomizer to everyone in mpi_config's communicator.
 
 	 \param mpi_config The current state of MPI, as represented in Bertini_real
 	 */
@@ -403,9 +431,9 @@ public:
 
 
 	/**
-	 \brief Collective MPI_COMM_WORLD broadcast receive
+	 \brief Collective broadcast receive, over mpi_config's communicator
 
-	 Receive the SystemRandomizer from someone in MPI_COMM_WORLD.
+	 Receive the SystemRandomizer from the head of mpi_config's communicator.
 
 	 \param mpi_config The current state of MPI, as represented in Bertini_real
 	 */
@@ -438,7 +466,6 @@ protected:
 
 
 
-		init_mat_d(single_row_input_d,0,0);
 		init_mat_mp(single_row_input_mp,0,0);
 
 
@@ -446,17 +473,13 @@ protected:
 		init_vec_d(temp_homogenizer_d,0);
 		init_vec_mp(temp_homogenizer_mp,0);
 
-		init_vec_d(temp_funcs_d,0);
 		init_vec_mp(temp_funcs_mp,0);
 
-		init_mat_d(temp_jac_d,0,0);
 		init_mat_mp(temp_jac_mp,0,0);
 
 
-		init_mat_d(temp_mat_d,0,0);
 		init_mat_mp(temp_mat_mp,0,0);
 
-		init_vec_d(temp_vec_d,0);
 		init_vec_mp(temp_vec_mp,0);
 
 
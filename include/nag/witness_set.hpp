@@ -557,7 +557,7 @@ public:
 
 
 	/**
-	 individual send, relative to MPI_COMM_WORLD
+	 individual send, over mpi_config's communicator
 
 	 \param target the ID target of the communication
 	 \param mpi_config the current MPI state, as implemented in bertini_real
@@ -565,7 +565,7 @@ public:
     void send(ParallelismConfig & mpi_config, int target) const;
 
 	/**
-	 individual receive, relative to MPI_COMM_WORLD
+	 individual receive, over mpi_config's communicator
 
 	 \param source the ID source of the communication
 	 \param mpi_config the current MPI state, as implemented in bertini_real
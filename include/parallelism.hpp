@@ -11,6 +11,7 @@
 #include "decompositions/curve.hpp"
 
 #include "nag/nid.hpp"
+#include "nag/parameter_sweep.hpp"
 
 /**
 \defgroup mpienabled MPI-enabled classes
@@ -83,6 +84,44 @@ public:
 	 */
 	int main_loop();
 
+
+	/**
+	 \brief dismiss the workers, and finish the run profile, writing it if the run succeeded.
+
+	 Collective, paired with the workers leaving WorkerProcess::main_loop and finishing their profiles.  Call it once main_loop has returned or thrown, so that the workers are let go either way, and a JobService can go on to its next job.
+
+	 \param succeeded Whether main_loop succeeded.
+	 */
+	void finish(bool succeeded);
+
+
+	/**
+	 \brief decompose one witness set, in the mode of the program options.
+
+	 Makes a fresh VertexSet for the set, so that the components of a batch are decomposed independently of each other.
+
+	 \param W The witness set to decompose.
+	 \param pi The projection, of length the dimension of W.
+	 \param num_vars The number of variables, including the homogenizing ones.
+	 */
+	void decompose(WitnessSet & W, vec_mp *pi, int num_vars);
+
+
+	/**
+	 \brief decompose a component again at each step of the sweep file, with -sweep.
+
+	 The witness points of the component at each step are carried from the previous step's by ParameterSweep::Continue, or the witness data is computed from scratch by Bertini if that fails, and the component found again among it by the points which did come through, or as the only one of its dimension.  The critical points, slices and midpoints are solved for afresh.  The component is then decomposed, with the same projection, into the output folder of the run with `_step_k` appended.  The sweep stops at a step where the component is lost.
+
+ The steps' input files and witness data are written in the run's workspace, which -sweep makes if -scratch does not, so the called folder keeps the run's own.
+
+	 \param given_options The options as given, before the decomposition of step 0 changed them.
+	 \param dim The dimension of the component.
+	 \param comp The number of the component.
+	 \param pi The projection, of length dim.
+	 \param num_vars The number of variables, including the homogenizing ones.
+	 */
+	void sweep(BertiniRealConfig const& given_options, int dim, int comp, vec_mp *pi, int num_vars);
+
 	void bertini_real(WitnessSet & W, vec_mp *pi, VertexSet & V);
 
 
@@ -4,7 +4,9 @@
 /** \file programConfiguration.hpp */
 #include "config.h"
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <getopt.h>
 #include <queue>
 
@@ -31,6 +33,7 @@ enum class SymEngine{Matlab, Python}; // this is to indicate which symbolic engi
 /**
  \brief Carries the configuration of MPI, including ID number, communicator, id of headnode, etc.
 
+ Every transfer and broadcast of bertini_real's own goes over comm(), from head().  The routines of Bertini1 itself -- its parser, bcast_tracker_config_t, the bcast_* of vectors and numbers, and the SLP broadcast -- still use MPI_COMM_WORLD, and every solver calls them, so the communicator is always MPI_COMM_WORLD.
 
  */
 class ParallelismConfig
@@ -256,11 +259,14 @@ class ProgramConfigBase : public ParallelismConfig
 private:
 
 	int robustness_ = 1;  ///< indicator of whether to use the robust solver wherever possible
+	int batch_size_ = 0; ///< how many paths to advance together in double precision before the endgame.
+	bool path_telemetry_ = false; ///< whether to record each path of each solve.
 	int verbose_level_ = 0;
 
 	boost::filesystem::path called_dir_;
-	boost::filesystem::path working_dir_;
+	boost::filesystem::path working_dir_; ///< the folder in which the parser and generators write their files.  the called folder, unless there is a scratch base.
 	boost::filesystem::path output_dir_;
+	boost::filesystem::path scratch_base_; ///< the folder in which to make a private workspace for the run, or "memory" for a memory-backed one.  empty means work in the called folder.
 
 	boost::timer::cpu_timer timer_;
 protected:
@@ -310,6 +316,29 @@ public:
 
 
 
+	/**
+	 \brief get the folder in which move_to_temp makes the run's private workspace
+
+	 \return the scratch base.  empty if the run works in the called folder, and "memory" for a memory-backed workspace.
+	 */
+	boost::filesystem::path scratch_base() const
+	{
+		return scratch_base_;
+	}
+
+
+	/**
+	 \brief set the folder in which move_to_temp makes the run's private workspace
+
+	 \param new_base the scratch base.  empty to work in the called folder, and "memory" for /dev/shm, or the system temporary folder if there is no /dev/shm.
+	 */
+	void scratch_base(boost::filesystem::path new_base)
+	{
+		scratch_base_ = new_base;
+	}
+
+
+
 	/**
 	 get the output directory
 
@@ -361,6 +390,42 @@ public:
 		robustness_ = new_val;
 	}
 
+	/**
+	 \brief get the number of paths to advance together in double precision, before the endgame.  0 or 1 means each path is tracked alone.
+	 \return the batch size
+	 */
+	int batch_size() const
+	{
+		return batch_size_;
+	}
+
+	/**
+	 \brief set the number of paths to advance together in double precision
+	 \param new_val the new batch size
+	 */
+	void batch_size(int new_val)
+	{
+		batch_size_ = new_val;
+	}
+
+	/**
+	 \brief get whether to record each path of each solve, to path_telemetry.csv.
+	 \return whether to record.
+	 */
+	bool path_telemetry() const
+	{
+		return path_telemetry_;
+	}
+
+	/**
+	 \brief set whether to record each path of each solve
+	 \param new_val whether to record
+	 */
+	void path_telemetry(bool new_val)
+	{
+		path_telemetry_ = new_val;
+	}
+
 
 	/**
 	 \brief set the level of verbosity
@@ -374,9 +439,21 @@ public:
 	}
 
 
-	void move_to_temp();
+	/**
+	 \brief move into the run's workspace, in which Bertini's parser and all of bertini_real's generators write their fixed-name files.
+
+	 If there is no scratch base, the workspace is the called folder, and nothing moves.  Otherwise the head makes up a fresh folder in the scratch base, unique to this run, and every process changes into it, so that runs sharing a folder, or a node, do not overwrite each other's files, and the many small files go to local or memory-backed storage.  Collective over comm().
+
+	 \param inputs Files the run reads by fixed name, relative to the called folder, which the head copies into the workspace.  {\em e.g.} witness_data.
+	 */
+	void move_to_temp(std::vector<boost::filesystem::path> const& inputs = {});
+
+	/**
+	 \brief move back to the called folder, and remove the run's workspace, if it is private.  Collective over comm().
 
-	void move_to_called();
+	 \param outputs Files the run writes by fixed name for the user, which the head copies from the workspace back to the called folder.  {\em e.g.} Dir_Name.
+	 */
+	void move_to_called(std::vector<boost::filesystem::path> const& outputs = {});
 
 	/**
 	\brief Write some structured meta data to a file, including things like runtime, number of processors used, and version of program used.
@@ -431,6 +508,11 @@ class BertiniRealConfig : public ProgramConfigBase
 
 	int target_dimension_;  ///< the dimension to shoot for
 	int target_component_;  ///< the integer index of the component to decompose.  by default, it's -2, which indicates 'ask me'.
+	bool batch_mode_; ///< whether to decompose several components of the target dimension in one run, rather than one.
+	std::vector<int> batch_components_; ///< the components to decompose in batch mode.  empty means all of them.
+	boost::filesystem::path serve_queue_; ///< the queue folder to serve jobs from, with -serve.  empty means run once, as called.
+	boost::filesystem::path sweep_filename_; ///< the file of parameter values to sweep through, with -sweep.  empty means no sweep.
+	boost::filesystem::path reuse_dir_; ///< an earlier surface Decomposition whose sphere-independent stages to reuse, with -reuse.  empty means compute them.
 
 
 	std::string matlab_command_; ///< the string for how to call matlab.
@@ -548,6 +630,16 @@ public:
 	}
 
 
+	/**
+	 set the path to the Bertini input file.
+
+	 \param new_name the new path.
+	 */
+	void set_input_filename(boost::filesystem::path const& new_name){
+		input_filename_ = new_name;
+	}
+
+
 	/**
 	 get the path to the sphere file.
 
@@ -636,6 +728,56 @@ public:
 		return target_component_;
 	}
 
+
+	/**
+	 \brief query whether to decompose several components in one run.  set by -components.
+	 \return whether in batch mode.
+	 */
+	bool batch_mode() const
+	{
+		return batch_mode_;
+	}
+
+
+	/**
+	 \brief get the components to decompose in batch mode.
+	 \return the component numbers.  empty means every component of the target dimension.
+	 */
+	std::vector<int> const& batch_components() const
+	{
+		return batch_components_;
+	}
+
+
+	/**
+	 \brief get the queue folder to serve jobs from.  set by -serve.
+	 \return the folder.  empty means this is an ordinary run, not a JobService.
+	 */
+	boost::filesystem::path serve_queue() const
+	{
+		return serve_queue_;
+	}
+
+
+	/**
+	 \brief get the file of parameter values to sweep through.  set by -sweep.
+	 \return the file.  empty means decompose at the parameter values of the input file alone.
+	 */
+	boost::filesystem::path sweep_filename() const
+	{
+		return sweep_filename_;
+	}
+
+
+	/**
+	 \brief get the earlier Decomposition whose sphere-independent stages to reuse.  set by -reuse.
+	 \return the folder of the Decomposition.  empty means compute them.
+	 */
+	boost::filesystem::path reuse_dir() const
+	{
+		return reuse_dir_;
+	}
+
 	/**
 	 get whether are supposed to use the gamma trick.  default is no.
 
@@ -905,6 +1047,8 @@ public:
 
 
 
+class SamplingStream;
+
 class sampler_configuration : public ProgramConfigBase
 {
 public:
@@ -938,6 +1082,53 @@ public:
 	int cycle_num = 2;
 
 	bool save_ribs; ///< whether to write the ribs to a file
+
+	bool use_error_estimate; ///< switch for adaptive surface refinement, between distance between samples and deviation of the surface from straight segments.  both are measured against TOL.
+
+	int first_face = 0; ///< the first face of a surface to sample.  for splitting sampling of a surface across independent jobs.
+	int last_face = -1; ///< the last face of a surface to sample, inclusive.  negative means through the last face.
+	bool fresh_start = false; ///< whether to discard face journals from previous runs, rather than resuming from them.
+	uint64_t decomposition_hash = 0; ///< a hash of the vertex set, summary and faces of the decomposition being sampled, so a journal is replayed only onto the decomposition it was written for.  set by the master once the decomposition is read.
+
+	bool stream_output = false; ///< whether to write the progressive sampling stream, samp.stream, as sampling runs.
+	std::shared_ptr<SamplingStream> stream; ///< the progressive sampling stream, if stream_output.  set up by the master once the vertex set is read.
+
+	int benchmark_evaluations = 0; ///< if positive, the number of evaluations of the midpoint homotopy to time, at the start of the first face sampled.  only read in builds with evaluator_benchmark defined.
+
+
+	/**
+	 \brief query whether sampling is restricted to a range of faces, by -faces.
+	 \return whether only some faces are to be sampled.
+	 */
+	bool samples_face_subset() const
+	{
+		return first_face>0 || last_face>=0;
+	}
+
+	/**
+	 \brief query whether a face is in the range to be sampled.
+	 \return whether face_index is in [first_face, last_face].
+	 \param face_index The index of the face.
+	 */
+	bool face_in_range(int face_index) const
+	{
+		return face_index>=first_face && (last_face<0 || face_index<=last_face);
+	}
+
+	/**
+	 \brief get the name of this run's face journal, {\em e.g.} "faces_all" or "faces_100-200".
+	 \see FaceJournal
+	 \return the name
+	 */
+	std::string journal_run_name() const;
+
+	/**
+	 \brief get a textual summary of the settings which affect surface sampling, and of the decomposition sampled, to decide whether a face journal from another run may be re-used.
+	 \see FaceJournal
+	 \return the summary
+	 */
+	std::string journal_signature() const;
+
 	/**
 	 \brief get the sampler_configuration from the command line. */
 	int  parse_commandline(int argc, char **argv);
@@ -988,7 +1179,7 @@ public:
 /**
  \brief splits the bertini input file into several files for later use.
 
- calls MPI_Bcast(&PARSING, 1, MPI_INT, 0, MPI_COMM_WORLD); to be able to let workers carry through.  sadly, the parse_input() method in Bertini calls an MPI_Bcast, which will trip up the workers if it is not caught.
+ Call on the head only, while the workers wait for a routine.  Bertini's parse_input() broadcasts over MPI_COMM_WORLD, so the head first broadcasts PARSING, and every worker loop catches the parser's broadcast with CatchParse.
 
  basically, the files made are
  • num.out
@@ -1008,7 +1199,7 @@ unsigned int parse_input_file(boost::filesystem::path filename);
 /**
  \brief splits the bertini input file into several files for later use.
 
- calls MPI_Bcast(&PARSING, 1, MPI_INT, 0, MPI_COMM_WORLD); to be able to let workers carry through.  sadly, the parse_input() method in Bertini calls an MPI_Bcast, which will trip up the workers if it is not caught.
+ Call on the head only, while the workers wait for a routine.  Bertini's parse_input() broadcasts over MPI_COMM_WORLD, so the head first broadcasts PARSING, and every worker loop catches the parser's broadcast with CatchParse.
 
  basically, the files made are
  • num.out
@@ -1028,6 +1219,53 @@ unsigned int parse_input_file(boost::filesystem::path filename);
 unsigned int parse_input_file(boost::filesystem::path filename, int * MPType);
 
 
+/**
+ \brief the worker's side of parse_input_file, having received PARSING.  Catches the broadcast Bertini's parser makes over MPI_COMM_WORLD.
+ */
+void CatchParse();
+
+
+/**
+ \brief the names of the files written by Bertini's parser into the current folder, which together constitute a parsed system.
+
+ \return the list of names, {\em e.g.} num.out, func_input, preproc_data.
+ */
+const std::vector<std::string> & ParsedSystemFiles();
+
+
+/**
+ \brief hash the parser outputs in the current folder, to identify the system they describe.
+
+ \return a hash of the contents of the files named by ParsedSystemFiles().
+ */
+uint64_t HashParsedSystem();
+
+
+/**
+ \brief save the files produced by the most recent call to parse_input_file, so they may be restored later without re-parsing.
+
+ The parser outputs in the current folder are copied into snapshot_dir, along with a small `source` file recording the name of the input file, the MPType, and a hash of the input file's contents.  The input file must have been the most recent one parsed.
+
+ \param input_filename The name of the input file which was parsed.
+ \param MPType The MPType the parser reported for the input file.
+ \param snapshot_dir The folder into which to save the snapshot.  Created if necessary.
+ */
+void SaveParsedSystem(boost::filesystem::path const& input_filename, int MPType, boost::filesystem::path const& snapshot_dir);
+
+
+/**
+ \brief restore the parser outputs saved by SaveParsedSystem into the current folder, in place of a call to parse_input_file.
+
+ The snapshot is used only if the input file still hashes to the recorded value, and every file is present.  Otherwise nothing is touched, and the caller should parse.
+
+ \return whether the snapshot was restored.
+ \param input_filename The name of the input file the caller would have parsed.
+ \param MPType Set to the MPType recorded in the snapshot, if restored.
+ \param snapshot_dir The folder holding the snapshot.
+ */
+bool RestoreParsedSystem(boost::filesystem::path const& input_filename, int * MPType, boost::filesystem::path const& snapshot_dir);
+
+
 /**
  \brief a wrapper around setupPreProcData(), and populates a preproc_data
 
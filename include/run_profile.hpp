@@ -0,0 +1,184 @@
+#ifndef BR_RUN_PROFILE_H
+#define BR_RUN_PROFILE_H
+
+/**
+ \file run_profile.hpp
+
+ contains the stage-level timing and resource profile of a run of bertini_real or the sampler.
+ */
+
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/timer/timer.hpp>
+
+#include "mpi.h"
+
+
+
+
+/**
+ \brief the timings and counts of the stages of one run, on one process.
+
+ Stages are opened and closed by StageTimer, and may nest; a stage's name in the profile is its own name joined to those of the stages containing it by '/', {\em e.g.} "surface/slices_mid/interslice".  A stage opened more than once, such as the interslice of each of the slices, is one entry in the profile, with its numbers summed over the times it was open.  For each stage, the wall and cpu time, the peak resident set size at its end, and the number of solves, total paths, and MPI bytes sent during it are recorded.
+
+ Solves and paths are counted by master_solver.  Bytes sent are counted by hooking MPI_Send, MPI_Isend and MPI_Bcast through the MPI profiling interface, so every send is counted, including Bertini's own, without touching the call sites; a broadcast counts once per receiving process.  Those counts are for this process only; Finish gathers the totals over all processes at the end of the run.
+
+ There is one profile per process, got from Instance().
+ */
+class RunProfile
+{
+
+public:
+
+	/**
+	 \brief the numbers recorded for one stage.
+	 */
+	struct Stage
+	{
+		std::string name; ///< the full name of the stage, including those of the stages containing it.
+		int depth; ///< how many stages contain this one.
+		int num_calls; ///< how many times the stage was opened.
+		double wall_time; ///< wall time, in seconds.
+		double cpu_time; ///< user plus system time of this process, in seconds.
+		long peak_rss_kb; ///< the peak resident set size of this process at the latest end of the stage, in kilobytes.
+		long long num_solves; ///< how many solves were run during the stage.
+		long long num_paths; ///< how many paths those solves had.
+		long long mpi_bytes_sent; ///< how many bytes this process sent over MPI during the stage.
+	};
+
+
+
+	/**
+	 \brief opens a stage of the profile on construction, and closes it on destruction.
+	 */
+	class StageTimer
+	{
+
+	public:
+
+		/**
+		 \param name The name of the stage, without those of the stages containing it.
+		 */
+		StageTimer(std::string const& name);
+
+		~StageTimer();
+
+		StageTimer(const StageTimer&) = delete;
+		StageTimer & operator=(const StageTimer&) = delete;
+
+	private:
+
+		unsigned index_; ///< the index of the stage in the profile.
+		boost::timer::cpu_timer timer_; ///< times the stage.
+		long long num_solves_at_start_; ///< the profile's count of solves when the stage was opened.
+		long long num_paths_at_start_; ///< the profile's count of paths when the stage was opened.
+		long long mpi_bytes_at_start_; ///< the profile's count of bytes sent when the stage was opened.
+	};
+
+
+
+	/**
+	 \brief get the profile of this process.
+	 \return the profile.
+	 */
+	static RunProfile & Instance();
+
+
+	/**
+	 \brief the name of the file into which the profile of a program is written, in the decomposition's folder, alongside run_metadata.
+	 \return the name, {\em e.g.} "bertini_real_profile.json".
+	 \param program The name of the program.
+	 */
+	static std::string FileName(std::string const& program)
+	{
+		return program + "_profile.json";
+	}
+
+
+	/**
+	 \brief count a solve.
+	 \param num_paths The number of paths of the solve.
+	 */
+	void CountSolve(int num_paths)
+	{
+		num_solves_++;
+		num_paths_ += num_paths;
+	}
+
+
+	/**
+	 \brief count bytes sent over MPI by this process.
+	 \param num_bytes How many.
+	 */
+	void CountBytesSent(long long num_bytes)
+	{
+		mpi_bytes_sent_ += num_bytes;
+	}
+
+
+	/**
+	 \brief get the stages, in the order they were first opened.
+	 \return the stages.
+	 */
+	std::vector<Stage> const& Stages() const
+	{
+		return stages_;
+	}
+
+
+	/**
+	 \brief gather the totals of bytes sent and peak memory over all processes.
+
+	 Collective over the communicator; every process must call it, once, after all the work of the run is done.
+
+	 \param comm The communicator of the run.
+	 \param head The id of the process which writes the profile.
+	 */
+	void Finish(MPI_Comm comm, int head);
+
+
+	/**
+	 \brief empty the profile, and restart its timer, for the next run in the same process.
+
+	 Used between the jobs of a JobService, so that each job's profile is its own.  No stage may be open.
+	 */
+	void Reset();
+
+
+	/**
+	 \brief write the profile as JSON.
+
+	 \param filename The file to write.
+	 \param program The name of the program being profiled, {\em e.g.} "bertini_real".
+	 \param num_procs The number of processes of the run.
+	 */
+	void Write(boost::filesystem::path const& filename, std::string const& program, int num_procs) const;
+
+private:
+
+	RunProfile() = default;
+
+	/**
+	 \brief the peak resident set size of this process so far.
+	 \return the peak, in kilobytes.
+	 */
+	static long PeakRSS();
+
+
+	boost::timer::cpu_timer timer_; ///< times the whole run, from the first use of the profile.
+
+	std::vector<Stage> stages_; ///< the stages, in the order they were first opened.
+	std::vector<std::string> open_stages_; ///< the full names of the stages currently open, innermost last.
+
+	long long num_solves_ = 0; ///< how many solves have been run.
+	long long num_paths_ = 0; ///< how many paths those solves had.
+	long long mpi_bytes_sent_ = 0; ///< how many bytes this process has sent over MPI.
+
+	long long total_mpi_bytes_sent_ = 0; ///< the bytes sent by all processes, from Finish.
+	long max_peak_rss_kb_ = 0; ///< the greatest peak resident set size of any process, from Finish.
+};
+
+
+#endif
@@ -8,6 +8,8 @@
 #include <boost/timer/timer.hpp>
 
 #include "io/fileops.hpp"
+#include "io/face_journal.hpp"
+#include "io/sampling_stream.hpp"
 
 #include "programConfiguration.hpp"
 #include "decompositions/checkSelfConjugate.hpp"
@@ -49,6 +51,20 @@ void common_sampler_startup(const Decomposition & D,
 
 
 
+/**
+ \brief get the parser outputs for an input file into the current folder, from the snapshot left by bertini_real if it matches, else by parsing.
+
+ \see RestoreParsedSystem
+ \ingroup samplermethods
+
+ \param input_filename The name of the input file to parse.
+ \param sampler_options The current state of sampler.  The snapshot is looked for in its output_dir.
+ */
+void parse_or_restore_input_file(boost::filesystem::path const& input_filename,
+								 sampler_configuration const& sampler_options);
+
+
+
 
 /**
  \brief get the MPType, name of the directory to sample, and the dimension of the Decomposition.
@@ -69,6 +85,19 @@ int get_dir_mptype_dimen(boost::filesystem::path & Dir_Name, int & MPType, int &
 
 
 
+/**
+ \brief sample a decomposition, as the sampler does when called from the command line, on every process.
+
+ Moves into the run's workspace, runs SamplerMaster on the head and SamplerWorker on the others, dismisses the workers whether or not the head succeeded, and writes the run profile.  MPI must be initialized, and is left so.  A worker which throws aborts the run, since the head is waiting on it.
+
+ \ingroup samplermethods
+
+ \return 0 on success, 1 if the head threw.  The same on every process.
+ \param sampler_options The options, parsed from the command line.
+ */
+int RunSampler(sampler_configuration & sampler_options);
+
+
 /**
  \brief Master process function for sampler module
 
@@ -133,6 +162,19 @@ void estimate_new_projection_value(comp_mp result, vec_mp left, vec_mp right, ve
 void estimate_new_projection_value(comp_mp result, vec_mp estimated_point, vec_mp left, vec_mp right, vec_mp pi);
 
 
+/**
+ \brief estimate the error of a straight segment as an approximation to the curve through three points, as the distance from the middle point to the line through the outer two.
+
+ All three points are homogeneous, and are dehomogenized before comparison.  Only the real parts are used, as the points are real.
+
+ \param result the computed distance.
+ \param left one end of the segment.
+ \param mid a point on the curve between the ends.
+ \param right the other end of the segment.
+ */
+void midpoint_deviation(mpf_t result, const vec_mp left, const vec_mp mid, const vec_mp right);
+
+
 
 
 
@@ -21,6 +21,7 @@ import bertini_real.surface
 import bertini_real.curve
 import bertini_real.util
 import bertini_real.plot
+import bertini_real.service
 try:
     import bertini_real.glumpyplotter
 except ImportError as e:
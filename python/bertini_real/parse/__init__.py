@@ -279,4 +279,131 @@ def parse_surface_samples(directory):
             samples[ii] = curr_samples
             f.readline()  # read blank line.
 
-        return samples
\ No newline at end of file
+        return samples
+
+ARCHIVE_NAME = 'decomposition.brarchive'
+ARCHIVE_MAGIC = b'BRARCHV1'
+
+
+def parse_archive_toc(directory):
+    """ Read the table of contents of the single-file decomposition archive, if there is one.
+
+        Only the table of contents is read; use read_archive_chunk to get the contents of a chunk.
+
+        :param directory: Directory of the decomposition
+        :rtype: dict mapping chunk names (e.g. 'curve_crit/E.edge') to (offset, size) pairs, or None if there is no archive
+    """
+    import struct
+
+    filename = os.path.join(directory, ARCHIVE_NAME)
+    if not os.path.isfile(filename):
+        return None
+
+    with open(filename, 'rb') as f:
+        if f.read(len(ARCHIVE_MAGIC)) != ARCHIVE_MAGIC:
+            raise RuntimeError("%s is not a bertini_real decomposition archive" % filename)
+
+        toc_offset, = struct.unpack('=Q', f.read(8))
+        f.seek(toc_offset)
+
+        num_chunks, = struct.unpack('=Q', f.read(8))
+        toc = {}
+        for ii in range(num_chunks):
+            name_length, = struct.unpack('=Q', f.read(8))
+            name = f.read(name_length).decode('utf-8')
+            offset, size = struct.unpack('=QQ', f.read(16))
+            toc[name] = (offset, size)
+
+    return toc
+
+
+def read_archive_chunk(directory, name, toc=None):
+    """ Read the contents of one chunk of the decomposition archive, seeking directly to it.
+
+        :param directory: Directory of the decomposition
+        :param name: name of the chunk, relative to the decomposition folder, e.g. 'S.surf'
+        :param toc: the table of contents, as returned by parse_archive_toc.  read if not provided.
+        :rtype: the contents of the chunk, as a string
+    """
+    if toc is None:
+        toc = parse_archive_toc(directory)
+    if toc is None:
+        raise FileNotFoundError("no decomposition archive in %s" % directory)
+    if name not in toc:
+        raise KeyError("decomposition archive has no chunk named %s" % name)
+
+    offset, size = toc[name]
+    with open(os.path.join(directory, ARCHIVE_NAME), 'rb') as f:
+        f.seek(offset)
+        return f.read(size).decode('utf-8')
+
+
+STREAM_NAME = 'samp.stream'
+
+
+def read_sampling_stream(directory, state=None):
+    """ Read the progressive sampling stream written by the sampler with -stream, picking up where a previous call left off.
+
+        Only complete blocks are read, so this may be called repeatedly while the sampler is still running.  The latest block for each face and edge is kept, which is the finest so far.
+
+        :param directory: Directory of the decomposition
+        :param state: the dict returned by a previous call, to continue from.  None to start from the beginning.
+        :rtype: dict with keys 'offset', 'num_coordinates', 'points' (list of tuples), 'faces' (dict face index -> (level, list of triangles)), 'edges' (dict (curve name, edge index) -> (level, list of indices)), and 'done'
+    """
+    if state is None:
+        state = {'offset': 0, 'num_coordinates': None, 'points': [], 'faces': {}, 'edges': {}, 'done': False}
+
+    filename = os.path.join(directory, STREAM_NAME)
+    if not os.path.isfile(filename):
+        return state
+
+    with open(filename, 'r') as f:
+        f.seek(state['offset'])
+        lines = f.read().split('\n')
+
+    # the last entry is either empty, or a line still being written.
+    lines = lines[:-1]
+
+    consumed = 0
+    ii = 0
+    while ii < len(lines):
+        words = lines[ii].split()
+        if not words:
+            consumed += len(lines[ii]) + 1
+            ii += 1
+            continue
+
+        if words[0] in ('bertini_real_stream', 'done'):
+            if words[0] == 'done':
+                state['done'] = True
+            else:
+                state['num_coordinates'] = int(words[2])
+            consumed += len(lines[ii]) + 1
+            ii += 1
+            continue
+
+        # find the end of this block.  stop if it isn't complete yet.
+        end = ii + 1
+        while end < len(lines) and lines[end] != 'end':
+            end += 1
+        if end >= len(lines):
+            break
+
+        body = lines[ii + 1:end]
+        if words[0] == 'vertices':
+            for line in body:
+                state['points'].append(tuple(float(x) for x in line.split()))
+        elif words[0] == 'face':
+            triangles = [tuple(int(x) for x in line.split()) for line in body]
+            state['faces'][int(words[1])] = (int(words[2]), triangles)
+        elif words[0] == 'edge':
+            indices = [int(x) for x in body[0].split()] if body else []
+            state['edges'][(words[1], int(words[2]))] = (int(words[3]), indices)
+        else:
+            raise RuntimeError("unknown block '%s' in sampling stream" % words[0])
+
+        consumed += sum(len(line) + 1 for line in lines[ii:end + 1])
+        ii = end + 1
+
+    state['offset'] += consumed
+    return state
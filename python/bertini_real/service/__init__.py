@@ -0,0 +1,66 @@
+"""
+    :platform: Unix
+    :synopsis: Submit bertini_real and sampler jobs to a running job service, started with `mpiexec -n N bertini_real -serve <queue>`.
+
+    A job is a file `<name>.job` in the queue folder: the program, the folder to run it in, and then the command line arguments, one per line.  The service renames it `<name>.running` while it runs, then `<name>.done` or `<name>.failed`, and writes what the program printed to `<name>.log`.
+
+        name = bertini_real.service.submit('queue', 'bertini_real', 'my_curve', ['-components', 'all'])
+        bertini_real.service.wait('queue', name)
+        name = bertini_real.service.submit('queue', 'sampler', 'my_curve', ['-mode', 'f', '-numsamples', '10'])
+        bertini_real.service.wait('queue', name)
+        bertini_real.service.stop('queue')
+"""
+
+import os
+import time
+
+
+def submit(queue, program, folder, args=(), name=None):
+    """ Put a job in the queue.
+
+        :param queue: The queue folder of the service.
+        :param program: 'bertini_real' or 'sampler'.
+        :param folder: The folder to run the program in, as if it were called there.
+        :param args: The command line arguments.
+        :param name: The name of the job.  Jobs run in order of their names; by default, the time of submission.
+        :rtype: The name of the job.
+    """
+    if name is None:
+        name = "{:.6f}".format(time.time()).replace(".", "_")
+
+    text = "\n".join([program, os.path.abspath(folder)] + [str(a) for a in args]) + "\n"
+
+    temp_name = os.path.join(queue, name + ".submitting")
+    with open(temp_name, "w") as f:
+        f.write(text)
+    os.rename(temp_name, os.path.join(queue, name + ".job"))  # so that the service never reads half a job
+    return name
+
+
+def status(queue, name):
+    """ The state of a job.
+
+        :rtype: 'waiting', 'running', 'done', 'failed', or None if there is no such job.
+    """
+    for state, extension in (("waiting", ".job"), ("running", ".running"), ("done", ".done"), ("failed", ".failed")):
+        if os.path.exists(os.path.join(queue, name + extension)):
+            return state
+    return None
+
+
+def wait(queue, name, poll_seconds=1):
+    """ Wait for a job to finish.
+
+        :rtype: Whether it succeeded.
+    """
+    while True:
+        state = status(queue, name)
+        if state in ("done", "failed", None):
+            return state == "done"
+        time.sleep(poll_seconds)
+
+
+def stop(queue):
+    """ Tell the service to stop, once the job in progress is done.
+    """
+    open(os.path.join(queue, "stop"), "w").close()
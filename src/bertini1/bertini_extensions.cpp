@@ -4,10 +4,6 @@
 
 
 
-
-
-
-
 std::string enum_lookup(int flag, int hint)
 {
 	if (hint)
@@ -72,6 +68,9 @@ std::string enum_lookup(int flag, int hint)
 		case NUMPACKETS:
 			return "NUMPACKETS";
 
+		case PATH_TELEMETRY:
+			return "PATH_TELEMETRY";
+
 		case INACTIVE:
 			return "INACTIVE";
 
@@ -1514,7 +1513,7 @@ int sort_increasing_by_real(vec_mp projections_sorted,
 
 
 
-void send_patch_d(const patch_eval_data_d * patch)
+void send_patch_d(const patch_eval_data_d * patch, int root, MPI_Comm comm)
 {
 	comp_d *patch_coeff = NULL;
 	patch_eval_data_d_int PED_int;
@@ -1527,8 +1526,8 @@ void send_patch_d(const patch_eval_data_d * patch)
 	cp_patch_d_int(&PED_int, const_cast<patch_eval_data_d *>(patch), &patch_coeff, 0);
 
 	// broadcast patch structures
-	MPI_Bcast(&PED_int, 1, mpi_patch_d_int, 0, MPI_COMM_WORLD);
-	MPI_Bcast(patch_coeff, PED_int.patchCoeff_rows * PED_int.patchCoeff_cols, mpi_comp_d, 0, MPI_COMM_WORLD);
+	MPI_Bcast(&PED_int, 1, mpi_patch_d_int, root, comm);
+	MPI_Bcast(patch_coeff, PED_int.patchCoeff_rows * PED_int.patchCoeff_cols, mpi_comp_d, root, comm);
 
 	// free memory
 	MPI_Type_free(&mpi_comp_d);
@@ -1537,7 +1536,7 @@ void send_patch_d(const patch_eval_data_d * patch)
 }
 
 
-void receive_patch_d(patch_eval_data_d * patch)
+void receive_patch_d(patch_eval_data_d * patch, int root, MPI_Comm comm)
 {
 	comp_d *patch_coeff = NULL;
 	patch_eval_data_d_int PED_int;
@@ -1548,10 +1547,10 @@ void receive_patch_d(patch_eval_data_d * patch)
 	create_patch_eval_data_d_int(&mpi_patch_d_int);
 
 	// recv patch structures
-	MPI_Bcast(&PED_int, 1, mpi_patch_d_int, 0, MPI_COMM_WORLD);
+	MPI_Bcast(&PED_int, 1, mpi_patch_d_int, root, comm);
 	// setup patch_coeff
 	patch_coeff = (comp_d *)br_malloc(PED_int.patchCoeff_rows * PED_int.patchCoeff_cols * sizeof(comp_d));
-	MPI_Bcast(patch_coeff, PED_int.patchCoeff_rows * PED_int.patchCoeff_cols, mpi_comp_d, 0, MPI_COMM_WORLD);
+	MPI_Bcast(patch_coeff, PED_int.patchCoeff_rows * PED_int.patchCoeff_cols, mpi_comp_d, root, comm);
 
 
 	// setup patch
@@ -1563,7 +1562,7 @@ void receive_patch_d(patch_eval_data_d * patch)
 }
 
 
-void send_patch_mp(const patch_eval_data_mp * patch)
+void send_patch_mp(const patch_eval_data_mp * patch, int root, MPI_Comm comm)
 {
 	char *patchStr = NULL;
 	patch_eval_data_mp_int PED_int;
@@ -1575,16 +1574,16 @@ void send_patch_mp(const patch_eval_data_mp * patch)
 	cp_patch_mp_int(&PED_int, const_cast<patch_eval_data_mp *>(patch), &patchStr, 0, 0);
 
 	// send PED_int
-	MPI_Bcast(&PED_int, 1, mpi_patch_int, 0, MPI_COMM_WORLD);
+	MPI_Bcast(&PED_int, 1, mpi_patch_int, root, comm);
 	// send patchStr
-	MPI_Bcast(patchStr, PED_int.totalLength, MPI_CHAR, 0, MPI_COMM_WORLD);
+	MPI_Bcast(patchStr, PED_int.totalLength, MPI_CHAR, root, comm);
 
 	// clear memory
 	free(patchStr);
 	MPI_Type_free(&mpi_patch_int);
 }
 
-void receive_patch_mp(patch_eval_data_mp * patch)
+void receive_patch_mp(patch_eval_data_mp * patch, int root, MPI_Comm comm)
 {
 	char *patchStr = NULL;
 	patch_eval_data_mp_int PED_int;
@@ -1593,12 +1592,12 @@ void receive_patch_mp(patch_eval_data_mp * patch)
 	// setup mpi_patch_int
 	create_patch_eval_data_mp_int(&mpi_patch_int);
 	// recv PED_int
-	MPI_Bcast(&PED_int, 1, mpi_patch_int, 0, MPI_COMM_WORLD);
+	MPI_Bcast(&PED_int, 1, mpi_patch_int, root, comm);
 
 	// setup patchStr
 	patchStr = (char *)br_malloc(PED_int.totalLength * sizeof(char));
 	// recv patchStr
-	MPI_Bcast(patchStr, PED_int.totalLength, MPI_CHAR, 0, MPI_COMM_WORLD);
+	MPI_Bcast(patchStr, PED_int.totalLength, MPI_CHAR, root, comm);
 
 	// setup _mp patch
 	cp_patch_mp_int(patch, &PED_int, &patchStr, 1, 1);
@@ -1611,7 +1610,7 @@ void receive_patch_mp(patch_eval_data_mp * patch)
 
 
 
-void send_preproc_data(const preproc_data *PPD){
+void send_preproc_data(const preproc_data *PPD, int root, MPI_Comm comm){
 
 
 	int *buffer = new int[3];
@@ -1620,21 +1619,21 @@ void send_preproc_data(const preproc_data *PPD){
 	buffer[1] = PPD->num_hom_var_gp;
 	buffer[2] = PPD->num_var_gp;
 
-	MPI_Bcast(buffer, 3, MPI_INT, 0, MPI_COMM_WORLD);
+	MPI_Bcast(buffer, 3, MPI_INT, root, comm);
 
 	int size = PPD->num_hom_var_gp + PPD->num_var_gp;
-	MPI_Bcast(PPD->type, size, MPI_INT, 0, MPI_COMM_WORLD);
-	MPI_Bcast(PPD->size, size, MPI_INT, 0, MPI_COMM_WORLD);
+	MPI_Bcast(PPD->type, size, MPI_INT, root, comm);
+	MPI_Bcast(PPD->size, size, MPI_INT, root, comm);
 
 	delete [] buffer;
 }
 
-void receive_preproc_data(preproc_data *PPD){
+void receive_preproc_data(preproc_data *PPD, int root, MPI_Comm comm){
 
 
 	int *buffer = new int[3];
 
-	MPI_Bcast(buffer, 3, MPI_INT, 0, MPI_COMM_WORLD);
+	MPI_Bcast(buffer, 3, MPI_INT, root, comm);
 
 	PPD->num_funcs = buffer[0];
 	PPD->num_hom_var_gp = buffer[1];
@@ -1646,8 +1645,8 @@ void receive_preproc_data(preproc_data *PPD){
 
 	PPD->type = (int *) br_malloc(num_groups * sizeof(int));
 	PPD->size = (int *) br_malloc(num_groups * sizeof(int));
-	MPI_Bcast(PPD->type, num_groups, MPI_INT, 0, MPI_COMM_WORLD);
-	MPI_Bcast(PPD->size, num_groups, MPI_INT, 0, MPI_COMM_WORLD);
+	MPI_Bcast(PPD->type, num_groups, MPI_INT, root, comm);
+	MPI_Bcast(PPD->size, num_groups, MPI_INT, root, comm);
 
 	delete [] buffer;
 }
@@ -1662,7 +1661,7 @@ void receive_preproc_data(preproc_data *PPD){
 
 
 
-void send_mat_d(const mat_d A, int target)
+void send_mat_d(const mat_d A, int target, MPI_Comm comm)
 {
     int num_entries;
     MPI_Datatype mpi_mat_d_int, mpi_comp_d;
@@ -1678,9 +1677,9 @@ void send_mat_d(const mat_d A, int target)
     num_entries = A->rows * A->cols;
 
     // send A_int
-    MPI_Send(&A_int, 1, mpi_mat_d_int, target, MAT_D, MPI_COMM_WORLD);
+    MPI_Send(&A_int, 1, mpi_mat_d_int, target, MAT_D, comm);
     // send entries
-    MPI_Send(entries, num_entries, mpi_comp_d, target, MAT_D, MPI_COMM_WORLD);
+    MPI_Send(entries, num_entries, mpi_comp_d, target, MAT_D, comm);
 
     // clear entries
     free(entries);
@@ -1692,7 +1691,7 @@ void send_mat_d(const mat_d A, int target)
 
     return;
 }
-void receive_mat_d(mat_d A, int source)
+void receive_mat_d(mat_d A, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     int num_entries;
@@ -1705,14 +1704,14 @@ void receive_mat_d(mat_d A, int source)
     create_comp_d(&mpi_comp_d);
 
     // recv A_int
-    MPI_Recv(&A_int, 1, mpi_mat_d_int, source, MAT_D, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&A_int, 1, mpi_mat_d_int, source, MAT_D, comm, &statty_mc_gatty);
     // setup A and entries
     init_mat_d(A, A_int.rows, A_int.cols);
 
     num_entries = A_int.rows * A_int.cols;
     entries = (comp_d *)bmalloc(num_entries * sizeof(comp_d));
     // recv entries
-    MPI_Recv(entries, num_entries, mpi_comp_d, source, MAT_D, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(entries, num_entries, mpi_comp_d, source, MAT_D, comm, &statty_mc_gatty);
 
     // setup A
     cp_mat_d_int(A, &A_int, &entries, 1);
@@ -1727,7 +1726,7 @@ void receive_mat_d(mat_d A, int source)
 
 
 
-void send_mat_mp(const mat_mp A, int target)
+void send_mat_mp(const mat_mp A, int target, MPI_Comm comm)
 {
     MPI_Datatype mpi_mat_mp_int;
     mat_mp_int A_int;
@@ -1740,8 +1739,8 @@ void send_mat_mp(const mat_mp A, int target)
     cp_mat_mp_int(&A_int, const_cast<_mat_mp*>(A), &Astr, 1, 0);
 
     // send A_int and Astr
-    MPI_Send(&A_int, 1, mpi_mat_mp_int, target, MAT_MP, MPI_COMM_WORLD);
-    MPI_Send(Astr, A_int.totalLength, MPI_CHAR, target, MAT_MP, MPI_COMM_WORLD);
+    MPI_Send(&A_int, 1, mpi_mat_mp_int, target, MAT_MP, comm);
+    MPI_Send(Astr, A_int.totalLength, MPI_CHAR, target, MAT_MP, comm);
 
     // clear Astr
     free(Astr);
@@ -1752,7 +1751,7 @@ void send_mat_mp(const mat_mp A, int target)
 
     return;
 }
-void receive_mat_mp(mat_mp A, int source)
+void receive_mat_mp(mat_mp A, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     MPI_Datatype mpi_mat_mp_int;
@@ -1763,9 +1762,9 @@ void receive_mat_mp(mat_mp A, int source)
     create_mat_mp_int(&mpi_mat_mp_int);
 
     // recv A_int and Astr
-    MPI_Recv(&A_int, 1, mpi_mat_mp_int, source, MAT_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&A_int, 1, mpi_mat_mp_int, source, MAT_MP, comm, &statty_mc_gatty);
     Astr = (char *)bmalloc(A_int.totalLength * sizeof(char));
-    MPI_Recv(Astr, A_int.totalLength, MPI_CHAR, source, MAT_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(Astr, A_int.totalLength, MPI_CHAR, source, MAT_MP, comm, &statty_mc_gatty);
 
     // setup A and clear Astr
     cp_mat_mp_int(A, &A_int, &Astr, 1, 1);
@@ -1781,7 +1780,7 @@ void receive_mat_mp(mat_mp A, int source)
 
 
 
-void send_mat_rat(const mat_d A_d, const mat_mp A_mp, const mpq_t ***A_rat, int target)
+void send_mat_rat(const mat_d A_d, const mat_mp A_mp, const mpq_t ***A_rat, int target, MPI_Comm comm)
 {
     MPI_Datatype mpi_mat_rat;
     mat_rat_int A_int;
@@ -1797,8 +1796,8 @@ void send_mat_rat(const mat_d A_d, const mat_mp A_mp, const mpq_t ***A_rat, int
     cp_mat_rat_int(&A_int, A_rat, &ratStr, rows, cols, 1, 0);
 
     // send A_int & ratStr
-    MPI_Send(&A_int, 1, mpi_mat_rat, target, MAT_RAT, MPI_COMM_WORLD);
-    MPI_Send(ratStr, A_int.totalLength, MPI_CHAR, target, MAT_RAT, MPI_COMM_WORLD);
+    MPI_Send(&A_int, 1, mpi_mat_rat, target, MAT_RAT, comm);
+    MPI_Send(ratStr, A_int.totalLength, MPI_CHAR, target, MAT_RAT, comm);
 
     // clear ratStr
     free(ratStr);
@@ -1809,7 +1808,7 @@ void send_mat_rat(const mat_d A_d, const mat_mp A_mp, const mpq_t ***A_rat, int
 
     return;
 }
-void receive_mat_rat(mat_d A_d, mat_mp A_mp, mpq_t ***A_rat, int source)
+void receive_mat_rat(mat_d A_d, mat_mp A_mp, mpq_t ***A_rat, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     MPI_Datatype mpi_mat_rat;
@@ -1821,9 +1820,9 @@ void receive_mat_rat(mat_d A_d, mat_mp A_mp, mpq_t ***A_rat, int source)
     create_mat_rat_int(&mpi_mat_rat);
 
     // recv A_int & ratStr
-    MPI_Recv(&A_int, 1, mpi_mat_rat, source, MAT_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&A_int, 1, mpi_mat_rat, source, MAT_RAT, comm, &statty_mc_gatty);
     ratStr = (char *)bmalloc(A_int.totalLength * sizeof(char));
-    MPI_Recv(ratStr, A_int.totalLength, MPI_CHAR, source, MAT_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(ratStr, A_int.totalLength, MPI_CHAR, source, MAT_RAT, comm, &statty_mc_gatty);
 
     // setup A_rat and clear ratStr
     cp_mat_rat_int(A_rat, &A_int, &ratStr, A_int.rows, A_int.cols, 1, 1);
@@ -1848,7 +1847,7 @@ void receive_mat_rat(mat_d A_d, mat_mp A_mp, mpq_t ***A_rat, int source)
 
 
 
-void send_vec_d(const vec_d b, int target)
+void send_vec_d(const vec_d b, int target, MPI_Comm comm)
 {
     MPI_Datatype mpi_point_d_int, mpi_comp_d;
     point_d_int b_int;
@@ -1862,9 +1861,9 @@ void send_vec_d(const vec_d b, int target)
     cp_point_d_int(&b_int, const_cast<_point_d*>(b), &entries, 0, 0, 0);
 
     // send b_int
-    MPI_Send(&b_int, 1, mpi_point_d_int, target, VEC_D, MPI_COMM_WORLD);
+    MPI_Send(&b_int, 1, mpi_point_d_int, target, VEC_D, comm);
     // send entries
-    MPI_Send(entries, b_int.size, mpi_comp_d, target, VEC_D, MPI_COMM_WORLD);
+    MPI_Send(entries, b_int.size, mpi_comp_d, target, VEC_D, comm);
 
     // clear entries
     free(entries);
@@ -1876,7 +1875,7 @@ void send_vec_d(const vec_d b, int target)
 
     return;
 }
-void receive_vec_d(vec_d b, int source)
+void receive_vec_d(vec_d b, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     MPI_Datatype mpi_point_d_int, mpi_comp_d;
@@ -1888,11 +1887,11 @@ void receive_vec_d(vec_d b, int source)
     create_comp_d(&mpi_comp_d);
 
     // recv b_int
-    MPI_Recv(&b_int, 1, mpi_point_d_int, source, VEC_D, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&b_int, 1, mpi_point_d_int, source, VEC_D, comm, &statty_mc_gatty);
 
     entries = (comp_d *)bmalloc(b_int.size * sizeof(comp_d));
     // recv entries
-    MPI_Recv(entries, b_int.size, mpi_comp_d, source, VEC_D, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(entries, b_int.size, mpi_comp_d, source, VEC_D, comm, &statty_mc_gatty);
 
     // setup b
     cp_point_d_int(b, &b_int, &entries, 1, 0, 1);
@@ -1908,7 +1907,7 @@ void receive_vec_d(vec_d b, int source)
 
 
 
-void send_vec_mp(const vec_mp b, int target)
+void send_vec_mp(const vec_mp b, int target, MPI_Comm comm)
 {
     MPI_Datatype mpi_vec_mp_int;
     point_mp_int b_int;
@@ -1921,8 +1920,8 @@ void send_vec_mp(const vec_mp b, int target)
     cp_point_mp_int(&b_int, const_cast<_point_mp*>(b), &bstr, 0, 0, 0);
 
     // send b_int and bstr
-    MPI_Send(&b_int, 1, mpi_vec_mp_int, target, VEC_MP, MPI_COMM_WORLD);
-    MPI_Send(bstr, b_int.totalLength, MPI_CHAR, target, VEC_MP, MPI_COMM_WORLD);
+    MPI_Send(&b_int, 1, mpi_vec_mp_int, target, VEC_MP, comm);
+    MPI_Send(bstr, b_int.totalLength, MPI_CHAR, target, VEC_MP, comm);
 
     // clear bstr
     free(bstr);
@@ -1933,7 +1932,7 @@ void send_vec_mp(const vec_mp b, int target)
 
     return;
 }
-void receive_vec_mp(vec_mp b, int source)
+void receive_vec_mp(vec_mp b, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     MPI_Datatype mpi_vec_mp_int;
@@ -1944,9 +1943,9 @@ void receive_vec_mp(vec_mp b, int source)
     create_point_mp_int(&mpi_vec_mp_int);
 
     // recv b_int and bstr
-    MPI_Recv(&b_int, 1, mpi_vec_mp_int, source, VEC_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&b_int, 1, mpi_vec_mp_int, source, VEC_MP, comm, &statty_mc_gatty);
     bstr = (char *)bmalloc(b_int.totalLength * sizeof(char));
-    MPI_Recv(bstr, b_int.totalLength, MPI_CHAR, source, VEC_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(bstr, b_int.totalLength, MPI_CHAR, source, VEC_MP, comm, &statty_mc_gatty);
 
     // setup b and clear bstr
     cp_point_mp_int(b, &b_int, &bstr, 1, 0, 1); // first 1 indicates to free bstr.  second is init_point.  third is intype.  see doc in copy_functions.c
@@ -1962,7 +1961,7 @@ void receive_vec_mp(vec_mp b, int source)
 
 
 
-void send_vec_rat(const mpq_t ***b, int size, int target)
+void send_vec_rat(const mpq_t ***b, int size, int target, MPI_Comm comm)
 {
     MPI_Datatype mpi_point_rat;
     point_rat_int b_int;
@@ -1976,10 +1975,10 @@ void send_vec_rat(const mpq_t ***b, int size, int target)
     cp_vec_rat_char(&ratStr, b, &b_int.totalLength, size, 0, 0);
 
     // send b_int
-    MPI_Send(&b_int, 1, mpi_point_rat, target, VEC_RAT, MPI_COMM_WORLD);
+    MPI_Send(&b_int, 1, mpi_point_rat, target, VEC_RAT, comm);
 
     // send ratStr
-    MPI_Send(ratStr, b_int.totalLength, MPI_CHAR, target, VEC_RAT, MPI_COMM_WORLD);
+    MPI_Send(ratStr, b_int.totalLength, MPI_CHAR, target, VEC_RAT, comm);
 
     // clear ratStr
     free(ratStr);
@@ -1990,7 +1989,7 @@ void send_vec_rat(const mpq_t ***b, int size, int target)
 
     return;
 }
-void receive_vec_rat(mpq_t ***b, int size, int source)
+void receive_vec_rat(mpq_t ***b, int size, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     MPI_Datatype mpi_point_rat;
@@ -2001,11 +2000,11 @@ void receive_vec_rat(mpq_t ***b, int size, int source)
     create_point_rat_int(&mpi_point_rat);
 
     // recv b_int
-    MPI_Recv(&b_int, 1, mpi_point_rat, source, VEC_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&b_int, 1, mpi_point_rat, source, VEC_RAT, comm, &statty_mc_gatty);
 
     // setup & recv ratStr
     ratStr = (char *)bmalloc(b_int.totalLength * sizeof(char));
-    MPI_Recv(ratStr, b_int.totalLength, MPI_CHAR, source, VEC_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(ratStr, b_int.totalLength, MPI_CHAR, source, VEC_RAT, comm, &statty_mc_gatty);
 
     // setup b - clears all structures
     cp_vec_rat_char(b, &ratStr, &b_int.totalLength, b_int.size, 1, 1);
@@ -2027,24 +2026,24 @@ void receive_vec_rat(mpq_t ***b, int size, int source)
 
 
 
-void send_comp_d(const comp_d c, int target)
+void send_comp_d(const comp_d c, int target, MPI_Comm comm)
 {
     MPI_Datatype mpi_comp_d;
     create_comp_d(&mpi_comp_d);
 
-    MPI_Send(c, 1, mpi_comp_d, target, COMP_D, MPI_COMM_WORLD);
+    MPI_Send(c, 1, mpi_comp_d, target, COMP_D, comm);
 
     MPI_Type_free(&mpi_comp_d);
 
     return;
 }
-void receive_comp_d(comp_d c, int source)
+void receive_comp_d(comp_d c, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     MPI_Datatype mpi_comp_d;
     create_comp_d(&mpi_comp_d);
 
-    MPI_Recv(c, 1, mpi_comp_d, source, COMP_D, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(c, 1, mpi_comp_d, source, COMP_D, comm, &statty_mc_gatty);
 
     MPI_Type_free(&mpi_comp_d);
 
@@ -2054,24 +2053,24 @@ void receive_comp_d(comp_d c, int source)
 
 
 
-void send_comp_num_d(const comp_d *c, int num, int target)
+void send_comp_num_d(const comp_d *c, int num, int target, MPI_Comm comm)
 {
     MPI_Datatype mpi_comp_d;
     create_comp_d(&mpi_comp_d);
 
-    MPI_Send(c, num, mpi_comp_d, target, COMP_D, MPI_COMM_WORLD);
+    MPI_Send(c, num, mpi_comp_d, target, COMP_D, comm);
 
     MPI_Type_free(&mpi_comp_d);
 
     return;
 }
-void receive_comp_num_d(comp_d *c, int num, int source)
+void receive_comp_num_d(comp_d *c, int num, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     MPI_Datatype mpi_comp_d;
     create_comp_d(&mpi_comp_d);
 
-    MPI_Recv(c, num, mpi_comp_d, source, COMP_D, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(c, num, mpi_comp_d, source, COMP_D, comm, &statty_mc_gatty);
 
     MPI_Type_free(&mpi_comp_d);
 
@@ -2081,7 +2080,7 @@ void receive_comp_num_d(comp_d *c, int num, int source)
 
 
 
-void send_comp_mp(const comp_mp c, int target)
+void send_comp_mp(const comp_mp c, int target, MPI_Comm comm)
 {
     char *str = NULL;
     comp_mp_int c_int;
@@ -2091,9 +2090,9 @@ void send_comp_mp(const comp_mp c, int target)
     // send data
     cp_comp_mp_int(&c_int, const_cast<_comp_mp*>(c), &str, 0, 0);
     // send c_int
-    MPI_Send(&c_int, 1, mpi_comp_mp_int, target, COMP_MP, MPI_COMM_WORLD);
+    MPI_Send(&c_int, 1, mpi_comp_mp_int, target, COMP_MP, comm);
     // send str
-    MPI_Send(str, c_int.totalLength, MPI_CHAR, target, COMP_MP, MPI_COMM_WORLD);
+    MPI_Send(str, c_int.totalLength, MPI_CHAR, target, COMP_MP, comm);
 
     // clear str
     free(str);
@@ -2103,7 +2102,7 @@ void send_comp_mp(const comp_mp c, int target)
 
     return;
 }
-void receive_comp_mp(comp_mp c, int source)
+void receive_comp_mp(comp_mp c, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     char *str = NULL;
@@ -2112,10 +2111,10 @@ void receive_comp_mp(comp_mp c, int source)
     create_comp_mp_int(&mpi_comp_mp_int);
 
     // recv data
-    MPI_Recv(&c_int, 1, mpi_comp_mp_int, source, COMP_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&c_int, 1, mpi_comp_mp_int, source, COMP_MP, comm, &statty_mc_gatty);
     // setup & recv str
     str = (char *)bmalloc(c_int.totalLength * sizeof(char));
-    MPI_Recv(str, c_int.totalLength, MPI_CHAR, source, COMP_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(str, c_int.totalLength, MPI_CHAR, source, COMP_MP, comm, &statty_mc_gatty);
 
     // setup c
     cp_comp_mp_int(c, &c_int, &str, 1, 1);
@@ -2130,7 +2129,7 @@ void receive_comp_mp(comp_mp c, int source)
 
 
 
-void send_comp_num_mp(const comp_mp *c, int num, int target)
+void send_comp_num_mp(const comp_mp *c, int num, int target, MPI_Comm comm)
 {
     int i, j, total = 0, currLoc = 0;
     comp_mp_int *c_int = (comp_mp_int *)bmalloc(num * sizeof(comp_mp_int));
@@ -2153,9 +2152,9 @@ void send_comp_num_mp(const comp_mp *c, int num, int target)
         free(tempStr);
     }
     // send c_int
-    MPI_Send(c_int, num, mpi_comp_mp_int, target, COMP_MP, MPI_COMM_WORLD);
+    MPI_Send(c_int, num, mpi_comp_mp_int, target, COMP_MP, comm);
     // send str
-    MPI_Send(str, total, MPI_CHAR, target, COMP_MP, MPI_COMM_WORLD);
+    MPI_Send(str, total, MPI_CHAR, target, COMP_MP, comm);
 
     // clear data
     free(str);
@@ -2168,7 +2167,7 @@ void send_comp_num_mp(const comp_mp *c, int num, int target)
 
     return;
 }
-void receive_comp_num_mp(comp_mp *c, int num, int source)
+void receive_comp_num_mp(comp_mp *c, int num, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     int i, total = 0, currLoc = 0;
@@ -2178,12 +2177,12 @@ void receive_comp_num_mp(comp_mp *c, int num, int source)
     create_comp_mp_int(&mpi_comp_mp_int);
 
     // recv data
-    MPI_Recv(c_int, num, mpi_comp_mp_int, source, COMP_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(c_int, num, mpi_comp_mp_int, source, COMP_MP, comm, &statty_mc_gatty);
     // setup & recv str
     for (i = 0; i < num; i++)
         total += c_int[i].totalLength;
     str = (char *)bmalloc(total * sizeof(char));
-    MPI_Recv(str, total, MPI_CHAR, source, COMP_MP, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(str, total, MPI_CHAR, source, COMP_MP, comm, &statty_mc_gatty);
 
     // setup c
     for (i = 0; i < num; i++)
@@ -2212,7 +2211,7 @@ void receive_comp_num_mp(comp_mp *c, int num, int source)
 
 
 
-void send_comp_rat(const mpq_t c[2], int target)
+void send_comp_rat(const mpq_t c[2], int target, MPI_Comm comm)
 {
     comp_rat_int c_int;
     char *str = NULL;
@@ -2222,9 +2221,9 @@ void send_comp_rat(const mpq_t c[2], int target)
     // send data
     cp_comp_rat_int(&c_int, const_cast<mpq_t*>(c), &str, 0, 0);
     // send c_int
-    MPI_Send(&c_int, 1, mpi_comp_rat_int, target, COMP_RAT, MPI_COMM_WORLD);
+    MPI_Send(&c_int, 1, mpi_comp_rat_int, target, COMP_RAT, comm);
     // send str
-    MPI_Send(str, c_int.length[0] + c_int.length[1], MPI_CHAR, target, COMP_RAT, MPI_COMM_WORLD);
+    MPI_Send(str, c_int.length[0] + c_int.length[1], MPI_CHAR, target, COMP_RAT, comm);
 
     // clear str
     free(str);
@@ -2233,7 +2232,7 @@ void send_comp_rat(const mpq_t c[2], int target)
     MPI_Type_free(&mpi_comp_rat_int);
 
     return;}
-void receive_comp_rat(mpq_t c[2], int source)
+void receive_comp_rat(mpq_t c[2], int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     comp_rat_int c_int;
@@ -2242,10 +2241,10 @@ void receive_comp_rat(mpq_t c[2], int source)
     create_comp_rat_int(&mpi_comp_rat_int);
 
     // recv data
-    MPI_Recv(&c_int, 1, mpi_comp_rat_int, source, COMP_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(&c_int, 1, mpi_comp_rat_int, source, COMP_RAT, comm, &statty_mc_gatty);
     // setup & recv str
     str = (char *)bmalloc((c_int.length[0] + c_int.length[1]) * sizeof(char));
-    MPI_Recv(str, c_int.length[0] + c_int.length[1], MPI_CHAR, source, COMP_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(str, c_int.length[0] + c_int.length[1], MPI_CHAR, source, COMP_RAT, comm, &statty_mc_gatty);
 
     // setup c
     cp_comp_rat_int(c, &c_int, &str, 1, 1);
@@ -2264,7 +2263,7 @@ void receive_comp_rat(mpq_t c[2], int source)
 
 
 
-void send_comp_num_rat(const mpq_t c[][2], int num, int target)
+void send_comp_num_rat(const mpq_t c[][2], int num, int target, MPI_Comm comm)
 {
     int i, j, total = 0, currLoc = 0;
     comp_rat_int *c_int = (comp_rat_int *)bmalloc(num * sizeof(comp_rat_int));
@@ -2287,9 +2286,9 @@ void send_comp_num_rat(const mpq_t c[][2], int num, int target)
         free(tempStr);
     }
     // send c_int
-    MPI_Send(c_int, num, mpi_comp_rat_int, target, COMP_RAT, MPI_COMM_WORLD);
+    MPI_Send(c_int, num, mpi_comp_rat_int, target, COMP_RAT, comm);
     // send str
-    MPI_Send(str, total, MPI_CHAR, target, COMP_RAT, MPI_COMM_WORLD);
+    MPI_Send(str, total, MPI_CHAR, target, COMP_RAT, comm);
 
     // clear str
     free(str);
@@ -2298,7 +2297,7 @@ void send_comp_num_rat(const mpq_t c[][2], int num, int target)
 
     return;
 }
-void receive_comp_num_rat(mpq_t c[][2], int num, int source)
+void receive_comp_num_rat(mpq_t c[][2], int num, int source, MPI_Comm comm)
 {
     MPI_Status statty_mc_gatty;
     int i, total = 0, currLoc = 0;
@@ -2308,12 +2307,12 @@ void receive_comp_num_rat(mpq_t c[][2], int num, int source)
     create_comp_rat_int(&mpi_comp_rat_int);
 
     // recv data
-    MPI_Recv(c_int, num, mpi_comp_rat_int, source, COMP_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(c_int, num, mpi_comp_rat_int, source, COMP_RAT, comm, &statty_mc_gatty);
     // setup & recv str
     for (i = 0; i < num; i++)
         total += c_int[i].length[0] + c_int[i].length[1];
     str = (char *)bmalloc(total * sizeof(char));
-    MPI_Recv(str, total, MPI_CHAR, source, COMP_RAT, MPI_COMM_WORLD, &statty_mc_gatty);
+    MPI_Recv(str, total, MPI_CHAR, source, COMP_RAT, comm, &statty_mc_gatty);
 
     // setup c
     for (i = 0; i < num; i++)
@@ -2371,3 +2370,119 @@ int compare_integers_increasing(const void * left_in, const void * right_in)
 	}
 
 }
+
+
+
+
+
+
+
+
+
+// mpf_t is mpfr_t here, by way of mpf2mpfr.h, so the mpfr calls below are operating on the very same objects.
+namespace {
+	enum {RAW_MP_ZERO = 0, RAW_MP_REGULAR, RAW_MP_NAN, RAW_MP_INF};
+}
+
+void write_mp_raw(FILE *OUT, const mpf_t x)
+{
+	mpfr_ptr y = const_cast<mpfr_ptr>(x);
+
+	int32_t kind;
+	if (mpfr_nan_p(y))
+		kind = RAW_MP_NAN;
+	else if (mpfr_inf_p(y))
+		kind = RAW_MP_INF * mpfr_sgn(y);
+	else if (mpfr_zero_p(y))
+		kind = RAW_MP_ZERO;
+	else
+		kind = RAW_MP_REGULAR;
+
+	fwrite(&kind, sizeof(int32_t), 1, OUT);
+
+	if (kind!=RAW_MP_REGULAR)
+		return;
+
+	mpz_t mantissa;  mpz_init(mantissa);
+	int64_t exponent = mpfr_get_z_2exp(mantissa, y);
+
+	fwrite(&exponent, sizeof(int64_t), 1, OUT);
+	mpz_out_raw(OUT, mantissa);
+
+	mpz_clear(mantissa);
+}
+
+
+void read_mp_raw(mpf_t x, FILE *IN)
+{
+	int32_t kind;
+	if (fread(&kind, sizeof(int32_t), 1, IN)!=1)
+		throw std::runtime_error("premature end of file reading raw mp number");
+
+	switch (kind)
+	{
+		case RAW_MP_ZERO:
+			mpfr_set_zero(x, 1);
+			return;
+		case RAW_MP_NAN:
+			mpfr_set_nan(x);
+			return;
+		case RAW_MP_INF:
+		case -RAW_MP_INF:
+			mpfr_set_inf(x, kind);
+			return;
+		default:
+			break;
+	}
+
+	int64_t exponent;
+	if (fread(&exponent, sizeof(int64_t), 1, IN)!=1)
+		throw std::runtime_error("premature end of file reading raw mp number");
+
+	mpz_t mantissa;  mpz_init(mantissa);
+	if (mpz_inp_raw(mantissa, IN)==0)
+	{
+		mpz_clear(mantissa);
+		throw std::runtime_error("premature end of file reading raw mp number");
+	}
+
+	mpfr_set_z_2exp(x, mantissa, exponent, MPFR_RNDN);
+
+	mpz_clear(mantissa);
+}
+
+
+void write_comp_mp_raw(FILE *OUT, const comp_mp c)
+{
+	write_mp_raw(OUT, c->r);
+	write_mp_raw(OUT, c->i);
+}
+
+void read_comp_mp_raw(comp_mp c, FILE *IN)
+{
+	read_mp_raw(c->r, IN);
+	read_mp_raw(c->i, IN);
+}
+
+
+void write_vec_mp_raw(FILE *OUT, const vec_mp v)
+{
+	int32_t size = v->size;
+	fwrite(&size, sizeof(int32_t), 1, OUT);
+	for (int ii=0; ii<size; ii++)
+		write_comp_mp_raw(OUT, &v->coord[ii]);
+}
+
+void read_vec_mp_raw(vec_mp v, FILE *IN)
+{
+	int32_t size;
+	if (fread(&size, sizeof(int32_t), 1, IN)!=1)
+		throw std::runtime_error("premature end of file reading raw mp vector");
+
+	if (v->size!=size) {
+		change_size_vec_mp(v, size);  v->size = size;
+	}
+
+	for (int ii=0; ii<size; ii++)
+		read_comp_mp_raw(&v->coord[ii], IN);
+}
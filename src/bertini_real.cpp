@@ -19,15 +19,47 @@ int main(int argC, char *args[])
 
 	//instantiate options
 	BertiniRealConfig program_options;
-	SolverConfiguration solve_options;
-	int MPType;
 
 
 	program_options.parse_commandline(argC, args); // everybody gets to parse the command line.
 
 
+	if (!program_options.serve_queue().empty())
+	{
+		JobService service(program_options.serve_queue(), program_options);
+
+		// each job's options are made afresh, in the job's folder, from the job's command line.
+		service.Add("bertini_real", [](int argc, char **argv){
+			BertiniRealConfig job_options;
+			job_options.parse_commandline(argc, argv);
+			return RunDecomposition(job_options);
+		});
+		service.Add("sampler", [](int argc, char **argv){
+			sampler_configuration job_options;
+			job_options.parse_commandline(argc, argv);
+			return RunSampler(job_options);
+		});
+
+		service.Serve();
+	}
+	else
+		RunDecomposition(program_options);
+
+
+	MPI_Finalize();
 
 
+	return 0;
+}
+
+
+
+
+int RunDecomposition(BertiniRealConfig & program_options)
+{
+	SolverConfiguration solve_options;
+	int MPType;
+
 
 
 	if (program_options.debugwait()) {
@@ -51,35 +83,67 @@ int main(int argC, char *args[])
 
 
 
+	// a sweep writes the witness data and input file of each step, which must not replace the run's own.
+	if (!program_options.sweep_filename().empty() && program_options.scratch_base().empty())
+		program_options.scratch_base(program_options.called_dir());
+
+	program_options.move_to_temp({"witness_data"}); // everybody moves into the workspace.  bertini_real's own files, and the parser's, go there.
+
+
 	int seed;
+	int setup_failed = 0;
 	if (solve_options.is_head()) {
-		// split the input_file.  this must be called before setting up the solver config.
-		seed = parse_input_file(program_options.input_filename(), &MPType);
+		try{
+			// split the input_file.  this must be called before setting up the solver config.
+			seed = parse_input_file(program_options.input_filename(), &MPType);
 
-		// set up the solver configuration
-		get_tracker_config(solve_options,MPType);
+			// set up the solver configuration
+			get_tracker_config(solve_options,MPType);
 
-		solve_options.T.ratioTol = 0.9999999999999999999999999; // manually assert to be more permissive.  i don't really like this.
-	}
-	else
-	{ // catch the bcast from parallel parsing (which cannot be disabled)
-		MPI_Bcast(&seed,1,MPI_INT,0,MPI_COMM_WORLD); // first is declaration that a parse is going to happen.
-		int arbitrary_int;
-		MPI_Bcast(&arbitrary_int,1,MPI_INT,0,MPI_COMM_WORLD); // second is the bcast from the parse.
-															  //yes, you do have to do both of these.
+			solve_options.T.ratioTol = 0.9999999999999999999999999; // manually assert to be more permissive.  i don't really like this.
+		}
+		catch (std::exception &e)
+		{
+			std::cout << "unable to set up the decomposition;" << std::endl;
+			std::cout << e.what() << std::endl;
+			setup_failed = 1;
+		}
 	}
 
+	// the workers wait on the head's setup, catching its parse, and are told if it failed, rather than left waiting for a seed which will not come.
+	if (solve_options.use_parallel())
+	{
+		if (solve_options.is_head())
+			MPI_Bcast(&setup_failed, 1, MPI_INT, solve_options.head(), solve_options.comm());
+		else
+		{
+			int code;
+			do {
+				MPI_Bcast(&code, 1, MPI_INT, solve_options.head(), solve_options.comm());
+				if (code==PARSING)
+					CatchParse();
+			} while (code==PARSING);
+			setup_failed = code;
+		}
+	}
 
-	// seed the random number generator
-  	srand(seed);
+	if (setup_failed) {
+		program_options.move_to_called({"Dir_Name", "most_recent_pi"});
+		return 1;
+	}
 
 
 	if (solve_options.use_parallel()) { // everybody participates in this.
-		MPI_Bcast(&solve_options.path_number_modulus,1,MPI_INT,0,MPI_COMM_WORLD);
+		MPI_Bcast(&seed,1,MPI_INT,solve_options.head(),solve_options.comm());
+		MPI_Bcast(&solve_options.path_number_modulus,1,MPI_INT,solve_options.head(),solve_options.comm());
 		bcast_tracker_config_t(&solve_options.T, solve_options.id(), solve_options.head() );
 	}
 
 
+	// seed the random number generator
+  	srand(seed);
+
+
 	initMP(solve_options.T.Precision); // set up some globals.
 
 
@@ -87,57 +151,62 @@ int main(int argC, char *args[])
 	solve_options.verbose_level(program_options.verbose_level());
 	solve_options.use_gamma_trick = program_options.use_gamma_trick();
 	solve_options.robust = program_options.robustness()>=1;
+	solve_options.batch_size = program_options.batch_size();
+	solve_options.path_telemetry = program_options.path_telemetry();
 
 
 
+	int result = SUCCESSFUL;
 	if (solve_options.is_head()) {
 		UbermasterProcess current_process(program_options, solve_options);
 
 		try{
-			current_process.main_loop();
+			result = current_process.main_loop();
 		}
 		catch (std::runtime_error &e)
 		{
 			std::cout << "uncaught runtime exception from ubermaster process caught in bertini_real;" << std::endl;
 			std::cout << e.what() << std::endl;
+			result = 1;
 		}
 		catch (std::logic_error &e)
 		{
 			std::cout << "uncaught logic exception from ubermaster process caught in bertini_real;" << std::endl;
 			std::cout << e.what() << std::endl;
+			result = 1;
 		}
 		catch (std::exception &e){
 			std::cout << "uncaught other exception from ubermaster process caught in bertini_real;" << std::endl;
 			std::cout << e.what() << std::endl;
+			result = 1;
 		}
+
+		current_process.finish(result==SUCCESSFUL); // the workers are let go even if the decomposition failed.
 	}
 	else{
 		WorkerProcess current_process(program_options, solve_options);
 
+		// a worker which throws has left the head waiting on it, in the middle of a solve, and the two cannot be brought back into step.  abort the run, rather than leave every process hanging.
 		try{
 			current_process.main_loop();
 		}
-		catch (std::runtime_error& e)
-		{
-			std::cout << "uncaught runtime exception from ubermaster process caught in bertini_real;" << std::endl;
-			std::cout << e.what() << std::endl;
-		}
-		catch (std::logic_error& e)
-		{
-			std::cout << "uncaught logic exception from ubermaster process caught in bertini_real;" << std::endl;
-			std::cout << e.what() << std::endl;
-		}
 		catch (std::exception& e){
-			std::cout << "uncaught other exception from worker process caught in bertini_real;" << std::endl;
+			std::cout << "uncaught exception from worker process " << solve_options.id() << " caught in bertini_real, aborting;" << std::endl;
 			std::cout << e.what() << std::endl;
+			solve_options.abort(1);
 		}
+
+		RunProfile::Instance().Finish(solve_options.comm(), solve_options.head());
 	}
 
+	// every process returns the same status, so that a JobService agrees on whether the job failed.
+	if (solve_options.use_parallel())
+		MPI_Allreduce(MPI_IN_PLACE, &result, 1, MPI_INT, MPI_MAX, solve_options.comm());
 
-	clearMP();
 
-	MPI_Finalize();
+	program_options.move_to_called({"Dir_Name", "most_recent_pi"});
 
+	clearMP();
 
-	return 0;
+	return result;
 }
@@ -66,8 +66,8 @@ void Face::send(int target, ParallelismConfig & mpi_config) const
 	delete [] charbuff;
 
 
-	send_comp_mp(left_crit_val_, target);
-	send_comp_mp(right_crit_val_, target);
+	send_comp_mp(left_crit_val_, target, mpi_config.comm());
+	send_comp_mp(right_crit_val_, target, mpi_config.comm());
 
 
 	return;
@@ -149,8 +149,8 @@ void Face::receive(int source, ParallelismConfig & mpi_config)
 	delete [] charbuff;
 
 
-	receive_comp_mp(left_crit_val_,source);
-	receive_comp_mp(right_crit_val_,source);
+	receive_comp_mp(left_crit_val_,source, mpi_config.comm());
+	receive_comp_mp(right_crit_val_,source, mpi_config.comm());
 
 	return;
 
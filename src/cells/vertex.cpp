@@ -12,9 +12,9 @@ void Vertex::set_point(const vec_mp new_point)
 void Vertex::send(int target, ParallelismConfig & mpi_config) const
 {
 
-	send_vec_mp(pt_mp_, target);
+	send_vec_mp(pt_mp_, target, mpi_config.comm());
 
-	send_vec_mp(projection_values_, target);
+	send_vec_mp(projection_values_, target, mpi_config.comm());
 
 	int * buffer = (int *) br_malloc(2*sizeof(int));
 	buffer[0] = type_;
@@ -32,8 +32,8 @@ void Vertex::receive(int source, ParallelismConfig & mpi_config)
 	int * buffer = (int *) br_malloc(2*sizeof(int));
 
 
-	receive_vec_mp(pt_mp_, source);
-	receive_vec_mp(projection_values_, source);
+	receive_vec_mp(pt_mp_, source, mpi_config.comm());
+	receive_vec_mp(projection_values_, source, mpi_config.comm());
 
 	MPI_Recv(buffer, 2, MPI_INT, source, VERTEX, mpi_config.comm(), &statty_mc_gatty);
 
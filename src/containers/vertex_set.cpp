@@ -330,6 +330,17 @@ int VertexSet::setup_vertices(boost::filesystem::path INfile)
 //setup the Vertex structure
 {
 	FILE *IN = safe_fopen_read(INfile);
+
+	int retval = setup_vertices(IN);
+
+	fclose(IN);
+
+	return retval;
+}
+
+
+int VertexSet::setup_vertices(FILE *IN)
+{
 	unsigned int temp_num_vertices;
 	int num_vars;
 	int tmp_num_projections;
@@ -401,8 +412,6 @@ int VertexSet::setup_vertices(boost::filesystem::path INfile)
 
 
 
-	fclose(IN);
-
 	if (this->num_vertices_!=temp_num_vertices) {
 		printf("parity error in num_vertices.\n\texpected: %zu\tactual: %u\n",num_vertices_,temp_num_vertices); // this is totally impossible.
 		br_exit(25943);
@@ -473,6 +482,116 @@ void VertexSet::print(boost::filesystem::path const& outputfile) const
 
 
 
+namespace {
+	const char kVertexBinaryMagic[8] = {'B','R','V','E','R','T','X','1'};
+
+	int32_t ReadInt32(FILE *IN)
+	{
+		int32_t val;
+		if (fread(&val, sizeof(int32_t), 1, IN)!=1)
+			throw std::runtime_error("premature end of binary vertex set");
+		return val;
+	}
+}
+
+
+void VertexSet::print_binary(boost::filesystem::path const& outputfile) const
+{
+	FILE *OUT = safe_fopen_write(outputfile);
+
+	fwrite(kVertexBinaryMagic, 1, sizeof(kVertexBinaryMagic), OUT);
+
+	uint64_t num_verts = num_vertices_;
+	int32_t header[3] = {num_projections_, num_natural_variables_, static_cast<int32_t>(filenames_.size())};
+	fwrite(&num_verts, sizeof(uint64_t), 1, OUT);
+	fwrite(header, sizeof(int32_t), 3, OUT);
+
+
+	for (int ii=0; ii<num_projections_; ii++) {
+		int init_size = projections_[ii]->size;
+		projections_[ii]->size = num_natural_variables_;
+		write_vec_mp_raw(OUT, projections_[ii]);
+		projections_[ii]->size = init_size;
+	}
+
+
+	for (unsigned int ii=0; ii!=filenames_.size(); ii++) {
+		std::string name = filenames_[ii].string();
+		int32_t strleng = name.size();
+		fwrite(&strleng, sizeof(int32_t), 1, OUT);
+		fwrite(name.c_str(), 1, strleng, OUT);
+	}
+
+
+	for (unsigned int ii = 0; ii < num_vertices_; ii++)
+	{
+		write_vec_mp_raw(OUT, vertices_[ii].get_point());
+		write_vec_mp_raw(OUT, vertices_[ii].projection_values());
+
+		int32_t tail[2] = {vertices_[ii].input_filename_index(), static_cast<int32_t>(vertices_[ii].type())};
+		fwrite(tail, sizeof(int32_t), 2, OUT);
+	}
+
+	fclose(OUT);
+}
+
+
+
+int VertexSet::setup_vertices_binary(FILE *IN)
+{
+	char magic[sizeof(kVertexBinaryMagic)];
+	if (fread(magic, 1, sizeof(magic), IN)!=sizeof(magic) || memcmp(magic, kVertexBinaryMagic, sizeof(magic))!=0)
+		throw std::runtime_error("file is not a binary vertex set");
+
+	uint64_t temp_num_vertices;
+	if (fread(&temp_num_vertices, sizeof(uint64_t), 1, IN)!=1)
+		throw std::runtime_error("premature end of binary vertex set");
+
+	int tmp_num_projections = ReadInt32(IN);
+	num_natural_variables_ = ReadInt32(IN);
+	int tmp_num_filenames = ReadInt32(IN);
+
+
+	vec_mp temp_vec; init_vec_mp2(temp_vec,num_natural_variables_,1024);
+	for (int ii=0; ii<tmp_num_projections; ii++) {
+		read_vec_mp_raw(temp_vec, IN);
+		add_projection(temp_vec);
+	}
+	clear_vec_mp(temp_vec);
+
+
+	for (int ii=0; ii<tmp_num_filenames; ii++) {
+		int32_t strleng = ReadInt32(IN);
+		std::string name(strleng, '\0');
+		if (strleng>0 && fread(&name[0], 1, strleng, IN)!=static_cast<size_t>(strleng))
+			throw std::runtime_error("premature end of binary vertex set");
+		this->filenames_.push_back(name);
+	}
+
+
+	Vertex temp_vertex;
+	for (uint64_t ii=0; ii<temp_num_vertices; ii++)
+	{
+		read_vec_mp_raw(temp_vertex.point(), IN);
+		read_vec_mp_raw(temp_vertex.projection_values(), IN);
+
+		temp_vertex.set_input_filename_index(ReadInt32(IN));
+		temp_vertex.set_type(static_cast<VertexType>(ReadInt32(IN)));
+
+		VertexSet::add_vertex(temp_vertex);
+	}
+
+
+	if (this->num_vertices_!=temp_num_vertices) {
+		printf("parity error in num_vertices.\n\texpected: %zu\tactual: %lu\n",num_vertices_,static_cast<unsigned long>(temp_num_vertices));
+		br_exit(25943);
+	}
+
+	return num_vertices_;
+}
+
+
+
 int VertexSet::set_curr_input(boost::filesystem::path const& el_nom)
 {
 
@@ -712,7 +831,7 @@ void VertexSet::send(int target, ParallelismConfig & mpi_config) const
 	delete [] buffer2;
 
 	for (int ii=0; ii<num_projections_; ii++) {
-		send_vec_mp(projections_[ii],target);
+		send_vec_mp(projections_[ii],target, mpi_config.comm());
 	}
 
 //	std::cout << "sending " << num_filenames << " filenames" << std::endl;
@@ -784,7 +903,7 @@ void VertexSet::receive(int source, ParallelismConfig & mpi_config)
 	for (int ii=0; ii<temp_num_projections; ii++) {
 //		std::cout << "recving " << ii << "th proj" << std::endl;
 		change_size_vec_mp(tempvec,buffer2[ii]); tempvec->size = buffer2[ii];
-		receive_vec_mp(tempvec,source);
+		receive_vec_mp(tempvec,source, mpi_config.comm());
 		add_projection(tempvec);
 //		print_point_to_screen_matlab(tempvec,"tempvec_recvd_proj");
 
@@ -13,9 +13,10 @@ void Curve::main(VertexSet & V,
 	std::cout << "curve::main" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("curve");
 
 	// perform an isosingular deflation
-	boost::filesystem::path temp_path = W_curve.input_filename();
+	boost::filesystem::path temp_path = W_curve.input_filename().filename(); // written in the workspace
 
 	std::stringstream converter;
 	converter << "_dim_" << W_curve.dimension() << "_comp_" << W_curve.component_number() << "_deflated";
@@ -26,13 +27,16 @@ void Curve::main(VertexSet & V,
 	zeroonly.insert(0);
 	W_curve.write_dehomogenized_coordinates("witness_points_dehomogenized",zeroonly); // write the points to file
 
-	int num_deflations, *deflation_sequence = NULL;
-	isosingular_deflation(&num_deflations, &deflation_sequence,
-						  program_options, W_curve.input_filename(),
-						  "witness_points_dehomogenized",
-						  temp_path, // output name
-						  program_options.max_deflations());
-	free(deflation_sequence); // ugh, eww, and gross.  sorry, dear reader.  i know...
+	{
+		RunProfile::StageTimer deflation_stage("deflation");
+		int num_deflations, *deflation_sequence = NULL;
+		isosingular_deflation(&num_deflations, &deflation_sequence,
+							  program_options, W_curve.input_filename(),
+							  "witness_points_dehomogenized",
+							  temp_path, // output name
+							  program_options.max_deflations());
+		free(deflation_sequence); // ugh, eww, and gross.  sorry, dear reader.  i know...
+	}
 
 
 
@@ -144,22 +148,26 @@ void Curve::computeCurveSelfConj(const WitnessSet & W_curve,
     // 4) solve for critical conditions for random complex projection
 	WitnessSet W_crit_real, W_singular;
 
-
-	compute_critical_points(W_curve,
-                            projections,
-                            program_options,
-                            solve_options,
-                            W_crit_real,
-                            W_singular);
-
+	{
+		RunProfile::StageTimer critical_stage("critical_points");
+		compute_critical_points(W_curve,
+		                        projections,
+		                        program_options,
+		                        solve_options,
+		                        W_crit_real,
+		                        W_singular);
+	}
 
 
-	interslice(W_curve,
-               W_crit_real,
-               projections,
-               program_options,
-               solve_options,
-               V);
+	{
+		RunProfile::StageTimer interslice_stage("interslice");
+		interslice(W_curve,
+		           W_crit_real,
+		           projections,
+		           program_options,
+		           solve_options,
+		           V);
+	}
 
 	if (!this->IsEmbedded())
 		V.add_type_to_points(W_singular,Singular);
@@ -1459,7 +1467,7 @@ int verify_projection_ok(const WitnessSet & W,
 	}
 
 	prog_t SLP;
-	setupProg(&SLP, solve_options.T.Precision, 2);
+	setup_prog(&SLP, solve_options.T.Precision, 2);
 
 
 	comp_mp zerotime; init_mp(zerotime);
@@ -1514,7 +1522,7 @@ int verify_projection_ok(const WitnessSet & W,
 
 	clear_eval_struct_mp(ED);
 
-	clearProg(&SLP, solve_options.T.MPType, 1);
+	clear_prog(&SLP, solve_options.T.MPType, 1);
 
 	return invalid_flag;
 
@@ -1580,6 +1588,9 @@ void Curve::receive(int source, ParallelismConfig & mpi_config)
 
 
 int Curve::setup(boost::filesystem::path containing_folder){
+	if (DecompositionArchive::ExistsIn(containing_folder))
+		return setup(ArchiveLocation(std::make_shared<DecompositionArchive>(containing_folder / DecompositionArchive::DefaultName())));
+
 	Decomposition::setup(containing_folder / "decomp");
 
 	setup_edges(containing_folder / "E.edge");
@@ -1589,18 +1600,43 @@ int Curve::setup(boost::filesystem::path containing_folder){
 }
 
 
+int Curve::setup(ArchiveLocation const& location){
+	Decomposition::setup(location);
+
+	FILE *IN = location.Open("E.edge");
+	setup_edges(IN);
+	fclose(IN);
+
+	if (location.Has("curve.cnums"))
+	{
+		IN = location.Open("curve.cnums");
+		setup_cycle_numbers(IN, location.ChunkName("curve.cnums"));
+		fclose(IN);
+	}
+
+	return 1;
+}
+
 
 
 
 int Curve::setup_edges(boost::filesystem::path INfile)
+{
+	FILE *IN = safe_fopen_read(INfile);
+
+	int retval = setup_edges(IN);
+
+	fclose(IN);
+	return retval;
+}
+
+
+int Curve::setup_edges(FILE *IN)
 {
 #ifdef functionentry_output
 	std::cout << "curve::setup_edges" << std::endl;
 #endif
 
-
-	FILE *IN = safe_fopen_read(INfile);
-
 	unsigned int temp_num_edges;
 
 	fscanf(IN, "%u\n", &temp_num_edges);
@@ -1611,28 +1647,36 @@ int Curve::setup_edges(boost::filesystem::path INfile)
 		AddEdge(Edge(left, midpt, right),EdgeMetaData());
 	}
 
-	fclose(IN);
 	return this->num_edges_;
 }
 
 
 int Curve::setup_cycle_numbers(boost::filesystem::path INfile)
 {
-#ifdef functionentry_output
-	std::cout << "curve::setup_cycle_numbers" << std::endl;
-#endif
-
 	if (!boost::filesystem::exists(INfile))
 		return 0;
 
 	FILE *IN = safe_fopen_read(INfile);
 
+	int retval = setup_cycle_numbers(IN, INfile.string());
+
+	fclose(IN);
+	return retval;
+}
+
+
+int Curve::setup_cycle_numbers(FILE *IN, std::string const& source_name)
+{
+#ifdef functionentry_output
+	std::cout << "curve::setup_cycle_numbers" << std::endl;
+#endif
+
 	unsigned int temp_num_edges;
 
 	fscanf(IN, "%u\n", &temp_num_edges);
 
 	if (temp_num_edges != num_edges())
-		throw std::runtime_error("mismatch in number of cycle number data, and number of edges in curve in file " + INfile.string());
+		throw std::runtime_error("mismatch in number of cycle number data, and number of edges in curve in file " + source_name);
 
 	int left, right;
 
@@ -1641,7 +1685,6 @@ int Curve::setup_cycle_numbers(boost::filesystem::path INfile)
 		edge_metadata_[ii] = EdgeMetaData(left,right);
 	}
 
-	fclose(IN);
 	return this->num_edges_;
 }
 
@@ -1723,6 +1766,8 @@ void Curve::computeCurveNotSelfConj(const WitnessSet		&W_in,
 	std::cout << "curve::computeCurveNotSelfConj" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("not_self_conjugate");
+
 
 
 	// num_vars includes the homogeneous variable
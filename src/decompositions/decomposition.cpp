@@ -85,11 +85,30 @@ int Decomposition::index_in_vertices_with_add(VertexSet &V,
 
 int Decomposition::setup(boost::filesystem::path INfile)
 {
-	boost::filesystem::path directoryName = INfile.parent_path();
+	std::ifstream fin(INfile.c_str());
+
+	int retval = setup(fin, INfile.parent_path());
+
+	fin.close();
+
+	return retval;
+}
+
+
+
+int Decomposition::setup(ArchiveLocation const& location)
+{
+	std::istringstream fin(location.Read("decomp"));
+
+	return setup(fin, location.Folder());
+}
+
+
 
+int Decomposition::setup(std::istream & fin, boost::filesystem::path const& directoryName)
+{
 	std::stringstream converter;
 	std::string tempstr;
-	std::ifstream fin(INfile.c_str());
 
 
 	getline(fin, tempstr);
@@ -189,8 +208,6 @@ int Decomposition::setup(boost::filesystem::path INfile)
 	if (fin.eof())
 		std::cout << "premature end of file when reading decomposition from file";
 
-	fin.close();
-
 
 	clear_vec_mp(tempvec);
 	clear_vec_mp(temp_patch);
@@ -510,7 +527,7 @@ void Decomposition::send(int target, ParallelismConfig & mpi_config) const
 
 	if (num_curr_projections()>0) {
 		for (int ii=0; ii<num_curr_projections(); ii++) {
-			send_vec_mp(pi_[ii],target);
+			send_vec_mp(pi_[ii],target, mpi_config.comm());
 		}
 	}
 
@@ -520,7 +537,7 @@ void Decomposition::send(int target, ParallelismConfig & mpi_config) const
 	if ( num_patches()>0) {
 
 		for (unsigned int ii=0; ii<num_patches(); ii++) {
-			send_vec_mp(patch(ii),target);
+			send_vec_mp(patch(ii),target, mpi_config.comm());
 		}
 	}
 
@@ -529,8 +546,8 @@ void Decomposition::send(int target, ParallelismConfig & mpi_config) const
 
 	if (have_sphere_) {
 
-		send_vec_mp(sphere_center_,target);
-		send_comp_mp(sphere_radius_,target);
+		send_vec_mp(sphere_center_,target, mpi_config.comm());
+		send_comp_mp(sphere_radius_,target, mpi_config.comm());
 	}
 
 
@@ -544,7 +561,7 @@ void Decomposition::send(int target, ParallelismConfig & mpi_config) const
 
 	randomizer_->send(target,mpi_config);
 
-	send_vec_mp(crit_slice_values, target);
+	send_vec_mp(crit_slice_values, target, mpi_config.comm());
 
 	return;
 }
@@ -591,7 +608,7 @@ void Decomposition::receive(int source, ParallelismConfig & mpi_config)
 	if (temp_num_projections>0) {
 
 		for (int ii=0; ii<temp_num_projections; ii++) {
-			receive_vec_mp(tempvec,source);
+			receive_vec_mp(tempvec,source, mpi_config.comm());
 			add_projection(tempvec);
 		}
 	}
@@ -604,7 +621,7 @@ void Decomposition::receive(int source, ParallelismConfig & mpi_config)
 
 	if (temp_num_patches>0) {
 		for (int ii=0; ii<temp_num_patches; ii++) {
-			receive_vec_mp(tempvec,source);
+			receive_vec_mp(tempvec,source, mpi_config.comm());
 			add_patch(tempvec);
 		}
 	}
@@ -612,8 +629,8 @@ void Decomposition::receive(int source, ParallelismConfig & mpi_config)
 
 
 	if (have_sphere_) {
-		receive_vec_mp(sphere_center_,source);
-		receive_comp_mp(sphere_radius_,source);
+		receive_vec_mp(sphere_center_,source, mpi_config.comm());
+		receive_comp_mp(sphere_radius_,source, mpi_config.comm());
 	}
 
 	if (strleng>1) {
@@ -632,7 +649,7 @@ void Decomposition::receive(int source, ParallelismConfig & mpi_config)
 
 	randomizer_->receive(source,mpi_config);
 
-	receive_vec_mp(crit_slice_values, source);
+	receive_vec_mp(crit_slice_values, source, mpi_config.comm());
 
 	return;
 }
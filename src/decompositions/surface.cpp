@@ -1,5 +1,8 @@
 #include "decompositions/surface.hpp"
 
+#include <deque>
+#include <iterator>
+
 
 
 
@@ -23,6 +26,8 @@ void Surface::main(VertexSet & V,
 	std::cout << "surface_main" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("surface");
+
 	Decomposition::copy_data_from_witness_set(W_surf);
 
 
@@ -46,51 +51,35 @@ void Surface::main(VertexSet & V,
 
 
 
-    // get the witness points for the critical curve.
-    WitnessSet W_critcurve;
-	std::map< int, WitnessSet> higher_multiplicity_witness_sets;
-
-
-    compute_critcurve_witness_set(W_critcurve,
-								  higher_multiplicity_witness_sets,
-                                  W_surf,
-                                  0,
-                                  program_options,
-                                  solve_options);
-
-
-
-
-
-
-
-	///////////////////////////////
-
-	WitnessSet points_which_needed_no_deflation;
-	std::map< SingularObjectMetadata, WitnessSet > split_sets;
+	// the critical curve, the singular curves, and their critical points do not depend on the sphere, so may come from an earlier Decomposition with another.
+	SphereIndependentStages stages;
+	if (!program_options.reuse_dir().empty() && stages.Read(program_options.input_filename(), W_surf, pi))
+	{
+		if (program_options.verbose_level()>=-1)
+			std::cout << color::bold('m') << "reusing the critical curve, singular curves and their critical points from " << program_options.reuse_dir() << color::console_default() << std::endl;
+		prepare_reused_stages(stages, solve_options);
+	}
+	else
+		compute_sphere_independent(stages, W_surf, program_options, solve_options);
 
-	deflate_and_split(split_sets,
-					  higher_multiplicity_witness_sets,
-					  points_which_needed_no_deflation,
-					  program_options,
-					  solve_options);
+	stages.Write(program_options.output_dir() / SphereIndependentStages::FolderName(), program_options.input_filename(), W_surf, pi);
 
+	WitnessSet & W_critcurve = stages.critcurve;
+	std::map< SingularObjectMetadata, WitnessSet > & split_sets = stages.split_sets;
 
 
 
 
 	///////////////////////////////////
-	// get the critical points and the sphere intersection points for the critical curve
-    WitnessSet W_critcurve_crit;
-    WitnessSet W_singular_points_on_critical_curve, W_singular_points_on_singular_curve, W_singular_points_on_sphere_curve;
-
-    compute_critcurve_critpts(W_critcurve_crit, // the computed value
-    						  W_singular_points_on_critical_curve, // another computed value.  a subset of the ones above, but we want these for labeling purposes
-                              W_critcurve,
-                              0,
-                              program_options,
-                              solve_options);
+	// keep the critical points inside the sphere
+    WitnessSet W_critcurve_crit = stages.critcurve_crit;
+    WitnessSet W_singular_points_on_critical_curve = stages.singular_points_on_critical_curve;
+    WitnessSet W_singular_points_on_singular_curve, W_singular_points_on_sphere_curve;
 
+	if (have_sphere()) {
+		W_critcurve_crit.sort_for_inside_sphere(sphere_radius(), sphere_center());
+		W_singular_points_on_critical_curve.sort_for_inside_sphere(sphere_radius(), sphere_center());
+	}
 
     this->crit_curve_.add_witness_set(W_critcurve_crit,Critical,V);
 
@@ -98,12 +87,11 @@ void Surface::main(VertexSet & V,
 
 
 	WitnessSet W_singular_crit;
-	compute_singular_crit(W_singular_crit,
-						  W_singular_points_on_singular_curve,
-						  split_sets,
-						  V,
-						  program_options,
-						  solve_options);
+	add_singular_crit(W_singular_crit,
+					  W_singular_points_on_singular_curve,
+					  stages,
+					  V,
+					  program_options);
 	///////////////////////////////
 
 
@@ -324,6 +312,84 @@ void Surface::main(VertexSet & V,
 
 
 
+void Surface::compute_sphere_independent(SphereIndependentStages & stages,
+										 const WitnessSet & W_surf,
+										 BertiniRealConfig & program_options,
+										 SolverConfiguration & solve_options)
+{
+#ifdef functionentry_output
+	std::cout << "surface::compute_sphere_independent" << std::endl;
+#endif
+
+    // get the witness points for the critical curve.
+	std::map< int, WitnessSet> higher_multiplicity_witness_sets;
+
+    compute_critcurve_witness_set(stages.critcurve,
+								  higher_multiplicity_witness_sets,
+                                  W_surf,
+                                  0,
+                                  program_options,
+                                  solve_options);
+
+
+
+	WitnessSet points_which_needed_no_deflation;
+
+	deflate_and_split(stages.split_sets,
+					  higher_multiplicity_witness_sets,
+					  points_which_needed_no_deflation,
+					  program_options,
+					  solve_options);
+
+
+
+	// get the critical points for the critical curve
+    compute_critcurve_critpts(stages.critcurve_crit, // the computed value
+    						  stages.singular_points_on_critical_curve, // another computed value.  a subset of the ones above, but we want these for labeling purposes
+                              stages.critcurve,
+                              0,
+                              program_options,
+                              solve_options);
+
+
+
+	compute_singular_crit(stages.singular_crit,
+						  stages.singular_points_on_singular_curve,
+						  stages.split_sets,
+						  program_options,
+						  solve_options);
+}
+
+
+
+
+void Surface::prepare_reused_stages(SphereIndependentStages const& stages,
+									SolverConfiguration & solve_options)
+{
+#ifdef functionentry_output
+	std::cout << "surface::prepare_reused_stages" << std::endl;
+#endif
+
+	int blabla;
+	parse_input_file(stages.critcurve.input_filename(), &blabla);
+	preproc_data_clear(&solve_options.PPD);
+	parse_preproc_data("preproc_data", &solve_options.PPD);
+
+	crit_curve_.randomizer()->setup(stages.critcurve.num_variables() - stages.critcurve.num_patches() - 1,solve_options.PPD.num_funcs);
+
+
+	for (auto iter = stages.split_sets.begin(); iter!=stages.split_sets.end(); ++iter) {
+		parse_input_file(iter->second.input_filename(), &blabla);
+		preproc_data_clear(&solve_options.PPD);
+		parse_preproc_data("preproc_data", &solve_options.PPD);
+
+		singular_curves_[iter->first].randomizer()->setup(iter->second.num_variables()-iter->second.num_patches()-1, solve_options.PPD.num_funcs);
+	}
+}
+
+
+
+
 void Surface::beginning_stuff(const WitnessSet & W_surf,
                                             BertiniRealConfig & program_options,
                                             SolverConfiguration & solve_options)
@@ -341,7 +407,7 @@ void Surface::beginning_stuff(const WitnessSet & W_surf,
 
 
 
-		boost::filesystem::path temp_path = program_options.input_filename();
+		boost::filesystem::path temp_path = program_options.input_filename().filename(); // written in the workspace
 
 		std::stringstream converter;
 		converter << "_dim_" << W_surf.dimension() << "_comp_" << W_surf.component_number() << "_deflated";
@@ -441,6 +507,8 @@ void Surface::compute_critcurve_witness_set(WitnessSet & W_critcurve,
 	std::cout << "surface::compute_critcurve_witness_set" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("critcurve_witness_set");
+
 
 	if (program_options.verbose_level()>=-1)
 		std::cout << color::bold('m') << "computing witness points for the critical curve" << color::console_default() << std::endl;
@@ -507,7 +575,7 @@ void Surface::compute_critcurve_witness_set(WitnessSet & W_critcurve,
 
 	// this system describes the system for the critical curve
 	create_nullspace_system("input_critical_curve",
-                            boost::filesystem::path(program_options.called_dir()) / program_options.input_deflated_filename(),
+                            boost::filesystem::absolute(program_options.input_deflated_filename(), program_options.working_dir()),
                             program_options, &ns_config);
 
 
@@ -553,6 +621,8 @@ void Surface::compute_critcurve_critpts(WitnessSet & W_critcurve_crit,  // the c
 	std::cout << "surface::compute_critcurve_critpts" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("critcurve_critpts");
+
 
 
 
@@ -622,12 +692,6 @@ void Surface::compute_critcurve_critpts(WitnessSet & W_critcurve_crit,  // the c
 	W_singular_points_on_critical_curve.sort_for_unique(program_options.same_point_tol());
 
 
-	if (have_sphere()) {
-		W_critcurve_crit.sort_for_inside_sphere(sphere_radius(), sphere_center());
-		W_singular_points_on_critical_curve.sort_for_inside_sphere(sphere_radius(), sphere_center());
-	}
-
-
     return;
 }
 
@@ -644,6 +708,8 @@ void Surface::compute_critical_curve(const WitnessSet & W_critcurve,
 	std::cout << "surface::compute_critical_curve" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("critical_curve");
+
 	if (program_options.verbose_level()>=-1)
     	std::cout << color::bold('m') << "interslicing critical curve" << color::console_default() << std::endl;
 
@@ -706,6 +772,7 @@ void Surface::deflate_and_split(std::map< SingularObjectMetadata, WitnessSet > &
 											  BertiniRealConfig & program_options,
 											  SolverConfiguration & solve_options)
 {
+	RunProfile::StageTimer stage("deflate_and_split");
 
 
 	if (higher_multiplicity_witness_sets.size()==0) {
@@ -729,16 +796,35 @@ void Surface::deflate_and_split(std::map< SingularObjectMetadata, WitnessSet > &
 
 
 
+		WitnessSet all_points = iter->second; // this sucks because it duplicates data
+		all_points.only_first_vars(this->num_variables());
+
+
+		// points whose jacobians have different coranks have different deflation sequences, so are split before deflating anything.  one deflation per group, rather than per point tried.
+		int blabla;
+		parse_input_file(program_options.input_filename(),&blabla);
+		preproc_data_clear(&solve_options.PPD);
+		parse_preproc_data("preproc_data", &solve_options.PPD);
+
+		std::map<int, WitnessSet> corank_groups;
+		group_by_jacobian_corank(corank_groups, all_points, solve_options);
+
+		if (program_options.verbose_level()>=1)
+			std::cout << "the " << all_points.num_points() << " points of multiplicity " << iter->first << " fall into " << corank_groups.size() << " groups by corank" << std::endl;
 
+		std::deque<WitnessSet> waiting;
+		for (auto group = corank_groups.begin(); group!=corank_groups.end(); ++group)
+			waiting.push_back(group->second);
 
-		WitnessSet active_set = iter->second; // seed the loop/  this sucks because it duplicates data
-		active_set.only_first_vars(this->num_variables());
 
-		WitnessSet W_only_one_witness_point;
-		W_only_one_witness_point.copy_skeleton(active_set);
 
+		while (!waiting.empty()) {
 
-		while (active_set.has_points()) {
+			WitnessSet active_set = waiting.front();
+			waiting.pop_front();
+
+			WitnessSet W_only_one_witness_point;
+			W_only_one_witness_point.copy_skeleton(active_set);
 
 			WitnessSet W_reject; // these will be populated in the find matching call.
 			SingularObjectMetadata curr_index(iter->first,num_this_multiplicity);
@@ -750,7 +836,6 @@ void Surface::deflate_and_split(std::map< SingularObjectMetadata, WitnessSet > &
 			singcurve_filename += converter.str(); converter.clear(); converter.str("");
 
 
-			W_only_one_witness_point.reset_points();
 			W_only_one_witness_point.add_point( active_set.point(0) ); // exists by entrance condition
 			W_only_one_witness_point.real_threshold_points(solve_options.T.real_threshold);
 			W_only_one_witness_point.write_dehomogenized_coordinates("singular_witness_points_dehomogenized"); // write the points to file
@@ -775,7 +860,6 @@ void Surface::deflate_and_split(std::map< SingularObjectMetadata, WitnessSet > &
 			active_set.set_input_filename(singcurve_filename);
 			active_set.set_dimension(1);
 
-			int blabla;
 			parse_input_file(singcurve_filename,&blabla);
 			preproc_data_clear(&solve_options.PPD); // ugh this sucks
 			parse_preproc_data("preproc_data", &solve_options.PPD);
@@ -785,7 +869,7 @@ void Surface::deflate_and_split(std::map< SingularObjectMetadata, WitnessSet > &
 
 
 			find_matching_singular_witness_points(split_sets[curr_index],
-												  W_reject, //W_reject contains the points of this multiplicity which DO NOT satisfy this deflation.  they must be deflated again.
+												  W_reject, //W_reject contains the points of the group which DO NOT satisfy this deflation.  their sequences part from this one later on, and they must be deflated again.
 												  active_set,//input witness set
 												  solve_options);
 
@@ -794,10 +878,9 @@ void Surface::deflate_and_split(std::map< SingularObjectMetadata, WitnessSet > &
 
 			if (W_reject.has_points()) {
 				std::cout << color::red() << "found that current singular witness set had " << W_reject.num_points() << " non-deflated points" << std::endl << color::console_default();
+				waiting.push_back(W_reject);
 			}
 
-			//TODO: this is an ideal place for a swap operator.
-			active_set = W_reject;
 			num_this_multiplicity++;
 
 		}
@@ -819,23 +902,15 @@ void Surface::deflate_and_split(std::map< SingularObjectMetadata, WitnessSet > &
 
 
 
-void Surface::compute_singular_crit(WitnessSet & W_singular_crit, // output
-									WitnessSet & W_singular_points_on_singular_curve, // output
+void Surface::compute_singular_crit(std::map<SingularObjectMetadata, WitnessSet> & singular_crit,
+									std::map<SingularObjectMetadata, WitnessSet> & singular_points_on_singular_curve,
 												  const std::map<SingularObjectMetadata, WitnessSet> & split_sets,
-												  VertexSet & V,
 												  BertiniRealConfig & program_options,
 												  SolverConfiguration & solve_options)
 {
+	RunProfile::StageTimer stage("singular_crit");
 
 
-
-	W_singular_crit.set_num_variables(this->num_variables());
-	W_singular_crit.set_num_natural_variables(this->num_variables());
-	W_singular_crit.copy_patches(*this);
-
-	W_singular_points_on_singular_curve.set_num_variables(this->num_variables());
-	W_singular_points_on_singular_curve.set_num_natural_variables(this->num_variables());
-	W_singular_points_on_singular_curve.copy_patches(*this);
 	for (auto iter = split_sets.begin(); iter!=split_sets.end(); ++iter) {
 
 		if (program_options.verbose_level()>=-2)
@@ -902,6 +977,33 @@ void Surface::compute_singular_crit(WitnessSet & W_singular_crit, // output
 		W_sing_this_round.sort_for_real(solve_options.T.real_threshold);
 		W_sing_this_round.set_input_filename(iter->second.input_filename());
 
+		singular_crit[iter->first] = W_this_round;
+		singular_points_on_singular_curve[iter->first] = W_sing_this_round;
+	}
+
+}
+
+
+
+void Surface::add_singular_crit(WitnessSet & W_singular_crit,
+								WitnessSet & W_singular_points_on_singular_curve,
+								SphereIndependentStages const& stages,
+								VertexSet & V,
+								BertiniRealConfig & program_options)
+{
+	W_singular_crit.set_num_variables(this->num_variables());
+	W_singular_crit.set_num_natural_variables(this->num_variables());
+	W_singular_crit.copy_patches(*this);
+
+	W_singular_points_on_singular_curve.set_num_variables(this->num_variables());
+	W_singular_points_on_singular_curve.set_num_natural_variables(this->num_variables());
+	W_singular_points_on_singular_curve.copy_patches(*this);
+
+	for (auto iter = stages.singular_crit.begin(); iter!=stages.singular_crit.end(); ++iter) {
+
+		WitnessSet W_this_round = iter->second;
+		WitnessSet W_sing_this_round = stages.singular_points_on_singular_curve.at(iter->first);
+
 		if (have_sphere()) {
 			W_this_round.sort_for_inside_sphere(sphere_radius(), sphere_center());
 			W_sing_this_round.sort_for_inside_sphere(sphere_radius(), sphere_center());
@@ -924,6 +1026,7 @@ void Surface::compute_singular_curves(const WitnessSet & W_total_crit,
 													BertiniRealConfig & program_options,
 													SolverConfiguration & solve_options)
 {
+	RunProfile::StageTimer stage("singular_curves");
 	program_options.merge_edges(false);
 
 	for (auto iter = split_sets.begin(); iter!=split_sets.end(); ++iter) {
@@ -999,7 +1102,7 @@ int find_matching_singular_witness_points(WitnessSet & W_match,
 
 
 	prog_t SLP;
-	setupProg(&SLP, solve_options.T.Precision, 2);
+	setup_prog(&SLP, solve_options.T.Precision, 2);
 
 
 	comp_mp zerotime; init_mp(zerotime);
@@ -1078,7 +1181,7 @@ int find_matching_singular_witness_points(WitnessSet & W_match,
 
 	clear_mat_mp(U); clear_mat_mp(E); clear_mat_mp(V);
 	clear_mp(zerotime);
-	clear_eval_struct_mp(ED); clearProg(&SLP, solve_options.T.MPType, 1);
+	clear_eval_struct_mp(ED); clear_prog(&SLP, solve_options.T.MPType, 1);
 
 
 	return SUCCESSFUL;
@@ -1090,6 +1193,59 @@ int find_matching_singular_witness_points(WitnessSet & W_match,
 
 
 
+int group_by_jacobian_corank(std::map<int, WitnessSet> & groups,
+							 const WitnessSet & W,
+							 SolverConfiguration & solve_options)
+{
+
+	// assumes the system is already parsed.
+
+	prog_t SLP;
+	setup_prog(&SLP, solve_options.T.Precision, 2);
+
+
+	comp_mp zerotime; init_mp(zerotime);
+	set_zero_mp(zerotime);
+
+	eval_struct_mp ED; init_eval_struct_mp(ED, 0, 0, 0);
+
+	tracker_config_t * T = &solve_options.T;
+	double tol = MAX(T->final_tol_times_mult, T->sing_val_zero_tol);
+
+	mat_mp U, E, V; init_mat_mp(U, 0, 0); init_mat_mp(E, 0, 0); init_mat_mp(V, 0, 0);
+
+
+	groups.clear();
+	for (unsigned int zz = 0; zz<W.num_points(); ++zz)
+	{
+		vec_mp & curr_point = W.point(zz);
+
+		evalProg_mp(ED.funcVals, ED.parVals, ED.parDer, ED.Jv, ED.Jp, curr_point, zerotime, &SLP);
+		int corank = svd_jacobi_mp_prec(U, E, V, ED.Jv, tol, T->Precision); // this wraps around svd_jacobi_mp.
+
+		if (groups.find(corank)==groups.end()) {
+			groups[corank].copy_skeleton(W);
+			groups[corank].copy_linears(W);
+			groups[corank].copy_patches(W);
+		}
+		groups[corank].add_point(curr_point);
+	}
+
+
+	clear_mat_mp(U); clear_mat_mp(E); clear_mat_mp(V);
+	clear_mp(zerotime);
+	clear_eval_struct_mp(ED); clear_prog(&SLP, solve_options.T.MPType, 1);
+
+
+	return groups.size();
+}
+
+
+
+
+
+
+
 void Surface::compute_sphere_witness_set(const WitnessSet & W_surf,
                                                        WitnessSet & W_intersection_sphere,
                                                        BertiniRealConfig & program_options,
@@ -1099,6 +1255,8 @@ void Surface::compute_sphere_witness_set(const WitnessSet & W_surf,
 	std::cout << "surface::compute_sphere_witness_set" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("sphere_witness_set");
+
 
 	if (program_options.verbose_level()>=0) {
 		std::cout << color::magenta() << "getting sphere witness set" << color::console_default() << std::endl;
@@ -1221,6 +1379,8 @@ void Surface::compute_sphere_crit(const WitnessSet & W_intersection_sphere,
 	std::cout << "surface::compute_sphere_crit" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("sphere_crit");
+
 
 	int blabla;
 	parse_input_file("input_surf_sphere", &blabla); // having already been written to disk
@@ -1284,6 +1444,8 @@ void Surface::compute_bounding_sphere(const WitnessSet & W_intersection_sphere,
 	std::cout << "surface::compute_bounding_sphere" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("bounding_sphere");
+
 	program_options.merge_edges(false);
 
 	comp_mp temp; init_mp(temp);
@@ -1341,6 +1503,8 @@ void Surface::compute_slices(const WitnessSet W_surf,
 	std::cout << "surface::compute_slices" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("slices_" + kindofslice);
+
 
 
 	vec_mp *multilin_linears = (vec_mp *) br_malloc(2*sizeof(vec_mp));
@@ -1509,6 +1673,8 @@ void Surface::connect_the_dots(VertexSet & V,
 	std::cout << "surface::connect_the_dots" << std::endl;
 #endif
 
+	RunProfile::StageTimer stage("connect_the_dots");
+
 	if (program_options.verbose_level()>=-1)
 		std::cout << color::bold('m') << "***\n\nCONNECT THE DOTS\n\n***" << color::console_default() << std::endl;
 
@@ -2734,6 +2900,19 @@ void Surface::read_faces(boost::filesystem::path load_from_me)
 
 
 	std::ifstream fin(load_from_me.c_str());
+
+	read_faces(fin);
+
+	fin.close();
+
+
+
+	return;
+}
+
+
+void Surface::read_faces(std::istream & fin)
+{
 	int temp_num_faces;
 	fin >> temp_num_faces;
 	for (int ii=0; ii<temp_num_faces; ii++) {
@@ -2742,12 +2921,6 @@ void Surface::read_faces(boost::filesystem::path load_from_me)
 		fin >> F;
 		add_face(F);
 	}
-
-	fin.close();
-
-
-
-	return;
 }
 
 
@@ -2757,6 +2930,12 @@ void Surface::read_faces(boost::filesystem::path load_from_me)
 
 void Surface::setup(boost::filesystem::path base)
 {
+	if (DecompositionArchive::ExistsIn(base))
+	{
+		setup(ArchiveLocation(std::make_shared<DecompositionArchive>(base / DecompositionArchive::DefaultName())));
+		return;
+	}
+
 	Decomposition::setup(base / "decomp");
 
 	std::vector<SingularObjectMetadata > singular_multiplicities;
@@ -2833,9 +3012,61 @@ void Surface::setup(boost::filesystem::path base)
 
 
 
+void Surface::setup(ArchiveLocation const& location)
+{
+	Decomposition::setup(location);
+
+	std::vector<SingularObjectMetadata > singular_multiplicities;
+	int temp_num_crit, temp_num_mid;
+
+	FILE *IN = location.Open("S.surf");
+	read_summary(singular_multiplicities,temp_num_mid, temp_num_crit, IN);
+	fclose(IN);
+
+	std::istringstream fin(location.Read("F.faces"));
+	read_faces(fin);
+
+	mid_slices_.resize(temp_num_mid);
+	crit_slices_.resize(temp_num_crit);
+
+
+	for (int ii=0; ii<temp_num_mid; ii++)
+		mid_slices_[ii].setup(location / ("curve_midslice_" + std::to_string(ii)));
+
+	for (int ii=0; ii<temp_num_crit; ii++)
+		crit_slices_[ii].setup(location / ("curve_critslice_" + std::to_string(ii)));
+
+
+	for (auto iter = singular_multiplicities.begin(); iter!=singular_multiplicities.end(); ++iter) {
+		std::stringstream converter;
+		converter << "curve_singular_mult_" << iter->multiplicity() << "_" << iter->index();
+
+		singular_curves_[*iter].setup(location / converter.str());
+		num_singular_curves_++;
+	}
+
+	crit_curve_.setup(location / "curve_crit");
+	sphere_curve_.setup(location / "curve_sphere");
+
+	return;
+}
+
+
+
+
+
 void read_summary(std::vector<SingularObjectMetadata > & singular_multiplicities, int & temp_num_mid, int & temp_num_crit, boost::filesystem::path INfile)
 {
 	FILE *IN = safe_fopen_read(INfile);
+
+	read_summary(singular_multiplicities, temp_num_mid, temp_num_crit, IN);
+
+	fclose(IN);
+}
+
+
+void read_summary(std::vector<SingularObjectMetadata > & singular_multiplicities, int & temp_num_mid, int & temp_num_crit, FILE *IN)
+{
 	int temp_num_faces, temp_num_edges;
 
 	fscanf(IN,"%d %d %d %d", &temp_num_faces, &temp_num_edges, &temp_num_mid, &temp_num_crit);
@@ -2847,8 +3078,306 @@ void read_summary(std::vector<SingularObjectMetadata > & singular_multiplicities
 		fscanf(IN,"%d %d",&temp_mult, &temp_index);
 		singular_multiplicities.push_back(SingularObjectMetadata(temp_mult,temp_index));
 	}
-	fclose(IN);
 
 
 	return;
 }
+
+
+
+
+namespace {
+
+	/**
+	 \brief write a vector, as its size and then its coordinates, one per line.
+	 */
+	void WriteVec(FILE *OUT, vec_mp const v)
+	{
+		fprintf(OUT, "%d\n", v->size);
+		for (int jj=0; jj<v->size; jj++) {
+			mpf_out_str(OUT,10,0,v->coord[jj].r);
+			fprintf(OUT," ");
+			mpf_out_str(OUT,10,0,v->coord[jj].i);
+			fprintf(OUT,"\n");
+		}
+	}
+
+
+	/**
+	 \brief read a vector written by WriteVec.
+	 */
+	void ReadVec(FILE *IN, vec_mp v)
+	{
+		int size;
+		fscanf(IN, "%d", &size);
+		change_size_vec_mp(v, size);  v->size = size;
+		for (int jj=0; jj<size; jj++) {
+			mpf_inp_str(v->coord[jj].r, IN, 10);
+			mpf_inp_str(v->coord[jj].i, IN, 10);
+		}
+	}
+
+
+	/**
+	 \brief write a witness set, with everything WitnessSet::print_to_file leaves out: the names, the input file, and any number of patches.
+	 */
+	void WriteStage(WitnessSet const& W, boost::filesystem::path const& filename)
+	{
+		FILE *OUT = safe_fopen_write(filename);
+
+		fprintf(OUT, "%d %d %d %d\n", W.dimension(), W.component_number(), W.num_variables(), W.num_natural_variables());
+		fprintf(OUT, "%s\n", W.input_filename().filename().c_str());
+
+		fprintf(OUT, "%zu\n", W.num_var_names());
+		for (unsigned int ii=0; ii<W.num_var_names(); ii++)
+			fprintf(OUT, "%s\n", W.name(ii).c_str());
+
+		fprintf(OUT, "%zu\n", W.num_points());
+		for (unsigned int ii=0; ii<W.num_points(); ii++)
+			WriteVec(OUT, W.point(ii));
+
+		fprintf(OUT, "%zu\n", W.num_linears());
+		for (unsigned int ii=0; ii<W.num_linears(); ii++)
+			WriteVec(OUT, W.linear(ii));
+
+		fprintf(OUT, "%zu\n", W.num_patches());
+		for (unsigned int ii=0; ii<W.num_patches(); ii++)
+			WriteVec(OUT, W.patch(ii));
+
+		fclose(OUT);
+	}
+
+
+	/**
+	 \brief read a witness set written by WriteStage.
+	 */
+	void ReadStage(WitnessSet & W, boost::filesystem::path const& filename)
+	{
+		FILE *IN = safe_fopen_read(filename);
+
+		W.reset();
+
+		int dim, comp, num_vars, num_natural_vars;
+		fscanf(IN, "%d %d %d %d", &dim, &comp, &num_vars, &num_natural_vars);
+		W.set_dimension(dim);
+		W.set_component_number(comp);
+		W.set_num_variables(num_vars);
+		W.set_num_natural_variables(num_natural_vars);
+
+		char buffer[4096];
+		fscanf(IN, "%4095s", buffer);
+		W.set_input_filename(buffer);
+
+		int num_names;
+		fscanf(IN, "%d", &num_names);
+		std::vector<std::string> names(num_names);
+		for (int ii=0; ii<num_names; ii++) {
+			fscanf(IN, "%4095s", buffer);
+			names[ii] = buffer;
+		}
+		W.set_variable_names(names);
+
+		vec_mp temp_vec;  init_vec_mp2(temp_vec, 0, 1024);
+		int num;
+
+		fscanf(IN, "%d", &num);
+		for (int ii=0; ii<num; ii++) {
+			ReadVec(IN, temp_vec);
+			W.add_point(temp_vec);
+		}
+
+		fscanf(IN, "%d", &num);
+		for (int ii=0; ii<num; ii++) {
+			ReadVec(IN, temp_vec);
+			W.add_linear(temp_vec);
+		}
+
+		fscanf(IN, "%d", &num);
+		for (int ii=0; ii<num; ii++) {
+			ReadVec(IN, temp_vec);
+			W.add_patch(temp_vec);
+		}
+
+		clear_vec_mp(temp_vec);
+		fclose(IN);
+	}
+
+
+	/**
+	 \brief the name under which the stages of a singular curve are written.
+	 */
+	std::string StageName(std::string const& kind, SingularObjectMetadata const& index)
+	{
+		std::stringstream converter;
+		converter << kind << "_" << index.multiplicity() << "_" << index.index();
+		return converter.str();
+	}
+
+
+	/**
+	 \brief the contents of a file, for comparing.
+	 */
+	std::string Contents(boost::filesystem::path const& filename)
+	{
+		std::ifstream fin(filename.string());
+		return std::string((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+	}
+
+} // re: anonymous namespace
+
+
+
+
+bool SphereIndependentStages::Fetch(boost::filesystem::path const& decomposition, vec_mp *pi, int num_vars)
+{
+#ifdef functionentry_output
+	std::cout << "SphereIndependentStages::Fetch" << std::endl;
+#endif
+
+	boost::filesystem::path source = decomposition / FolderName();
+	if (!boost::filesystem::is_regular_file(source / "key")) {
+		std::cout << color::red() << decomposition << " has no sphere-independent stages to reuse.  computing them." << color::console_default() << std::endl;
+		return false;
+	}
+
+	if (boost::filesystem::exists(WorkspaceCopy()))
+		boost::filesystem::remove_all(WorkspaceCopy());
+	boost::filesystem::create_directory(WorkspaceCopy());
+	for (boost::filesystem::directory_iterator iter(source), end; iter!=end; ++iter)
+		boost::filesystem::copy_file(iter->path(), WorkspaceCopy() / iter->path().filename());
+
+
+	FILE *IN = safe_fopen_read(WorkspaceCopy() / "key");
+	int dim, comp, stored_num_vars, num_projections;
+	fscanf(IN, "%d %d %d %d", &dim, &comp, &stored_num_vars, &num_projections);
+	if (stored_num_vars!=num_vars || num_projections!=2) {
+		fclose(IN);
+		std::cout << color::red() << "the stages in " << decomposition << " are for another system.  computing them." << color::console_default() << std::endl;
+		return false;
+	}
+
+	for (int ii=0; ii<num_projections; ii++)
+		ReadVec(IN, pi[ii]);
+	fclose(IN);
+
+	return true;
+}
+
+
+
+
+void SphereIndependentStages::Write(boost::filesystem::path const& folder, boost::filesystem::path const& input_file, WitnessSet const& W_surf, vec_mp *pi) const
+{
+#ifdef functionentry_output
+	std::cout << "SphereIndependentStages::Write" << std::endl;
+#endif
+
+	if (boost::filesystem::exists(folder))
+		boost::filesystem::remove_all(folder);
+	boost::filesystem::create_directories(folder);
+
+
+	FILE *OUT = safe_fopen_write(folder / "key");
+	fprintf(OUT, "%d %d %d %d\n", W_surf.dimension(), W_surf.component_number(), W_surf.num_variables(), 2);
+	for (int ii=0; ii<2; ii++)
+		WriteVec(OUT, pi[ii]);
+	fclose(OUT);
+
+	boost::filesystem::copy_file(input_file, folder / "input");
+
+
+	// the systems the witness sets refer to, which are in the workspace, or next to the input file
+	std::set<boost::filesystem::path> systems;
+	systems.insert(critcurve.input_filename());
+	for (auto iter = split_sets.begin(); iter!=split_sets.end(); ++iter)
+		systems.insert(iter->second.input_filename());
+	for (auto const& system : systems)
+		if (boost::filesystem::is_regular_file(system))
+			boost::filesystem::copy_file(system, folder / ("system_" + system.filename().string()));
+
+
+	WriteStage(critcurve, folder / "critcurve");
+	WriteStage(critcurve_crit, folder / "critcurve_crit");
+	WriteStage(singular_points_on_critical_curve, folder / "singular_points_on_critical_curve");
+
+	OUT = safe_fopen_write(folder / "singular_curves");
+	fprintf(OUT, "%zu\n", split_sets.size());
+	for (auto iter = split_sets.begin(); iter!=split_sets.end(); ++iter)
+	{
+		fprintf(OUT, "%u %u\n", iter->first.multiplicity(), iter->first.index());
+		WriteStage(iter->second, folder / StageName("split_set", iter->first));
+		WriteStage(singular_crit.at(iter->first), folder / StageName("singular_crit", iter->first));
+		WriteStage(singular_points_on_singular_curve.at(iter->first), folder / StageName("singular_points_on_singular_curve", iter->first));
+	}
+	fclose(OUT);
+}
+
+
+
+
+bool SphereIndependentStages::Read(boost::filesystem::path const& input_file, WitnessSet const& W_surf, vec_mp *pi)
+{
+#ifdef functionentry_output
+	std::cout << "SphereIndependentStages::Read" << std::endl;
+#endif
+
+	boost::filesystem::path folder = WorkspaceCopy();
+	if (!boost::filesystem::is_regular_file(folder / "key"))
+		return false;
+
+
+	FILE *IN = safe_fopen_read(folder / "key");
+	int dim, comp, num_vars, num_projections;
+	fscanf(IN, "%d %d %d %d", &dim, &comp, &num_vars, &num_projections);
+
+	bool same = dim==W_surf.dimension() && comp==W_surf.component_number() && num_vars==W_surf.num_variables() && num_projections==2;
+
+	vec_mp stored_pi;  init_vec_mp2(stored_pi, 0, 1024);
+	for (int ii=0; ii<num_projections && same; ii++) {
+		ReadVec(IN, stored_pi);
+		same = stored_pi->size==pi[ii]->size && isSamePoint_inhomogeneous_input(stored_pi, pi[ii], 1e-10);
+	}
+	clear_vec_mp(stored_pi);
+	fclose(IN);
+
+	same = same && Contents(folder / "input")==Contents(input_file);
+
+	if (!same) {
+		std::cout << color::red() << "the stages to reuse are for another component, input file or projection.  computing them." << color::console_default() << std::endl;
+		return false;
+	}
+
+
+
+	ReadStage(critcurve, folder / "critcurve");
+	ReadStage(critcurve_crit, folder / "critcurve_crit");
+	ReadStage(singular_points_on_critical_curve, folder / "singular_points_on_critical_curve");
+
+	IN = safe_fopen_read(folder / "singular_curves");
+	int num_singular_curves;
+	fscanf(IN, "%d", &num_singular_curves);
+	for (int ii=0; ii<num_singular_curves; ii++)
+	{
+		unsigned int mult, index;
+		fscanf(IN, "%u %u", &mult, &index);
+		SingularObjectMetadata curr_index(mult, index);
+
+		ReadStage(split_sets[curr_index], folder / StageName("split_set", curr_index));
+		ReadStage(singular_crit[curr_index], folder / StageName("singular_crit", curr_index));
+		ReadStage(singular_points_on_singular_curve[curr_index], folder / StageName("singular_points_on_singular_curve", curr_index));
+	}
+	fclose(IN);
+
+
+	// the systems go into the workspace, under the names the witness sets have for them
+	for (boost::filesystem::directory_iterator iter(folder), end; iter!=end; ++iter)
+	{
+		std::string name = iter->path().filename().string();
+		if (name.compare(0, 7, "system_")==0) {
+			boost::filesystem::remove(name.substr(7));
+			boost::filesystem::copy_file(iter->path(), name.substr(7));
+		}
+	}
+
+	return true;
+}
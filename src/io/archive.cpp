@@ -0,0 +1,221 @@
+#include "io/archive.hpp"
+#include "io/fileops.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+
+namespace {
+
+	const char kArchiveMagic[8] = {'B','R','A','R','C','H','V','1'};
+
+
+	void WriteUInt(FILE *OUT, uint64_t val)
+	{
+		if (fwrite(&val, sizeof(uint64_t), 1, OUT)!=1)
+			throw std::runtime_error("failed to write integer to decomposition archive");
+	}
+
+	uint64_t ReadUInt(FILE *IN, boost::filesystem::path const& filename)
+	{
+		uint64_t val;
+		if (fread(&val, sizeof(uint64_t), 1, IN)!=1)
+			throw std::runtime_error("premature end of decomposition archive " + filename.string());
+		return val;
+	}
+
+
+	/**
+	 \brief the path of a file found by iterating over base, relative to base.  boost's lexically_relative would do, but only from 1.60.
+	 */
+	std::string RelativeName(boost::filesystem::path const& file, boost::filesystem::path const& base)
+	{
+		boost::filesystem::path::const_iterator iter = file.begin();
+		for (boost::filesystem::path::const_iterator b = base.begin(); b!=base.end() && iter!=file.end(); ++b)
+			if (*b==*iter) // a trailing separator on base iterates as ".", which the file's path does not have
+				++iter;
+
+		boost::filesystem::path relative;
+		for (; iter!=file.end(); ++iter)
+			relative /= *iter;
+		return relative.generic_string();
+	}
+
+} // re: anonymous namespace
+
+
+
+
+void DecompositionArchive::Pack(boost::filesystem::path const& base, boost::filesystem::path const& archive_name)
+{
+#ifdef functionentry_output
+	std::cout << "DecompositionArchive::Pack" << std::endl;
+#endif
+
+	if (!boost::filesystem::is_directory(base))
+		throw std::runtime_error("trying to pack " + base.string() + " into an archive, but it is not a directory");
+
+
+	// collect the names first, so the archive is deterministic in its order.
+	std::vector<std::string> names;
+	for (boost::filesystem::recursive_directory_iterator iter(base), end; iter!=end; ++iter)
+	{
+		if (!boost::filesystem::is_regular_file(iter->status()))
+			continue;
+
+		std::string leaf = iter->path().filename().string();
+		if (leaf.empty() || leaf[0]=='.' || iter->path().filename()==archive_name.filename() || iter->path().extension()==".partial")
+			continue;
+
+		names.push_back(RelativeName(iter->path(), base));
+	}
+	std::sort(names.begin(), names.end());
+
+
+
+	boost::filesystem::path temp_name = archive_name;
+	temp_name += ".partial";
+
+	FILE *OUT = safe_fopen_write(temp_name);
+
+	fwrite(kArchiveMagic, 1, sizeof(kArchiveMagic), OUT);
+	WriteUInt(OUT, 0); // placeholder for the toc offset, filled in at the end.
+
+
+	std::vector<TocEntry> entries(names.size());
+	std::vector<char> buffer(1<<16);
+	for (size_t ii=0; ii<names.size(); ii++)
+	{
+		entries[ii].offset = static_cast<uint64_t>(ftello(OUT));
+
+		FILE *IN = safe_fopen_read(base / names[ii]);
+		uint64_t total = 0;
+		size_t num_read;
+		while ( (num_read = fread(buffer.data(), 1, buffer.size(), IN)) > 0)
+		{
+			fwrite(buffer.data(), 1, num_read, OUT);
+			total += num_read;
+		}
+		fclose(IN);
+
+		entries[ii].size = total;
+	}
+
+
+	uint64_t toc_offset = static_cast<uint64_t>(ftello(OUT));
+	WriteUInt(OUT, names.size());
+	for (size_t ii=0; ii<names.size(); ii++)
+	{
+		WriteUInt(OUT, names[ii].size());
+		fwrite(names[ii].c_str(), 1, names[ii].size(), OUT);
+		WriteUInt(OUT, entries[ii].offset);
+		WriteUInt(OUT, entries[ii].size);
+	}
+
+	fseeko(OUT, sizeof(kArchiveMagic), SEEK_SET);
+	WriteUInt(OUT, toc_offset);
+
+	if (fclose(OUT)!=0)
+		throw std::runtime_error("failed to finish writing decomposition archive " + temp_name.string());
+
+	boost::filesystem::rename(temp_name, archive_name);
+}
+
+
+
+
+
+DecompositionArchive::DecompositionArchive(boost::filesystem::path const& archive_name) : filename_(archive_name)
+{
+	IN_ = safe_fopen_read(archive_name);
+
+	char magic[sizeof(kArchiveMagic)];
+	if (fread(magic, 1, sizeof(magic), IN_)!=sizeof(magic) || memcmp(magic, kArchiveMagic, sizeof(magic))!=0)
+	{
+		fclose(IN_);
+		throw std::runtime_error(archive_name.string() + " is not a bertini_real decomposition archive");
+	}
+
+	try{
+		uint64_t toc_offset = ReadUInt(IN_, filename_);
+		fseeko(IN_, static_cast<off_t>(toc_offset), SEEK_SET);
+
+		uint64_t num_chunks = ReadUInt(IN_, filename_);
+		for (uint64_t ii=0; ii<num_chunks; ii++)
+		{
+			uint64_t name_length = ReadUInt(IN_, filename_);
+			std::string name(name_length, '\0');
+			if (name_length>0 && fread(&name[0], 1, name_length, IN_)!=name_length)
+				throw std::runtime_error("premature end of decomposition archive " + filename_.string());
+
+			TocEntry entry;
+			entry.offset = ReadUInt(IN_, filename_);
+			entry.size = ReadUInt(IN_, filename_);
+			toc_[name] = entry;
+		}
+	}
+	catch (...)
+	{
+		fclose(IN_);
+		throw;
+	}
+}
+
+
+DecompositionArchive::~DecompositionArchive()
+{
+	fclose(IN_);
+}
+
+
+
+
+std::vector<std::string> DecompositionArchive::ChunkNames() const
+{
+	std::vector<std::string> names;
+	for (auto iter=toc_.begin(); iter!=toc_.end(); ++iter)
+		names.push_back(iter->first);
+	return names;
+}
+
+
+
+
+const std::string & DecompositionArchive::ReadChunk(std::string const& name) const
+{
+	auto cached = cache_.find(name);
+	if (cached!=cache_.end())
+		return cached->second;
+
+	auto entry = toc_.find(name);
+	if (entry==toc_.end())
+		throw std::out_of_range("decomposition archive " + filename_.string() + " has no chunk named " + name);
+
+	std::string contents(entry->second.size, '\0');
+	fseeko(IN_, static_cast<off_t>(entry->second.offset), SEEK_SET);
+	if (entry->second.size>0 && fread(&contents[0], 1, entry->second.size, IN_)!=entry->second.size)
+		throw std::runtime_error("failed to read chunk " + name + " from decomposition archive " + filename_.string());
+
+	return cache_[name] = std::move(contents);
+}
+
+
+
+
+FILE * DecompositionArchive::OpenChunk(std::string const& name) const
+{
+	const std::string & contents = ReadChunk(name);
+
+	// fmemopen refuses a zero-length buffer on some platforms, so an empty chunk gets an empty temporary file instead.
+	FILE *IN;
+	if (contents.empty())
+		IN = tmpfile();
+	else
+		IN = fmemopen(const_cast<char*>(contents.data()), contents.size(), "r");
+
+	if (IN==NULL)
+		throw std::runtime_error("failed to open in-memory stream for chunk " + name);
+
+	return IN;
+}
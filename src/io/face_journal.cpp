@@ -0,0 +1,295 @@
+#include "io/face_journal.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <unistd.h>
+
+
+namespace {
+
+	const char kJournalMagic[8] = {'B','R','F','J','R','N','L','1'};
+	const uint32_t kRecordBegin = 0x45434146; // "FACE"
+	const uint32_t kRecordEnd = 0x454e4f44; // "DONE"
+
+
+	template<typename T>
+	void WriteValue(FILE *OUT, T val)
+	{
+		fwrite(&val, sizeof(T), 1, OUT);
+	}
+
+	template<typename T>
+	T ReadValue(FILE *IN)
+	{
+		T val;
+		if (fread(&val, sizeof(T), 1, IN)!=1)
+			throw std::runtime_error("premature end of face journal");
+		return val;
+	}
+
+
+	bool SamePoint(VertexSet & V, long long index, vec_mp testpoint)
+	{
+		if (V[index].point()->size != testpoint->size)
+			return false;
+
+		vec_mp dehom_left, dehom_right;
+		init_vec_mp(dehom_left,0); dehom_left->size = 0;
+		init_vec_mp(dehom_right,0); dehom_right->size = 0;
+
+		dehomogenize(&dehom_left, V[index].point());
+		dehomogenize(&dehom_right, testpoint);
+
+		bool same = isSamePoint_inhomogeneous_input(dehom_left, dehom_right, V.same_point_tolerance());
+
+		clear_vec_mp(dehom_left); clear_vec_mp(dehom_right);
+		return same;
+	}
+
+} // re: anonymous namespace
+
+
+
+
+FaceJournal::FaceJournal(boost::filesystem::path const& output_dir, std::string const& run_name, std::string const& signature, unsigned num_faces) : signature_(signature), num_faces_(num_faces)
+{
+#ifdef functionentry_output
+	std::cout << "FaceJournal::FaceJournal" << std::endl;
+#endif
+
+	auto journal_dir = Directory(output_dir);
+	boost::filesystem::create_directories(journal_dir);
+
+	filename_ = journal_dir / (run_name + ".journal");
+
+
+	// read in sorted order, so which journal wins for a duplicated face is predictable.
+	std::vector<boost::filesystem::path> journal_names;
+	for (boost::filesystem::directory_iterator iter(journal_dir), end; iter!=end; ++iter)
+		if (boost::filesystem::is_regular_file(iter->status()) && iter->path().extension()==".journal")
+			journal_names.push_back(iter->path());
+	std::sort(journal_names.begin(), journal_names.end());
+
+
+	long own_valid_end = -1;
+	for (auto const& name : journal_names)
+	{
+		long valid_end = ReadJournal(name);
+
+		if (valid_end<0)
+			std::cout << color::magenta() << "ignoring face journal " << name << ", which was written with different sampler settings" << color::console_default() << std::endl;
+
+		if (name.filename()==filename_.filename())
+			own_valid_end = valid_end;
+	}
+
+
+	if (own_valid_end<0)
+	{
+		OUT_ = safe_fopen_write(filename_);
+		WriteHeader(OUT_);
+		fflush(OUT_);
+	}
+	else
+	{
+		// drop any partially written record at the end, left by a run which died.
+		if (boost::filesystem::file_size(filename_) != static_cast<uintmax_t>(own_valid_end))
+			boost::filesystem::resize_file(filename_, own_valid_end);
+
+		OUT_ = fopen(filename_.c_str(), "ab");
+		if (OUT_==NULL)
+			throw std::runtime_error("unable to open face journal " + filename_.string() + " for appending");
+	}
+}
+
+
+
+FaceJournal::~FaceJournal()
+{
+	fclose(OUT_);
+}
+
+
+
+
+void FaceJournal::WriteHeader(FILE *OUT) const
+{
+	fwrite(kJournalMagic, 1, sizeof(kJournalMagic), OUT);
+	WriteValue<uint64_t>(OUT, signature_.size());
+	fwrite(signature_.c_str(), 1, signature_.size(), OUT);
+	WriteValue<int32_t>(OUT, num_faces_);
+}
+
+
+bool FaceJournal::ReadHeader(FILE *IN) const
+{
+	char magic[sizeof(kJournalMagic)];
+	if (fread(magic, 1, sizeof(magic), IN)!=sizeof(magic) || memcmp(magic, kJournalMagic, sizeof(magic))!=0)
+		return false;
+
+	try{
+		uint64_t signature_length = ReadValue<uint64_t>(IN);
+		if (signature_length!=signature_.size())
+			return false;
+
+		std::string signature(signature_length, '\0');
+		if (signature_length>0 && fread(&signature[0], 1, signature_length, IN)!=signature_length)
+			return false;
+
+		return signature==signature_ && ReadValue<int32_t>(IN)==static_cast<int32_t>(num_faces_);
+	}
+	catch (std::runtime_error & e)
+	{
+		return false;
+	}
+}
+
+
+
+long FaceJournal::ReadJournal(boost::filesystem::path const& journal_name)
+{
+	FILE *IN = safe_fopen_read(journal_name);
+
+	if (!ReadHeader(IN))
+	{
+		fclose(IN);
+		return -1;
+	}
+
+	long valid_end = ftell(IN);
+
+	while (true)
+	{
+		uint32_t begin;
+		if (fread(&begin, sizeof(uint32_t), 1, IN)!=1 || begin!=kRecordBegin)
+			break;
+
+		FaceRecord record;
+		try{
+			record.face_index = ReadValue<int32_t>(IN);
+
+			int32_t num_vertices = ReadValue<int32_t>(IN);
+			record.vertices.resize(num_vertices);
+			for (auto & v : record.vertices)
+			{
+				v.original_index = ReadValue<int64_t>(IN);
+				v.vertex.set_type(static_cast<VertexType>(ReadValue<int32_t>(IN)));
+				read_vec_mp_raw(v.vertex.point(), IN);
+			}
+
+			int32_t num_triangles = ReadValue<int32_t>(IN);
+			record.triangles.resize(3*num_triangles);
+			for (auto & t : record.triangles)
+				t = ReadValue<int32_t>(IN);
+
+			if (ReadValue<uint32_t>(IN)!=kRecordEnd)
+				break;
+		}
+		catch (std::runtime_error & e)
+		{
+			break;
+		}
+
+		if (record.face_index<0 || record.face_index>=static_cast<int>(num_faces_))
+			break;
+
+		valid_end = ftell(IN);
+		completed_.insert(record.face_index);
+		records_.push_back(std::move(record));
+	}
+
+	fclose(IN);
+	return valid_end;
+}
+
+
+
+
+unsigned FaceJournal::Replay(VertexSet & V, std::vector< std::vector< Triangle > > & samples)
+{
+	std::set<int> replayed;
+
+	for (auto const& record : records_)
+	{
+		if (!replayed.insert(record.face_index).second)
+			continue;
+
+		std::vector<long long> global_index(record.vertices.size());
+		for (unsigned ii=0; ii<record.vertices.size(); ii++)
+		{
+			auto const& v = record.vertices[ii];
+			vec_mp& point = const_cast<Vertex&>(v.vertex).point();
+
+			if (v.original_index>=0 && v.original_index<V.num_vertices() && SamePoint(V, v.original_index, point))
+				global_index[ii] = v.original_index;
+			else
+			{
+				int found = (v.original_index>=0) ? V.search_for_point(point) : -1;
+				global_index[ii] = (found>=0) ? found : V.add_vertex(v.vertex);
+			}
+		}
+
+		std::vector< Triangle > & face_samples = samples[record.face_index];
+		face_samples.clear();
+		for (unsigned ii=0; ii+2<record.triangles.size(); ii+=3)
+			face_samples.push_back(Triangle(global_index[record.triangles[ii]],
+											global_index[record.triangles[ii+1]],
+											global_index[record.triangles[ii+2]]));
+	}
+
+	records_.clear(); // the points are in V now, and need not be kept twice.
+	return replayed.size();
+}
+
+
+
+
+void FaceJournal::Record(int face_index, std::vector< Triangle > const& triangles, VertexSet & V, unsigned first_new_vertex)
+{
+	// number the vertices used by the triangles, in order of first appearance.
+	std::map<long long, int> local_index;
+	std::vector<long long> used;
+	auto local = [&](long long global)
+	{
+		auto iter = local_index.find(global);
+		if (iter!=local_index.end())
+			return iter->second;
+
+		int new_index = used.size();
+		local_index[global] = new_index;
+		used.push_back(global);
+		return new_index;
+	};
+
+	std::vector<int32_t> local_triangles;
+	for (auto const& t : triangles)
+	{
+		local_triangles.push_back(local(t.v1()));
+		local_triangles.push_back(local(t.v2()));
+		local_triangles.push_back(local(t.v3()));
+	}
+
+
+	WriteValue<uint32_t>(OUT_, kRecordBegin);
+	WriteValue<int32_t>(OUT_, face_index);
+
+	WriteValue<int32_t>(OUT_, used.size());
+	for (auto global : used)
+	{
+		WriteValue<int64_t>(OUT_, global<static_cast<long long>(first_new_vertex) ? global : -1);
+		WriteValue<int32_t>(OUT_, V[global].type());
+		write_vec_mp_raw(OUT_, V[global].point());
+	}
+
+	WriteValue<int32_t>(OUT_, triangles.size());
+	fwrite(local_triangles.data(), sizeof(int32_t), local_triangles.size(), OUT_);
+
+	WriteValue<uint32_t>(OUT_, kRecordEnd);
+
+	if (fflush(OUT_)!=0 || fsync(fileno(OUT_))!=0)
+		throw std::runtime_error("failed to flush face journal " + filename_.string());
+
+	completed_.insert(face_index);
+}
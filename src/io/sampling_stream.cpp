@@ -0,0 +1,87 @@
+#include "io/sampling_stream.hpp"
+
+
+
+
+
+SamplingStream::SamplingStream(boost::filesystem::path const& filename, int num_natural_variables) : num_natural_variables_(num_natural_variables), num_written_vertices_(0)
+{
+	OUT_ = safe_fopen_write(filename);
+
+	fprintf(OUT_, "bertini_real_stream 1 %d\n", num_natural_variables_-1);
+	fflush(OUT_);
+}
+
+
+SamplingStream::~SamplingStream()
+{
+	fclose(OUT_);
+}
+
+
+
+
+void SamplingStream::SyncVertices(VertexSet const& V)
+{
+	if (V.num_vertices()<=num_written_vertices_)
+		return;
+
+	fprintf(OUT_, "vertices %u %u\n", num_written_vertices_, V.num_vertices()-num_written_vertices_);
+
+	for (unsigned ii=num_written_vertices_; ii<V.num_vertices(); ii++)
+	{
+		const vec_mp & p = V[ii].point();
+
+		// the real part of coord[jj]/coord[0], in double.  plenty for display.
+		double hr = mpf_get_d(p->coord[0].r), hi = mpf_get_d(p->coord[0].i);
+		double h_norm_sq = hr*hr + hi*hi;
+		for (int jj=1; jj<num_natural_variables_; jj++)
+		{
+			double cr = mpf_get_d(p->coord[jj].r), ci = mpf_get_d(p->coord[jj].i);
+			fprintf(OUT_, jj==1 ? "%.15g" : " %.15g", (cr*hr + ci*hi)/h_norm_sq);
+		}
+		fprintf(OUT_, "\n");
+	}
+	fprintf(OUT_, "end\n");
+
+	num_written_vertices_ = V.num_vertices();
+}
+
+
+
+
+void SamplingStream::Face(int face_index, int level, std::vector< Triangle > const& triangles, VertexSet const& V)
+{
+	SyncVertices(V);
+
+	fprintf(OUT_, "face %d %d %zu\n", face_index, level, triangles.size());
+	for (auto const& t : triangles)
+		fprintf(OUT_, "%lld %lld %lld\n", t.v1(), t.v2(), t.v3());
+	fprintf(OUT_, "end\n");
+
+	fflush(OUT_);
+}
+
+
+
+
+void SamplingStream::Edge(std::string const& curve_name, int edge_index, int level, std::vector<int> const& indices, VertexSet const& V)
+{
+	SyncVertices(V);
+
+	fprintf(OUT_, "edge %s %d %d %zu\n", curve_name.c_str(), edge_index, level, indices.size());
+	for (unsigned ii=0; ii<indices.size(); ii++)
+		fprintf(OUT_, ii==0 ? "%d" : " %d", indices[ii]);
+	fprintf(OUT_, "\nend\n");
+
+	fflush(OUT_);
+}
+
+
+
+
+void SamplingStream::Finish()
+{
+	fprintf(OUT_, "done\n");
+	fflush(OUT_);
+}
@@ -0,0 +1,224 @@
+#include "job_service.hpp"
+#include "run_profile.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <getopt.h>
+#include <stdexcept>
+#include <unistd.h>
+
+
+namespace {
+
+	/**
+	 \brief broadcast a list of strings from the head, as their lengths and then their characters.
+	 */
+	void bcast_strings(std::vector<std::string> & strings, ParallelismConfig const& mpi_config)
+	{
+		int num_strings = strings.size();
+		MPI_Bcast(&num_strings, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
+
+		std::vector<int> lengths(num_strings);
+		if (mpi_config.is_head())
+			for (int ii=0; ii<num_strings; ii++)
+				lengths[ii] = strings[ii].size();
+		if (num_strings>0)
+			MPI_Bcast(&lengths[0], num_strings, MPI_INT, mpi_config.head(), mpi_config.comm());
+
+		strings.resize(num_strings);
+		for (int ii=0; ii<num_strings; ii++) {
+			strings[ii].resize(lengths[ii]);
+			if (lengths[ii]>0)
+				MPI_Bcast(&strings[ii][0], lengths[ii], MPI_CHAR, mpi_config.head(), mpi_config.comm());
+		}
+	}
+
+
+	/**
+	 \brief make getopt start over, for the next command line parsed in this process.
+	 */
+	void reset_getopt()
+	{
+#ifdef __GLIBC__
+		optind = 0; // glibc reinitializes when optind is 0
+#else
+		optind = 1;
+		optreset = 1;
+#endif
+	}
+
+} // re: anonymous namespace
+
+
+
+
+JobService::JobService(boost::filesystem::path const& queue, ParallelismConfig const& mpi_config) : queue_(boost::filesystem::absolute(queue)), mpi_config_(mpi_config)
+{
+	if (mpi_config_.is_head())
+		boost::filesystem::create_directories(queue_);
+}
+
+
+
+
+int JobService::Serve()
+{
+	if (mpi_config_.is_head())
+		std::cout << "serving jobs from " << queue_ << " on " << mpi_config_.num_procs() << " processes.  create " << queue_ / "stop" << " to stop." << std::endl;
+
+	int num_failed = 0;
+	while (1)
+	{
+		std::vector<std::string> job; // empty means stop
+		std::string name;
+		if (mpi_config_.is_head())
+			if (!Claim(job, name))
+				job.clear();
+
+		if (mpi_config_.use_parallel())
+			bcast_strings(job, mpi_config_);
+
+		if (job.empty())
+			break;
+
+		boost::filesystem::path log;
+		if (mpi_config_.is_head())
+			log = queue_ / (name + ".log");
+
+		int failed = Run(job, log)!=0;
+
+		// the job failed if it failed on any process.  every process knows it, and goes on to the next job together.
+		if (mpi_config_.use_parallel())
+			MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_MAX, mpi_config_.comm());
+
+		if (mpi_config_.is_head()) {
+			if (failed)
+				num_failed++;
+			Mark(name, ".running", failed ? ".failed" : ".done");
+			std::cout << "job " << name << (failed ? " failed" : " done") << std::endl;
+		}
+	}
+
+	return num_failed;
+}
+
+
+
+
+bool JobService::Claim(std::vector<std::string> & job, std::string & name) const
+{
+	while (1)
+	{
+		if (boost::filesystem::exists(queue_ / "stop")) {
+			boost::system::error_code ec;
+			boost::filesystem::remove(queue_ / "stop", ec);
+			return false;
+		}
+
+		std::vector<std::string> waiting;
+		for (boost::filesystem::directory_iterator iter(queue_), end; iter!=end; ++iter)
+			if (iter->path().extension()==".job" && boost::filesystem::is_regular_file(iter->path()))
+				waiting.push_back(iter->path().stem().string());
+		std::sort(waiting.begin(), waiting.end());
+
+		for (auto const& candidate : waiting)
+		{
+			boost::system::error_code ec;
+			boost::filesystem::rename(queue_ / (candidate + ".job"), queue_ / (candidate + ".running"), ec);
+			if (ec)
+				continue; // someone else took it
+
+			job.clear();
+			std::ifstream fin((queue_ / (candidate + ".running")).string());
+			std::string line;
+			while (std::getline(fin, line))
+				if (!line.empty() || job.size()>=2) // a blank argument is an argument
+					job.push_back(line);
+
+			std::string problem;
+			if (job.size()<2)
+				problem = "a job needs at least a program and a folder";
+			else if (programs_.find(job[0])==programs_.end())
+				problem = "unknown program '" + job[0] + "'";
+			else if (!boost::filesystem::is_directory(job[1]))
+				problem = "no such folder " + job[1];
+
+			if (problem.empty()) {
+				name = candidate;
+				return true;
+			}
+
+			std::ofstream((queue_ / (candidate + ".log")).string()) << problem << std::endl;
+			Mark(candidate, ".running", ".failed");
+			std::cout << "job " << candidate << " failed: " << problem << std::endl;
+		}
+
+		sleep(poll_seconds_);
+	}
+}
+
+
+
+
+int JobService::Run(std::vector<std::string> const& job, boost::filesystem::path const& log) const
+{
+	boost::filesystem::path served_from = boost::filesystem::current_path();
+
+	int saved_stdout = -1;
+	if (!log.empty()) {
+		fflush(stdout); std::cout.flush();
+		saved_stdout = dup(STDOUT_FILENO);
+		int log_fd = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (log_fd>=0) {
+			dup2(log_fd, STDOUT_FILENO);
+			close(log_fd);
+		}
+	}
+
+	std::vector<std::string> args(job.begin()+2, job.end());
+	args.insert(args.begin(), job[0]);
+	std::vector<char*> argv;
+	for (auto & arg : args)
+		argv.push_back(&arg[0]);
+	argv.push_back(NULL);
+
+	int status;
+	try{
+		if (chdir(job[1].c_str())!=0)
+			throw std::runtime_error("unable to move into the job's folder " + job[1]);
+
+		reset_getopt();
+		RunProfile::Instance().Reset();
+		status = programs_.at(job[0])(int(args.size()), &argv[0]);
+	}
+	catch (std::exception & e)
+	{
+		std::cout << "uncaught exception from job " << job[0] << ":" << std::endl;
+		std::cout << e.what() << std::endl;
+		status = 1;
+	}
+
+	if (chdir(served_from.c_str())!=0)
+		throw std::runtime_error("unable to move back to " + served_from.string());
+
+	if (saved_stdout>=0) {
+		fflush(stdout); std::cout.flush();
+		dup2(saved_stdout, STDOUT_FILENO);
+		close(saved_stdout);
+	}
+
+	return status;
+}
+
+
+
+
+void JobService::Mark(std::string const& name, std::string const& from, std::string const& to) const
+{
+	boost::system::error_code ec;
+	boost::filesystem::rename(queue_ / (name + from), queue_ / (name + to), ec);
+	if (ec)
+		std::cout << "unable to mark job " << name << " " << to << ": " << ec.message() << std::endl;
+}
@@ -1,4 +1,6 @@
 #include "nag/nid.hpp"
+#include <fstream>
+#include <iterator>
 
 
 
@@ -9,8 +11,8 @@ void NumericalIrreducibleDecomposition::populate(tracker_config_t * T)
 	FILE *IN;
 
 
-
-	IN = safe_fopen_read("witness_data");
+	filename_ = boost::filesystem::absolute("witness_data");
+	IN = safe_fopen_read(filename_);
 
 
 	int num_nonempty_codims;
@@ -20,9 +22,6 @@ void NumericalIrreducibleDecomposition::populate(tracker_config_t * T)
 
 
 
-	vec_mp prev_approx;
-	init_vec_mp(prev_approx,num_variables_); prev_approx->size = num_variables_;
-
 	vec_mp temp_vec;
 	init_vec_mp(temp_vec,num_variables_); temp_vec->size = num_variables_;
 
@@ -46,24 +45,14 @@ void NumericalIrreducibleDecomposition::populate(tracker_config_t * T)
 
 		for (int jj=0; jj<num_points_this_dim; jj++) {
 
+			// only the metadata is read now.  the coordinates are skipped, and read by solution() if the point is ever wanted.
+			long offset = ftell(IN);
 
 			int precision;
-			// last approximation
-			fscanf(IN,"%d",&precision);
-			change_prec_vec_mp(temp_vec,precision);
-			for (int kk=0; kk<num_variables_; kk++) {
-				mpf_inp_str(temp_vec->coord[kk].r, IN, 10); // 10 is the base
-				mpf_inp_str(temp_vec->coord[kk].i, IN, 10);
-			}
-
-
-
-			// previous approximation
-			fscanf(IN,"%d",&precision);
-			change_prec_vec_mp(temp_vec,precision);
-			for (int kk=0; kk<num_variables_; kk++) {
-				mpf_inp_str(prev_approx->coord[kk].r, IN, 10); // 10 is the base
-				mpf_inp_str(prev_approx->coord[kk].i, IN, 10);
+			for (int approximation=0; approximation<2; approximation++) { // the last approximation, and the previous one
+				fscanf(IN,"%d",&precision);
+				for (int kk=0; kk<2*num_variables_; kk++)
+					fscanf(IN,"%*s");
 			}
 
 
@@ -72,7 +61,7 @@ void NumericalIrreducibleDecomposition::populate(tracker_config_t * T)
 			meta.set_from_file(IN);
 
 
-			int index = add_solution(temp_vec, meta);
+			int index = add_solution(offset, meta);
 
 			int num_existing_pts_this_comp = map_lookup_with_default( dimension_component_counter[current_dimension], meta.component_number(), 0 ); // the right hand 0 is the default if not found
 
@@ -231,7 +220,7 @@ void NumericalIrreducibleDecomposition::populate(tracker_config_t * T)
 	fclose(IN);
 
 	free(temp_rat);
-	clear_vec_mp(temp_vec); clear_vec_mp(prev_approx);
+	clear_vec_mp(temp_vec);
 
 	return;
 }
@@ -241,6 +230,80 @@ void NumericalIrreducibleDecomposition::populate(tracker_config_t * T)
 
 
 
+vec_mp & NumericalIrreducibleDecomposition::solution(int index)
+{
+	if (loaded_index_[index]<0) {
+		FILE *IN = safe_fopen_read(filename_);
+		if (fseek(IN, point_offsets_[index], SEEK_SET)!=0)
+			throw std::runtime_error("unable to seek to point " + std::to_string(index) + " in " + filename_.string());
+
+		int precision;
+		fscanf(IN,"%d",&precision);
+
+		vec_mp temp_vec;  init_vec_mp2(temp_vec,num_variables_,precision); temp_vec->size = num_variables_;
+		for (int kk=0; kk<num_variables_; kk++) {
+			mpf_inp_str(temp_vec->coord[kk].r, IN, 10); // 10 is the base
+			mpf_inp_str(temp_vec->coord[kk].i, IN, 10);
+		}
+		fclose(IN);
+
+		loaded_index_[index] = add_point(temp_vec);
+		clear_vec_mp(temp_vec);
+	}
+
+	return point(loaded_index_[index]);
+}
+
+
+
+
+void NumericalIrreducibleDecomposition::write_with_points(boost::filesystem::path const& filename, std::map<int, vec_mp*> const& replacements) const
+{
+#ifdef functionentry_output
+	std::cout << "NumericalIrreducibleDecomposition::write_with_points" << std::endl;
+#endif
+
+	std::ifstream fin(filename_.string());
+	std::string text((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+	if (!fin && !fin.eof())
+		throw std::runtime_error("unable to read " + filename_.string());
+
+	// the points appear in the file in the order of their indices, so their offsets increase.
+	FILE *OUT = safe_fopen_write(filename);
+	size_t position = 0;
+	for (auto iter=replacements.begin(); iter!=replacements.end(); ++iter)
+	{
+		size_t offset = point_offsets_.at(iter->first);
+		fwrite(text.data()+position, 1, offset-position, OUT);
+
+		// skip the old approximations, each its precision followed by the real and imaginary parts of the coordinates
+		int precision = atoi(text.c_str()+text.find_first_not_of(" \t\r\n", offset));
+		position = offset;
+		for (int token=0; token<2*(1+2*num_variables_); token++) {
+			position = text.find_first_not_of(" \t\r\n", position);
+			position = text.find_first_of(" \t\r\n", position);
+		}
+
+		vec_mp & new_point = *(iter->second);
+		for (int approximation=0; approximation<2; approximation++) {
+			fprintf(OUT, "\n%d\n", precision);
+			for (int kk=0; kk<num_variables_; kk++) {
+				mpf_out_str(OUT, 10, 0, new_point->coord[kk].r);
+				fprintf(OUT, " ");
+				mpf_out_str(OUT, 10, 0, new_point->coord[kk].i);
+				fprintf(OUT, "\n");
+			}
+		}
+	}
+	fwrite(text.data()+position, 1, text.size()-position, OUT);
+	fclose(OUT);
+}
+
+
+
+
+
+
 WitnessSet NumericalIrreducibleDecomposition::choose(BertiniRealConfig & options)
 {
 #ifdef functionentry_output
@@ -348,6 +411,51 @@ WitnessSet NumericalIrreducibleDecomposition::choose(BertiniRealConfig & options
 
 
 
+std::vector<int> NumericalIrreducibleDecomposition::choose_batch(BertiniRealConfig & options, int & dim)
+{
+#ifdef functionentry_output
+	std::cout << "NumericalIrreducibleDecomposition::choose_batch" << std::endl;
+#endif
+
+	std::vector<int> components;
+
+	dim = options.target_dimension();
+	if (dim==-1) {
+		if (nonempty_dimensions.size()!=1) {
+			std::cout << "there are components of " << nonempty_dimensions.size() << " dimensions.  please pick one with -dim to decompose several of its components." << std::endl;
+			return components;
+		}
+		dim = nonempty_dimensions[0];
+	}
+
+	if (dimension_component_counter.find(dim)==dimension_component_counter.end()) {
+		std::cout << "there are no components of dimension " << dim << std::endl;
+		return components;
+	}
+
+	std::map<int,int> const& counter = dimension_component_counter[dim];
+
+	if (options.batch_components().empty()) {
+		for (auto iter=counter.begin(); iter!=counter.end(); ++iter)
+			components.push_back(iter->first);
+		return components;
+	}
+
+	for (auto iter=options.batch_components().begin(); iter!=options.batch_components().end(); ++iter) {
+		if (map_lookup_with_default(counter,*iter,0)==0)
+			std::cout << "you asked for component " << *iter << " (of dimension " << dim << ") which does not exist" << std::endl;
+		else
+			components.push_back(*iter);
+	}
+
+	std::sort(components.begin(), components.end());
+	components.erase(std::unique(components.begin(), components.end()), components.end());
+	return components;
+}
+
+
+
+
 WitnessSet NumericalIrreducibleDecomposition::best_possible_automatic_set(BertiniRealConfig & options)
 {
 #ifdef functionentry_output
@@ -395,10 +503,10 @@ WitnessSet NumericalIrreducibleDecomposition::best_possible_automatic_set(Bertin
 
 		int current_index = index_tracker[target_dimension][*iter][0]; // guaranteed to exist, b/c nonempty.  already checked.
 
-		if (checkSelfConjugate(point(current_index), options, options.input_filename())==true) {
+		if (checkSelfConjugate(solution(current_index), options, options.input_filename())==true) {
 			std::cout << "dim " << target_dimension << ", comp " << *iter << " is self-conjugate" << std::endl;
 			for (int ii=0; ii<dimension_component_counter[target_dimension][*iter]; ++ii) {
-				W.add_point( point(index_tracker[target_dimension][*iter][ii]) );
+				W.add_point( solution(index_tracker[target_dimension][*iter][ii]) );
 			}
 			sc_counter++;
 		}
@@ -536,7 +644,7 @@ WitnessSet NumericalIrreducibleDecomposition::choose_set_interactive(BertiniReal
 
 		//iterate over each point in the component
 		for (auto jter=index_tracker[target_dimension][*iter].begin(); jter!=index_tracker[target_dimension][*iter].end(); ++jter) {
-			W.add_point( point(*jter) );
+			W.add_point( solution(*jter) );
 		}
 
 	}
@@ -585,7 +693,7 @@ WitnessSet NumericalIrreducibleDecomposition::form_specific_witness_set(int dim,
 
 	for (auto iter = index_tracker[dim][comp].begin(); iter!= index_tracker[dim][comp].end(); ++iter) {
 		//iter points to an index into the vertices stored in the Vertex set.
-		W.add_point( point(*iter) );
+		W.add_point( solution(*iter) );
 	}
 
 
@@ -0,0 +1,484 @@
+#include "nag/parameter_sweep.hpp"
+#include "decompositions/checkSelfConjugate.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+
+namespace {
+
+	/**
+	 \brief the statements of a file written by partition_parse, without their semicolons, and without the END which closes a section.
+	 */
+	std::vector<std::string> ReadStatements(boost::filesystem::path const& filename)
+	{
+		std::ifstream fin(filename.string());
+		if (!fin)
+			throw std::runtime_error("unable to read " + filename.string());
+
+		std::vector<std::string> statements;
+		std::string statement;
+		while (std::getline(fin, statement, ';'))
+		{
+			size_t first = statement.find_first_not_of(" \t\r\n");
+			if (first==std::string::npos)
+				continue;
+			statement = statement.substr(first, statement.find_last_not_of(" \t\r\n")-first+1);
+
+			std::string lower(statement);
+			std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+			if (lower!="end")
+				statements.push_back(statement);
+		}
+		return statements;
+	}
+
+
+	/**
+	 \brief the names in a declaration, such as `variable_group x,y,z`.
+	 */
+	std::vector<std::string> DeclaredNames(std::string const& statement)
+	{
+		std::vector<std::string> names;
+		std::stringstream list(statement.substr(statement.find(' ')+1));
+		std::string name;
+		while (std::getline(list, name, ','))
+			if (!name.empty())
+				names.push_back(name);
+		return names;
+	}
+
+
+	/**
+	 \brief whether a statement is a declaration of the given kind.
+	 */
+	bool Declares(std::string const& statement, std::string const& kind)
+	{
+		return statement.compare(0, kind.size()+1, kind + " ")==0;
+	}
+
+
+	/**
+	 \brief a complex number, as a Bertini expression.
+	 */
+	void PrintComplex(FILE *OUT, comp_mp z)
+	{
+		fprintf(OUT, "(");
+		mpf_out_str(OUT, 10, 0, z->r);
+		fprintf(OUT, "+I*(");
+		mpf_out_str(OUT, 10, 0, z->i);
+		fprintf(OUT, "))");
+	}
+
+
+	void PrintComplex(FILE *OUT, comp_d z)
+	{
+		fprintf(OUT, "(%.15le+I*(%.15le))", z->r, z->i);
+	}
+
+} // re: anonymous namespace
+
+
+
+
+void ParameterSweep::Read(boost::filesystem::path const& filename)
+{
+#ifdef functionentry_output
+	std::cout << "ParameterSweep::Read" << std::endl;
+#endif
+
+	std::ifstream fin(filename.string());
+	if (!fin)
+		throw std::runtime_error("unable to read the sweep file " + filename.string());
+
+	names_.clear();
+	values_.clear();
+
+	std::string line;
+	while (std::getline(fin, line))
+	{
+		std::stringstream tokens(line);
+		std::vector<std::string> entries;
+		std::string entry;
+		while (tokens >> entry)
+			entries.push_back(entry);
+
+		if (entries.empty())
+			continue;
+
+		if (names_.empty()) {
+			names_ = entries;
+			continue;
+		}
+
+		if (entries.size()!=names_.size()) {
+			std::stringstream err;
+			err << "step " << values_.size()+1 << " of the sweep file " << filename << " has " << entries.size() << " values, for " << names_.size() << " constants";
+			throw std::runtime_error(err.str());
+		}
+		values_.push_back(entries);
+	}
+
+	if (names_.empty())
+		throw std::runtime_error("the sweep file " + filename.string() + " names no constants");
+}
+
+
+
+
+std::string ParameterSweep::AssignedName(std::string const& statement) const
+{
+	size_t equals = statement.find('=');
+	if (equals==std::string::npos)
+		return "";
+
+	std::string name = statement.substr(0, statement.find_last_not_of(" \t", equals-1)+1);
+	if (std::find(names_.begin(), names_.end(), name)==names_.end())
+		return "";
+	return name;
+}
+
+
+
+
+ParameterSweep::InputStatements ParameterSweep::Split(boost::filesystem::path const& input) const
+{
+	int *declarations = NULL;
+	partition_parse(&declarations, input, "func_input_sweep", "config_sweep", 0); // the 0 means not self conjugate
+	bool single_affine_group = declarations[0]==1 && declarations[1]==0;
+	free(declarations);
+
+	InputStatements split;
+	split.config = ReadStatements("config_sweep");
+	split.input = ReadStatements("func_input_sweep");
+
+	for (auto const& statement : split.input)
+	{
+		if (Declares(statement, "variable_group") && single_affine_group)
+			split.variables = DeclaredNames(statement);
+		else if (Declares(statement, "function"))
+		{
+			std::vector<std::string> functions = DeclaredNames(statement);
+			split.functions.insert(split.functions.end(), functions.begin(), functions.end());
+		}
+		else
+		{
+			std::string name = AssignedName(statement);
+			if (!name.empty())
+				split.swept[name] = statement.substr(statement.find('=')+1);
+		}
+	}
+
+	for (auto const& name : names_)
+		if (split.swept.find(name)==split.swept.end())
+			throw std::runtime_error("the swept constant " + name + " is not assigned in " + input.string());
+
+	remove("func_input_sweep");
+	remove("config_sweep");
+	return split;
+}
+
+
+
+
+void ParameterSweep::WriteInput(boost::filesystem::path const& input, boost::filesystem::path const& output, unsigned step) const
+{
+#ifdef functionentry_output
+	std::cout << "ParameterSweep::WriteInput" << std::endl;
+#endif
+
+	if (step<1 || step>NumSteps())
+		throw std::out_of_range("asking for the input file of a step not in the sweep");
+
+	InputStatements split = Split(input);
+
+	FILE *OUT = safe_fopen_write(output);
+	fprintf(OUT, "CONFIG\n");
+	for (auto const& statement : split.config)
+		fprintf(OUT, "%s;\n", statement.c_str());
+	fprintf(OUT, "END;\nINPUT\n");
+	for (auto const& statement : split.input)
+	{
+		std::string name = AssignedName(statement);
+		if (name.empty())
+			fprintf(OUT, "%s;\n", statement.c_str());
+		else
+		{
+			size_t index = std::find(names_.begin(), names_.end(), name) - names_.begin();
+			fprintf(OUT, "%s=%s;\n", name.c_str(), values_[step-1][index].c_str());
+		}
+	}
+	fprintf(OUT, "END;\n");
+	fclose(OUT);
+}
+
+
+
+
+bool ParameterSweep::Continue(NumericalIrreducibleDecomposition & witness_data, int dim, int comp,
+							  boost::filesystem::path const& from_input,
+							  boost::filesystem::path const& to_input,
+							  boost::filesystem::path const& output,
+							  double same_point_tolerance,
+							  BertiniRealConfig & program_options,
+							  PointHolder & carried) const
+{
+#ifdef functionentry_output
+	std::cout << "ParameterSweep::Continue" << std::endl;
+#endif
+
+	InputStatements from = Split(from_input);
+	InputStatements to = Split(to_input);
+
+	if (from.variables.empty()) {
+		if (program_options.verbose_level()>=1)
+			std::cout << "the sweep continues witness data only for a single affine variable_group" << std::endl;
+		return false;
+	}
+
+
+	WitnessSet W = witness_data.form_specific_witness_set(dim, comp);
+	if (W.num_points()==0)
+		return false;
+
+	if (!Track(W, from, to, same_point_tolerance, program_options, carried)) {
+		if (program_options.verbose_level()>=1)
+			std::cout << "the points of component " << comp << " of dimension " << dim << " did not all come through the sweep" << std::endl;
+		return false;
+	}
+
+
+	// the points of a component are interchangeable, all being on its slices, so the carried points replace the old in any order.
+	std::vector<int> const& replaced = witness_data.component_indices(dim, comp);
+	std::map<int, vec_mp*> replacements;
+	for (unsigned ii=0; ii<replaced.size(); ii++)
+		replacements[replaced[ii]] = &carried.point(ii);
+
+	witness_data.write_with_points(output, replacements);
+	return true;
+}
+
+
+
+
+bool ParameterSweep::FindComponent(NumericalIrreducibleDecomposition const& witness_data, PointHolder const& carried,
+								   boost::filesystem::path const& to_input, BertiniRealConfig & program_options,
+								   int & dim, int & comp) const
+{
+#ifdef functionentry_output
+	std::cout << "ParameterSweep::FindComponent" << std::endl;
+#endif
+
+	for (unsigned ii=0; ii<carried.num_points(); ii++)
+	{
+		int incidence = get_incidence_number(carried.point(ii), program_options, to_input);
+		if (incidence<0)
+			continue; // on no component.  try another point.
+
+		// the incidence number counts the components of every codimension, in the order the incidence matrix lists the codimensions.
+		FILE *IN = safe_fopen_read("incidence_matrix");
+		int num_nonempty_codims;
+		fscanf(IN, "%d", &num_nonempty_codims);
+		for (int jj=0; jj<num_nonempty_codims; jj++) {
+			int codim, num_components;
+			fscanf(IN, "%d %d", &codim, &num_components);
+			if (incidence<num_components) {
+				fclose(IN);
+				dim = witness_data.num_variables()-1-codim;
+				comp = incidence;
+				return true;
+			}
+			incidence -= num_components;
+		}
+		fclose(IN);
+	}
+
+	return false;
+}
+
+
+
+
+bool ParameterSweep::Track(WitnessSet const& W, InputStatements const& from, InputStatements const& to,
+						   double same_point_tolerance, BertiniRealConfig & program_options, PointHolder & carried) const
+{
+	int num_vars = from.variables.size(); // affine
+	int num_funcs = from.functions.size();
+	int codim = num_vars - W.dimension();
+
+	if (num_funcs<codim || W.num_linears()!=unsigned(W.dimension()))
+		return false;
+
+
+	FILE *OUT = safe_fopen_write("input_sweep");
+
+	fprintf(OUT, "CONFIG\n");
+	for (auto const& statement : from.config)
+	{
+		std::string key = statement.substr(0, statement.find(':'));
+		key.erase(std::remove_if(key.begin(), key.end(), ::isspace), key.end());
+		std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+		if (key!="tracktype" && key!="userhomotopy" && key!="parameterhomotopy")
+			fprintf(OUT, "%s;\n", statement.c_str());
+	}
+	fprintf(OUT, "USERHOMOTOPY: 1;\nEND;\nINPUT\n");
+
+
+	fprintf(OUT, "variable ");
+	for (int ii=0; ii<num_vars; ii++)
+		fprintf(OUT, "%s%s", from.variables[ii].c_str(), ii<num_vars-1 ? "," : ";\n");
+	fprintf(OUT, "pathvariable bertini_real_sweep_t;\nparameter bertini_real_sweep_s;\nbertini_real_sweep_s=bertini_real_sweep_t;\n");
+
+	// the original functions become subfunctions of the randomized ones
+	std::stringstream functions;
+	for (int ii=0; ii<codim; ii++)
+		functions << (ii>0 ? "," : "") << "bertini_real_sweep_F" << ii;
+	for (int ii=0; ii<W.dimension(); ii++)
+		functions << (codim+ii>0 ? "," : "") << "bertini_real_sweep_L" << ii;
+	fprintf(OUT, "function %s;\n", functions.str().c_str());
+
+
+	for (auto const& statement : from.input)
+	{
+		if (Declares(statement, "variable_group") || Declares(statement, "function"))
+			continue;
+
+		if (Declares(statement, "constant"))
+		{
+			std::vector<std::string> constants = DeclaredNames(statement), kept;
+			for (auto const& name : constants)
+				if (std::find(names_.begin(), names_.end(), name)==names_.end())
+					kept.push_back(name);
+
+			if (!kept.empty()) {
+				fprintf(OUT, "constant ");
+				for (unsigned ii=0; ii<kept.size(); ii++)
+					fprintf(OUT, "%s%s", kept[ii].c_str(), ii<kept.size()-1 ? "," : ";\n");
+			}
+			continue;
+		}
+
+		std::string name = AssignedName(statement);
+		if (name.empty()) {
+			fprintf(OUT, "%s;\n", statement.c_str());
+			continue;
+		}
+
+		// from the old value at s=1 to the new at s=0, off the straight line, so as to miss the values where the system is singular.
+		std::string const& old_value = from.swept.at(name);
+		std::string const& new_value = to.swept.at(name);
+		comp_d gamma;  get_comp_rand_d(gamma);
+		fprintf(OUT, "%s=bertini_real_sweep_s*(%s)+(1-bertini_real_sweep_s)*(%s)+bertini_real_sweep_s*(1-bertini_real_sweep_s)*",
+				name.c_str(), old_value.c_str(), new_value.c_str());
+		PrintComplex(OUT, gamma);
+		fprintf(OUT, "*((%s)-(%s));\n", new_value.c_str(), old_value.c_str());
+	}
+
+
+	// randomize the functions down to the codimension of the component
+	mat_d R;  init_mat_d(R, codim, num_funcs);
+	make_matrix_random_d(R, codim, num_funcs);
+
+	for (int ii=0; ii<codim; ii++)
+	{
+		fprintf(OUT, "bertini_real_sweep_F%d=", ii);
+		for (int jj=0; jj<num_funcs; jj++) {
+			if (jj>0)
+				fprintf(OUT, "+");
+			PrintComplex(OUT, &R->entry[ii][jj]);
+			fprintf(OUT, "*(%s)", from.functions[jj].c_str());
+		}
+		fprintf(OUT, ";\n");
+	}
+	clear_mat_d(R);
+
+
+	// the slices of the component, whose first coefficient is that of the homogenizing variable
+	for (int ii=0; ii<W.dimension(); ii++)
+	{
+		vec_mp & L = W.linear(ii);
+		fprintf(OUT, "bertini_real_sweep_L%d=", ii);
+		PrintComplex(OUT, &L->coord[0]);
+		for (int jj=0; jj<num_vars; jj++) {
+			fprintf(OUT, "+");
+			PrintComplex(OUT, &L->coord[jj+1]);
+			fprintf(OUT, "*%s", from.variables[jj].c_str());
+		}
+		fprintf(OUT, ";\n");
+	}
+	fprintf(OUT, "END;\n");
+	fclose(OUT);
+
+
+
+	OUT = safe_fopen_write("start_sweep");
+	fprintf(OUT, "%zu\n\n", W.num_points());
+
+	vec_mp result;  init_vec_mp(result, 0);
+	for (unsigned int ii=0; ii<W.num_points(); ii++)
+	{
+		change_prec_vec_mp(result, W.point(ii)->curr_prec);
+		dehomogenize(&result, W.point(ii));
+		for (int kk=0; kk<num_vars; kk++) {
+			print_mp(OUT, 0, &result->coord[kk]);
+			fprintf(OUT, "\n");
+		}
+		fprintf(OUT, "\n");
+	}
+	clear_vec_mp(result);
+	fclose(OUT);
+
+
+
+	copyfile("witness_data", "witness_data_0");
+
+	std::vector<std::string> command_line_options;
+	command_line_options.push_back("input_sweep");
+	command_line_options.push_back("start_sweep");
+
+	program_options.call_for_help(BERTINI_MAIN);
+	bertini_main_wrapper(command_line_options, program_options.num_procs(), 0, 0);
+
+	rename("witness_data_0", "witness_data");
+
+
+
+	// nonsingular_solutions leaves out the paths which failed or ended singular, so it is not in path order, and is read as a set.  all of them are kept, so that even a partial continuation can identify the component among witness data computed afresh.
+	FILE *IN = safe_fopen_read("nonsingular_solutions");
+	int num_sols;
+	fscanf(IN, "%d\n\n", &num_sols);
+
+	vec_mp new_point;  init_vec_mp2(new_point, num_vars+1, W.point(0)->curr_prec);
+	new_point->size = num_vars+1;
+	set_one_mp(&new_point->coord[0]);
+	for (int ii=0; ii<num_sols; ii++)
+	{
+		for (int jj=0; jj<num_vars; jj++) {
+			mpf_inp_str(new_point->coord[jj+1].r, IN, 10);
+			mpf_inp_str(new_point->coord[jj+1].i, IN, 10);
+		}
+
+		vec_mp & added = carried.point(carried.add_point(new_point));
+		::RescaleToPatch(added, W.patch(0));
+	}
+	clear_vec_mp(new_point);
+	fclose(IN);
+
+	remove("input_sweep");
+	remove("start_sweep");
+
+
+	if (num_sols!=int(W.num_points()))
+		return false;
+
+	// two paths which crossed end at the same point, and another point of the component is missing.
+	for (int ii=0; ii<num_sols; ii++)
+		for (int jj=ii+1; jj<num_sols; jj++)
+			if (isSamePoint_homogeneous_input(carried.point(ii), carried.point(jj), same_point_tolerance))
+				return false;
+
+	return true;
+}
@@ -0,0 +1,449 @@
+#include "nag/solvers/batch_tracker.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+
+
+
+void BatchedLinearSystems::resize(int n, int capacity)
+{
+	n_ = n;
+	capacity_ = capacity;
+
+	A_re_.resize(n*n*capacity);  A_im_.resize(n*n*capacity);
+	rhs_re_.resize(n*capacity);  rhs_im_.resize(n*capacity);
+	multiplier_re_.resize(capacity);  multiplier_im_.resize(capacity);
+	condition_estimate_.resize(capacity);
+}
+
+
+
+void BatchedLinearSystems::set(int b, mat_d A, vec_d rhs, bool negate)
+{
+	const double sign = negate ? -1 : 1;
+
+	for (int ii=0; ii<n_; ii++) {
+		for (int jj=0; jj<n_; jj++) {
+			A_re_[(ii*n_+jj)*capacity_+b] = A->entry[ii][jj].r;
+			A_im_[(ii*n_+jj)*capacity_+b] = A->entry[ii][jj].i;
+		}
+		rhs_re_[ii*capacity_+b] = sign*rhs->coord[ii].r;
+		rhs_im_[ii*capacity_+b] = sign*rhs->coord[ii].i;
+	}
+}
+
+
+
+void BatchedLinearSystems::solution(vec_d x, int b) const
+{
+	change_size_vec_d(x,n_);  x->size = n_;
+	for (int ii=0; ii<n_; ii++) {
+		x->coord[ii].r = rhs_re_[ii*capacity_+b];
+		x->coord[ii].i = rhs_im_[ii*capacity_+b];
+	}
+}
+
+
+
+void BatchedLinearSystems::solve(int num_systems)
+{
+	const int n = n_, cap = capacity_;
+
+	// the largest and smallest pivot magnitudes seen, squared.  the smallest lives in condition_estimate_ until the end.
+	std::vector<double> max_pivot(num_systems, 0);
+	for (int b=0; b<num_systems; b++)
+		condition_estimate_[b] = std::numeric_limits<double>::infinity();
+
+
+	for (int kk=0; kk<n; kk++) {
+
+		// the pivot row differs from system to system, so choose and swap one system at a time.
+		for (int b=0; b<num_systems; b++) {
+			int best = kk;
+			double best_abs = 0;
+			for (int ii=kk; ii<n; ii++) {
+				const double re = A_re_[(ii*n+kk)*cap+b], im = A_im_[(ii*n+kk)*cap+b];
+				if (re*re+im*im > best_abs) {
+					best_abs = re*re+im*im;
+					best = ii;
+				}
+			}
+
+			if (best!=kk) {
+				for (int jj=kk; jj<n; jj++) {
+					std::swap(A_re_[(kk*n+jj)*cap+b], A_re_[(best*n+jj)*cap+b]);
+					std::swap(A_im_[(kk*n+jj)*cap+b], A_im_[(best*n+jj)*cap+b]);
+				}
+				std::swap(rhs_re_[kk*cap+b], rhs_re_[best*cap+b]);
+				std::swap(rhs_im_[kk*cap+b], rhs_im_[best*cap+b]);
+			}
+
+			max_pivot[b] = std::max(max_pivot[b], best_abs);
+			condition_estimate_[b] = std::min(condition_estimate_[b], best_abs);
+		}
+
+
+		const double *pivot_re = &A_re_[(kk*n+kk)*cap], *pivot_im = &A_im_[(kk*n+kk)*cap];
+
+		for (int ii=kk+1; ii<n; ii++) {
+			double * __restrict__ m_re = multiplier_re_.data();
+			double * __restrict__ m_im = multiplier_im_.data();
+			const double *a_re = &A_re_[(ii*n+kk)*cap], *a_im = &A_im_[(ii*n+kk)*cap];
+
+			for (int b=0; b<num_systems; b++) {
+				const double denom = pivot_re[b]*pivot_re[b] + pivot_im[b]*pivot_im[b];
+				const double scale = denom>0 ? 1/denom : 0; // a singular system is caught by its condition estimate, and its garbage solution is never used.
+				m_re[b] = (a_re[b]*pivot_re[b] + a_im[b]*pivot_im[b])*scale;
+				m_im[b] = (a_im[b]*pivot_re[b] - a_re[b]*pivot_im[b])*scale;
+			}
+
+			for (int jj=kk+1; jj<n; jj++) {
+				double * __restrict__ row_re = &A_re_[(ii*n+jj)*cap];
+				double * __restrict__ row_im = &A_im_[(ii*n+jj)*cap];
+				const double * __restrict__ piv_row_re = &A_re_[(kk*n+jj)*cap];
+				const double * __restrict__ piv_row_im = &A_im_[(kk*n+jj)*cap];
+				for (int b=0; b<num_systems; b++) {
+					row_re[b] -= m_re[b]*piv_row_re[b] - m_im[b]*piv_row_im[b];
+					row_im[b] -= m_re[b]*piv_row_im[b] + m_im[b]*piv_row_re[b];
+				}
+			}
+
+			double * __restrict__ r_re = &rhs_re_[ii*cap];
+			double * __restrict__ r_im = &rhs_im_[ii*cap];
+			const double * __restrict__ piv_r_re = &rhs_re_[kk*cap];
+			const double * __restrict__ piv_r_im = &rhs_im_[kk*cap];
+			for (int b=0; b<num_systems; b++) {
+				r_re[b] -= m_re[b]*piv_r_re[b] - m_im[b]*piv_r_im[b];
+				r_im[b] -= m_re[b]*piv_r_im[b] + m_im[b]*piv_r_re[b];
+			}
+		}
+	}
+
+
+	// back substitution, into the right hand sides.
+	for (int ii=n-1; ii>=0; ii--) {
+		double * __restrict__ r_re = &rhs_re_[ii*cap];
+		double * __restrict__ r_im = &rhs_im_[ii*cap];
+
+		for (int jj=ii+1; jj<n; jj++) {
+			const double * __restrict__ a_re = &A_re_[(ii*n+jj)*cap];
+			const double * __restrict__ a_im = &A_im_[(ii*n+jj)*cap];
+			const double * __restrict__ x_re = &rhs_re_[jj*cap];
+			const double * __restrict__ x_im = &rhs_im_[jj*cap];
+			for (int b=0; b<num_systems; b++) {
+				r_re[b] -= a_re[b]*x_re[b] - a_im[b]*x_im[b];
+				r_im[b] -= a_re[b]*x_im[b] + a_im[b]*x_re[b];
+			}
+		}
+
+		const double *d_re = &A_re_[(ii*n+ii)*cap], *d_im = &A_im_[(ii*n+ii)*cap];
+		for (int b=0; b<num_systems; b++) {
+			const double denom = d_re[b]*d_re[b] + d_im[b]*d_im[b];
+			const double scale = denom>0 ? 1/denom : 0;
+			const double re = r_re[b], im = r_im[b];
+			r_re[b] = (re*d_re[b] + im*d_im[b])*scale;
+			r_im[b] = (im*d_re[b] - re*d_im[b])*scale;
+		}
+	}
+
+
+	for (int b=0; b<num_systems; b++) {
+		if (condition_estimate_[b]>0)
+			condition_estimate_[b] = std::sqrt(max_pivot[b]/condition_estimate_[b]);
+		else
+			condition_estimate_[b] = std::numeric_limits<double>::infinity();
+	}
+}
+
+
+
+
+
+
+
+
+BatchTrackerDouble::BatchTrackerDouble(int batch_size) : batch_size_(std::max(1,batch_size)), paths_(std::max(1,batch_size))
+{
+	for (auto & path : paths_) {
+		init_vec_d(path.point,0);
+		init_vec_d(path.trial_point,0);
+		for (int ss=0; ss<4; ss++)
+			init_vec_d(path.stage[ss],0);
+	}
+
+	init_vec_d(funcVals_,0);
+	init_vec_d(parVals_,0);
+	init_vec_d(parDer_,0);
+	init_mat_d(Jv_,0,0);
+	init_mat_d(Jp_,0,0);
+	init_vec_d(dH_dt_,0);
+}
+
+
+
+BatchTrackerDouble::~BatchTrackerDouble()
+{
+	for (auto & path : paths_) {
+		clear_vec_d(path.point);
+		clear_vec_d(path.trial_point);
+		for (int ss=0; ss<4; ss++)
+			clear_vec_d(path.stage[ss]);
+	}
+
+	clear_vec_d(funcVals_);
+	clear_vec_d(parVals_);
+	clear_vec_d(parDer_);
+	clear_mat_d(Jv_);
+	clear_mat_d(Jp_);
+	clear_vec_d(dH_dt_);
+}
+
+
+
+
+void BatchTrackerDouble::load_systems(std::vector<int> const& which, std::vector<double> const& times, bool for_newton, void const *ED, EvalFunction eval)
+{
+	comp_d t;
+	for (unsigned b=0; b<which.size(); b++) {
+		t->r = times[b];  t->i = 0;
+		eval(funcVals_, parVals_, parDer_, Jv_, Jp_, paths_[which[b]].trial_point, t, ED);
+
+		if (for_newton)
+			systems_.set(b, Jv_, funcVals_, true);
+		else {
+			mul_mat_vec_d(dH_dt_, Jp_, parDer_);
+			systems_.set(b, Jv_, dH_dt_, true);
+		}
+	}
+}
+
+
+
+bool BatchTrackerDouble::needs_higher_precision(double condition_estimate, tracker_config_t const& T) const
+{
+	// AMP's criterion, with double's digits: the digits lost to conditioning, plus those asked of Newton's method, plus the safety margin.
+	return std::log10(condition_estimate) - std::log10(T.basicNewtonTol) + T.AMP_safety_digits_1 > DBL_DIG;
+}
+
+
+
+
+int BatchTrackerDouble::advance(point_data_d *advanced_pts, std::vector<bool> & advanced,
+								point_data_d *start_pts, int num_points,
+								tracker_config_t const& T,
+								void const *ED, EvalFunction eval)
+{
+#ifdef functionentry_output
+	std::cout << "BatchTrackerDouble::advance" << std::endl;
+#endif
+
+	advanced.assign(num_points, false);
+	if (num_points==0)
+		return 0;
+
+
+	// probe the system.  the block solves only square systems, in the variables of the start points.
+	const int num_variables = start_pts[0].point->size;
+	{
+		comp_d t;  set_d(t, start_pts[0].time);
+		eval(funcVals_, parVals_, parDer_, Jv_, Jp_, start_pts[0].point, t, ED);
+		if (Jv_->rows!=num_variables || Jv_->cols!=num_variables)
+			return 0;
+	}
+	systems_.resize(num_variables, batch_size_);
+
+
+	const double rk_time_fraction[4] = {0, 0.5, 0.5, 1};
+	const double rk_weight[4] = {1.0/6, 1.0/3, 1.0/3, 1.0/6};
+
+	int num_advanced = 0;
+
+	for (int first=0; first<num_points; first+=batch_size_) {
+		const int num_in_block = std::min(batch_size_, num_points-first);
+
+		for (int b=0; b<num_in_block; b++) {
+			PathState & path = paths_[b];
+			point_data_d & start = start_pts[first+b];
+
+			path.index = first+b;
+			path.time = start.time->r;
+			path.stop_time = T.endgameBoundary + 0.1*(path.time - T.endgameBoundary);
+			path.step_size = T.maxStepSize;
+			path.num_consecutive_successes = 0;
+			path.num_steps = 0;
+			path.active = start.time->i==0 && path.time>T.endgameBoundary && start.point->size==num_variables;
+
+			vec_cp_d(path.point, start.point);
+		}
+
+
+		std::vector<int> which;
+		std::vector<double> times;
+
+		while (true) {
+
+			// start a step for every path still in the block.
+			std::vector<int> stepping;
+			for (int b=0; b<num_in_block; b++) {
+				PathState & path = paths_[b];
+				if (!path.active)
+					continue;
+
+				if (++path.num_steps > T.maxNumSteps) {
+					path.active = false;
+					continue;
+				}
+
+				path.step_size = std::min(path.step_size, path.time - path.stop_time);
+				path.step_failed = false;
+				path.converged = false;
+				stepping.push_back(b);
+			}
+
+			if (stepping.empty())
+				break;
+
+
+			// the predictor, a stage at a time for every path together.
+			for (int ss=0; ss<4; ss++) {
+				which.clear();  times.clear();
+				for (int b : stepping) {
+					PathState & path = paths_[b];
+					if (!path.active || path.step_failed)
+						continue;
+
+					vec_cp_d(path.trial_point, path.point);
+					if (ss>0) {
+						const double dt = -rk_time_fraction[ss]*path.step_size;
+						for (int ii=0; ii<num_variables; ii++) {
+							path.trial_point->coord[ii].r += dt*path.stage[ss-1]->coord[ii].r;
+							path.trial_point->coord[ii].i += dt*path.stage[ss-1]->coord[ii].i;
+						}
+					}
+
+					which.push_back(b);
+					times.push_back(path.time - rk_time_fraction[ss]*path.step_size);
+				}
+
+				load_systems(which, times, false, ED, eval);
+				systems_.solve(which.size());
+
+				for (unsigned slot=0; slot<which.size(); slot++) {
+					PathState & path = paths_[which[slot]];
+					const double condition_estimate = systems_.condition_estimate(slot);
+
+					if (!std::isfinite(condition_estimate))
+						path.step_failed = true;
+					else if (needs_higher_precision(condition_estimate, T))
+						path.active = false;
+					else
+						systems_.solution(path.stage[ss], slot);
+				}
+			}
+
+
+			for (int b : stepping) {
+				PathState & path = paths_[b];
+				if (!path.active || path.step_failed)
+					continue;
+
+				vec_cp_d(path.trial_point, path.point);
+				for (int ss=0; ss<4; ss++) {
+					const double dt = -rk_weight[ss]*path.step_size;
+					for (int ii=0; ii<num_variables; ii++) {
+						path.trial_point->coord[ii].r += dt*path.stage[ss]->coord[ii].r;
+						path.trial_point->coord[ii].i += dt*path.stage[ss]->coord[ii].i;
+					}
+				}
+			}
+
+
+			// the corrector, an iteration at a time for every path which has not yet converged.
+			for (int iteration=0; iteration<T.maxNewtonIts; iteration++) {
+				which.clear();  times.clear();
+				for (int b : stepping) {
+					PathState & path = paths_[b];
+					if (path.active && !path.step_failed && !path.converged) {
+						which.push_back(b);
+						times.push_back(path.time - path.step_size);
+					}
+				}
+
+				if (which.empty())
+					break;
+
+				load_systems(which, times, true, ED, eval);
+				systems_.solve(which.size());
+
+				for (unsigned slot=0; slot<which.size(); slot++) {
+					PathState & path = paths_[which[slot]];
+					const double condition_estimate = systems_.condition_estimate(slot);
+
+					if (!std::isfinite(condition_estimate)) {
+						path.step_failed = true;
+						continue;
+					}
+					if (needs_higher_precision(condition_estimate, T)) {
+						path.active = false;
+						continue;
+					}
+
+					systems_.solution(path.stage[0], slot); // the stages are spent, so hold the correction.
+					for (int ii=0; ii<num_variables; ii++) {
+						path.trial_point->coord[ii].r += path.stage[0]->coord[ii].r;
+						path.trial_point->coord[ii].i += path.stage[0]->coord[ii].i;
+					}
+
+					if (infNormVec_d(path.stage[0]) < T.basicNewtonTol)
+						path.converged = true;
+				}
+			}
+
+
+			// accept or reject, and adapt the step size.
+			for (int b : stepping) {
+				PathState & path = paths_[b];
+				if (!path.active)
+					continue;
+
+				if (path.step_failed || !path.converged) {
+					path.step_size *= T.step_fail_factor;
+					path.num_consecutive_successes = 0;
+					if (path.step_size < T.minStepSizeBeforeEndGame)
+						path.active = false;
+					continue;
+				}
+
+				vec_cp_d(path.point, path.trial_point);
+				path.time -= path.step_size;
+
+				if (++path.num_consecutive_successes >= T.cSecInc) {
+					path.step_size = std::min(path.step_size*T.step_success_factor, T.maxStepSize);
+					path.num_consecutive_successes = 0;
+				}
+
+				if (T.securityLevel<=0 && infNormVec_d(path.point) > T.securityMaxNorm) {
+					path.active = false;
+					continue;
+				}
+
+				if (path.time - path.stop_time <= 1e-14*path.stop_time) {
+					point_data_d & out = advanced_pts[path.index];
+					change_size_vec_d(out.point, num_variables);  out.point->size = num_variables;
+					vec_cp_d(out.point, path.point);
+					out.time->r = path.time;  out.time->i = 0;
+					out.cycle_num = start_pts[path.index].cycle_num;
+
+					advanced[path.index] = true;
+					num_advanced++;
+					path.active = false;
+				}
+			}
+		}// re: while there are paths in the block
+	}
+
+	return num_advanced;
+}
@@ -1,6 +1,8 @@
 #include "nag/solvers/midpoint.hpp"
 #include "decompositions/surface.hpp"
 
+#include <boost/timer/timer.hpp>
+
 
 void MidpointConfiguration::setup(const Surface & surf,
                             SolverConfiguration & solve_options)
@@ -326,7 +328,7 @@ int midpoint_eval_data_mp::receive(ParallelismConfig & mpi_config)
 	std::cout << "midpoint_eval_data_mp::receive" << std::endl;
 #endif
 	int *buffer = new int[12]; // allocate 12 here because we will be sending 12 integers
-	MPI_Bcast(buffer, 1, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 
 	if (buffer[0] != MIDPOINT_SOLVER) {
 		std::cout << "worker failed to confirm it is receiving the midpoint solver type eval data" << std::endl;
@@ -461,10 +463,23 @@ int midpoint_eval_data_mp::setup(MidpointConfiguration & md_config,
 		set_mp(this->v_target_full_prec, md_config.v_target);
 	}
 
+	reserve_temporaries();
 
 	return SUCCESSFUL;
 }
 
+
+void midpoint_eval_data_mp::reserve_temporaries()
+{
+	temp_vars.ensure_have_scalars(13);
+	temp_vars.ensure_have_vectors(9);
+	temp_vars.ensure_have_matrices(4);
+
+	increase_size_vec_mp(temp_vars.vectors[0], num_mid_vars);
+	increase_size_vec_mp(temp_vars.vectors[1], num_bottom_vars);
+	increase_size_vec_mp(temp_vars.vectors[2], num_top_vars);
+}
+
 ///////////////
 //
 //   end midpoint_eval_data_mp
@@ -553,7 +568,7 @@ int midpoint_eval_data_d::send(ParallelismConfig & mpi_config)
 
 	// now can actually send the data.
 
-	MPI_Bcast(buffer,12,MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer,12,MPI_INT, mpi_config.head(), mpi_config.comm());
 
 	delete[] buffer;
     return SUCCESSFUL;
@@ -568,7 +583,7 @@ int midpoint_eval_data_d::receive(ParallelismConfig & mpi_config)
 
 
 	int *buffer = new int[12];
-	MPI_Bcast(buffer, 1, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 
 	if (buffer[0] != MIDPOINT_SOLVER){
 		std::cout << "worker failed to confirm it is receiving the midpoint solver type eval data" << std::endl;
@@ -581,7 +596,7 @@ int midpoint_eval_data_d::receive(ParallelismConfig & mpi_config)
 
 
 
-	MPI_Bcast(buffer,12,MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer,12,MPI_INT, mpi_config.head(), mpi_config.comm());
 
 
 
@@ -700,9 +715,22 @@ int midpoint_eval_data_d::setup(MidpointConfiguration & md_config,
 
 	SolverDoublePrecision::setup();
 
+	reserve_temporaries();
+
 	return SUCCESSFUL;
 }
 
+
+void midpoint_eval_data_d::reserve_temporaries()
+{
+	temp_vars.ensure_have_vectors(9);
+	temp_vars.ensure_have_matrices(4);
+
+	increase_size_vec_d(temp_vars.vectors[0], num_mid_vars);
+	increase_size_vec_d(temp_vars.vectors[1], num_bottom_vars);
+	increase_size_vec_d(temp_vars.vectors[2], num_top_vars);
+}
+
 ///////////////
 //
 //   end midpoint_eval_data_d
@@ -820,6 +848,103 @@ int midpoint_solver_master_entry_point(const WitnessSet						&W, // carries with
 
 
 
+void midpoint_eval_benchmark(const WitnessSet & W,
+							 MidpointConfiguration & md_config,
+							 SolverConfiguration & solve_options,
+							 int num_evaluations)
+{
+#ifdef functionentry_output
+	std::cout << "midpoint_eval_benchmark" << std::endl;
+#endif
+
+	auto report = [num_evaluations](std::string const& which, boost::timer::cpu_timer const& timer)
+	{
+		double seconds = timer.elapsed().wall*1e-9;
+		std::cout << which << ": " << num_evaluations << " evaluations in " << seconds << "s, " << (seconds>0 ? num_evaluations/seconds : 0) << " evaluations per second" << std::endl;
+	};
+
+	std::cout << "benchmarking the midpoint evaluator, " << W.num_variables() << " variables" << std::endl;
+
+	midpoint_eval_data_d *ED_d = NULL;
+	midpoint_eval_data_mp *ED_mp = NULL;
+
+	switch (solve_options.T.MPType) {
+		case 1:
+			ED_mp = new midpoint_eval_data_mp(1);
+			ED_mp->setup(md_config, W, solve_options);
+			break;
+		default:
+			ED_d = new midpoint_eval_data_d(solve_options.T.MPType);
+			ED_d->setup(md_config, W, solve_options);
+			ED_mp = ED_d->BED_mp;
+			break;
+	}
+
+
+	if (ED_d!=NULL)
+	{
+		point_d funcVals, parVals, start_point; init_point_d(funcVals,0); init_point_d(parVals,0); init_point_d(start_point,0);
+		vec_d parDer; init_vec_d(parDer,0);
+		mat_d Jv, Jp; init_mat_d(Jv,0,0); init_mat_d(Jp,0,0);
+		comp_d t; t->r = 0.5; t->i = 0.0;
+
+		vec_mp_to_d(start_point, W.point(0));
+
+		boost::timer::cpu_timer timer;
+		for (int ii=0; ii<num_evaluations; ii++)
+			midpoint_eval_d(funcVals, parVals, parDer, Jv, Jp, start_point, t, ED_d);
+		timer.stop();
+		report("midpoint_eval_d", timer);
+
+		clear_point_d(funcVals); clear_point_d(parVals); clear_point_d(start_point);
+		clear_vec_d(parDer);
+		clear_mat_d(Jv); clear_mat_d(Jp);
+	}
+
+
+	if (ED_mp!=NULL)
+	{
+		std::vector<int> precisions;
+		if (solve_options.T.MPType==1)
+			precisions.push_back(solve_options.T.Precision);
+		else
+			precisions = {64, 128, 256};
+
+		for (auto prec : precisions)
+		{
+			if (solve_options.T.MPType==2)
+				change_midpoint_eval_prec(ED_mp, prec);
+
+			point_mp funcVals, parVals, start_point; init_point_mp2(funcVals,0,prec); init_point_mp2(parVals,0,prec); init_point_mp2(start_point,0,prec);
+			vec_mp parDer; init_vec_mp2(parDer,0,prec);
+			mat_mp Jv, Jp; init_mat_mp2(Jv,0,0,prec); init_mat_mp2(Jp,0,0,prec);
+			comp_mp t; init_mp2(t,prec); mpf_set_d(t->r, 0.5); mpf_set_d(t->i, 0.0);
+
+			vec_cp_mp(start_point, W.point(0));
+
+			boost::timer::cpu_timer timer;
+			for (int ii=0; ii<num_evaluations; ii++)
+				midpoint_eval_mp(funcVals, parVals, parDer, Jv, Jp, start_point, t, ED_mp);
+			timer.stop();
+			report("midpoint_eval_mp at " + std::to_string(prec) + " bits", timer);
+
+			clear_point_mp(funcVals); clear_point_mp(parVals); clear_point_mp(start_point);
+			clear_vec_mp(parDer);
+			clear_mat_mp(Jv); clear_mat_mp(Jp);
+			clear_mp(t);
+		}
+	}
+
+	if (ED_d!=NULL)
+		delete ED_d;
+	else
+		delete ED_mp;
+}
+
+
+
+
+
 void midpoint_slave_entry_point(SolverConfiguration & solve_options)
 {
 
@@ -828,7 +953,7 @@ void midpoint_slave_entry_point(SolverConfiguration & solve_options)
 	bcast_tracker_config_t(&solve_options.T, solve_options.id(), solve_options.head() );
 
 	int *settings_buffer = (int *) br_malloc(2*sizeof(int));
-	MPI_Bcast(settings_buffer,2,MPI_INT, 0, solve_options.comm());
+	MPI_Bcast(settings_buffer,2,MPI_INT, solve_options.head(), solve_options.comm());
 	solve_options.robust = settings_buffer[0];
 	solve_options.use_gamma_trick = settings_buffer[1];
 	free(settings_buffer);
@@ -900,20 +1025,23 @@ int midpoint_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, m
     mul_d(gamma_s, BED->gamma, pathVars);       // gamma_s = gamma * s
 
 
+	// the temporaries persist in the eval data, so that evaluation does no allocation.
+	BED->reserve_temporaries();
+
 	//parse out the variables into proper segments.
-	vec_d curr_mid_vars; init_vec_d(curr_mid_vars, BED->num_mid_vars);
+	vec_d &curr_mid_vars = BED->temp_vars.vectors[0];
 	curr_mid_vars->size = BED->num_mid_vars;
 	for (ii=0; ii<BED->num_mid_vars; ii++)
 		set_d(&curr_mid_vars->coord[ii], &current_variable_values->coord[ii]);
 
 	offset = BED->num_mid_vars; // y0
-	vec_d curr_bottom_vars; init_vec_d(curr_bottom_vars, BED->num_bottom_vars);
+	vec_d &curr_bottom_vars = BED->temp_vars.vectors[1];
 	curr_bottom_vars->size = BED->num_bottom_vars;
 	for (ii=0; ii<BED->num_bottom_vars; ii++)
 		set_d(&curr_bottom_vars->coord[ii], &current_variable_values->coord[ii+offset]);
 
 	offset = BED->num_mid_vars + BED->num_bottom_vars; // y2
-	vec_d curr_top_vars; init_vec_d(curr_top_vars, BED->num_top_vars);
+	vec_d &curr_top_vars = BED->temp_vars.vectors[2];
 	curr_top_vars->size = BED->num_top_vars;
 	for (ii=0; ii<BED->num_top_vars; ii++)
 		set_d(&curr_top_vars->coord[ii], &current_variable_values->coord[ii+offset]);
@@ -921,23 +1049,18 @@ int midpoint_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, m
 
 
 
-	//create the variables to hold temp output
-	vec_d patchValues; init_vec_d(patchValues, 0);
-	vec_d temp_function_values; init_vec_d(temp_function_values,0);
-
-	vec_d AtimesF;  init_vec_d(AtimesF,0);
+	//the variables to hold temp output
+	vec_d &patchValues = BED->temp_vars.vectors[3];
+	vec_d &temp_function_values = BED->temp_vars.vectors[4];
 
-	vec_d tempvec; init_vec_d(tempvec,0);
-	vec_d tempvec2; init_vec_d(tempvec2,0);
+	vec_d &AtimesF = BED->temp_vars.vectors[5];
 
 
-	mat_d temp_jacobian_functions, temp_jacobian_parameters;
-	init_mat_d(temp_jacobian_functions,0,0); init_mat_d(temp_jacobian_parameters,0,0);
+	mat_d &temp_jacobian_functions = BED->temp_vars.matrices[0];
 
-	mat_d AtimesJ; init_mat_d(AtimesJ,1,1); AtimesJ->rows = AtimesJ->cols = 1;
+	mat_d &AtimesJ = BED->temp_vars.matrices[1];
 
-	mat_d Jv_jac; init_mat_d(Jv_jac,0,0);
-	mat_d Jv_Patch; init_mat_d(Jv_Patch,0,0);
+	mat_d &Jv_Patch = BED->temp_vars.matrices[2];
 
 	comp_d temp, temp2, temp3, temp4;
 	comp_d proj_bottom, proj_top, proj_mid;
@@ -959,11 +1082,10 @@ int midpoint_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, m
 	set_one_d(one_minus_v);
 	sub_d(one_minus_v, one_minus_v, v);
 
-	//initialize some more containers, for the unused stuff from the called evaluators.
-	point_d unused_function_values, unused_parVals;
-	init_vec_d(unused_function_values,0);init_vec_d(unused_parVals,0);
-	vec_d unused_parDer; init_vec_d(unused_parDer,0);
-	mat_d unused_Jp; init_mat_d(unused_Jp,0,0);
+	//some more containers, for the unused stuff from the called evaluators.
+	point_d &unused_function_values = BED->temp_vars.vectors[6], &unused_parVals = BED->temp_vars.vectors[7];
+	vec_d &unused_parDer = BED->temp_vars.vectors[8];
+	mat_d &unused_Jp = BED->temp_vars.matrices[3];
 
 
 
@@ -981,7 +1103,22 @@ int midpoint_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, m
     Jv->cols = BED->num_variables;  //  <-- this must be square
     Jp->cols = 1;
 
-	for (ii=0; ii<Jv->rows; ii++)
+	// Jv is block diagonal in the mid, bottom and top subsystems, with the four coupling rows and the patch rows below.  the diagonal blocks and the patch rows are written in full below, so only zero what lies outside them.  this trims the zeroing only; the tracker still factors Jv densely.
+	int block_rows[3] = {BED->randomizer()->num_rand_funcs(), BED->randomizer_bottom->num_rand_funcs(), BED->randomizer_top->num_rand_funcs()};
+	int block_cols[3] = {BED->num_mid_vars, BED->num_bottom_vars, BED->num_top_vars};
+	int row_start = 0, col_start = 0;
+	for (int bb=0; bb<3; bb++) {
+		for (ii=row_start; ii<row_start+block_rows[bb]; ii++) {
+			for (jj=0; jj<col_start; jj++)
+				set_zero_d(&Jv->entry[ii][jj]);
+			for (jj=col_start+block_cols[bb]; jj<Jv->cols; jj++)
+				set_zero_d(&Jv->entry[ii][jj]);
+		}
+		row_start += block_rows[bb];
+		col_start += block_cols[bb];
+	}
+
+	for (ii=row_start; ii<BED->num_variables-BED->patch.num_patches; ii++) // the coupling rows, which are mostly 0
 		for (jj=0; jj<Jv->cols; jj++)
 			set_zero_d(&Jv->entry[ii][jj]);
 
@@ -1282,42 +1419,6 @@ int midpoint_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, m
 	}
 
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, AtimesJ, current_variable_values, funcVals, Jv);
-
-
-
-	clear_vec_d(curr_mid_vars);
-	clear_vec_d(curr_top_vars);
-	clear_vec_d(curr_bottom_vars);
-	clear_vec_d(patchValues);
-	clear_vec_d(temp_function_values);
-
-
-	clear_vec_d(AtimesF);
-
-	clear_vec_d(tempvec);
-	clear_vec_d(tempvec2);
-
-
-	clear_mat_d(Jv_Patch);
-
-
-
-	clear_mat_d(AtimesJ);
-	clear_mat_d(Jv_jac);
-	clear_mat_d(temp_jacobian_functions);
-	clear_mat_d(temp_jacobian_parameters);
-
-
-
-
-	clear_vec_d(unused_function_values);
-	clear_vec_d(unused_parVals);
-	clear_vec_d(unused_parDer);
-
-
-	clear_mat_d(unused_Jp);
 
 
     return 0;
@@ -1340,39 +1441,32 @@ int midpoint_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer, mat_mp
 
 
 
-	comp_mp one_minus_s, gamma_s;  init_mp(one_minus_s); init_mp(gamma_s);
-	vec_mp curr_mid_vars; init_vec_mp(curr_mid_vars, BED->num_mid_vars);
-	vec_mp curr_bottom_vars; init_vec_mp(curr_bottom_vars, BED->num_bottom_vars);
-	curr_bottom_vars->size = BED->num_bottom_vars;
-	vec_mp curr_top_vars; init_vec_mp(curr_top_vars, BED->num_top_vars);
-	curr_top_vars->size = BED->num_top_vars;
+	// the temporaries persist in the eval data, at the current precision, so that evaluation does no allocation.
+	BED->reserve_temporaries();
 
-	//create the variables to hold temp output
-	vec_mp patchValues; init_vec_mp(patchValues, 0);
-	vec_mp temp_function_values; init_vec_mp(temp_function_values,0);
+	comp_mp &one_minus_s = BED->temp_vars.scalars[0], &gamma_s = BED->temp_vars.scalars[1];
+	vec_mp &curr_mid_vars = BED->temp_vars.vectors[0];
+	vec_mp &curr_bottom_vars = BED->temp_vars.vectors[1];
+	vec_mp &curr_top_vars = BED->temp_vars.vectors[2];
 
-	vec_mp AtimesF;  init_vec_mp(AtimesF,0);
+	//the variables to hold temp output
+	vec_mp &patchValues = BED->temp_vars.vectors[3];
+	vec_mp &temp_function_values = BED->temp_vars.vectors[4];
 
-	vec_mp tempvec; init_vec_mp(tempvec,0);
-	vec_mp tempvec2; init_vec_mp(tempvec2,0);
+	vec_mp &AtimesF = BED->temp_vars.vectors[5];
 
 
-	mat_mp temp_jacobian_functions, temp_jacobian_parameters;
-	init_mat_mp(temp_jacobian_functions,0,0); init_mat_mp(temp_jacobian_parameters,0,0);
+	mat_mp &temp_jacobian_functions = BED->temp_vars.matrices[0];
 
-	mat_mp AtimesJ; init_mat_mp(AtimesJ,1,1); AtimesJ->rows = AtimesJ->cols = 1;
+	mat_mp &AtimesJ = BED->temp_vars.matrices[1];
 
-	mat_mp Jv_jac; init_mat_mp(Jv_jac,0,0);
-	mat_mp Jv_Patch; init_mat_mp(Jv_Patch,0,0);
+	mat_mp &Jv_Patch = BED->temp_vars.matrices[2];
 
 
-	comp_mp temp, temp2, temp3, temp4;  init_mp(temp);
-	init_mp(temp2); init_mp(temp3); init_mp(temp4);
-	comp_mp proj_bottom, proj_top, proj_mid;
-	init_mp(proj_bottom); init_mp(proj_top); init_mp(proj_mid);
-	point_mp unused_function_values, unused_parVals;
-	comp_mp one_minus_u, one_minus_v;
-	comp_mp u, v;  init_mp(u); init_mp(v);
+	comp_mp &temp = BED->temp_vars.scalars[2], &temp2 = BED->temp_vars.scalars[3], &temp3 = BED->temp_vars.scalars[4], &temp4 = BED->temp_vars.scalars[5];
+	comp_mp &proj_bottom = BED->temp_vars.scalars[6], &proj_top = BED->temp_vars.scalars[7], &proj_mid = BED->temp_vars.scalars[8];
+	comp_mp &one_minus_u = BED->temp_vars.scalars[9], &one_minus_v = BED->temp_vars.scalars[10];
+	comp_mp &u = BED->temp_vars.scalars[11], &v = BED->temp_vars.scalars[12];
 
 
 
@@ -1419,20 +1513,16 @@ int midpoint_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer, mat_mp
 
 
 
-	init_mp(one_minus_u); init_mp(one_minus_v);
 	set_one_mp(one_minus_u);
 	sub_mp(one_minus_u, one_minus_u, u);
 
 	set_one_mp(one_minus_v);
 	sub_mp(one_minus_v, one_minus_v, v);
 
-	//initialize some more containers, for the unused stuff from the called evaluators.
-
-
-
-	init_vec_mp(unused_function_values,0);init_vec_mp(unused_parVals,0);
-	vec_mp unused_parDer; init_vec_mp(unused_parDer,0);
-	mat_mp unused_Jp; init_mat_mp(unused_Jp,0,0);
+	//some more containers, for the unused stuff from the called evaluators.
+	point_mp &unused_function_values = BED->temp_vars.vectors[6], &unused_parVals = BED->temp_vars.vectors[7];
+	vec_mp &unused_parDer = BED->temp_vars.vectors[8];
+	mat_mp &unused_Jp = BED->temp_vars.matrices[3];
 
 
 
@@ -1450,7 +1540,22 @@ int midpoint_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer, mat_mp
     Jv->cols = BED->num_variables;  //  <-- this must be square
     Jp->cols = 1;
 
-	for (ii=0; ii<Jv->rows; ii++)
+	// Jv is block diagonal in the mid, bottom and top subsystems, with the four coupling rows and the patch rows below.  the diagonal blocks and the patch rows are written in full below, so only zero what lies outside them.  this trims the zeroing only; the tracker still factors Jv densely.
+	int block_rows[3] = {BED->randomizer()->num_rand_funcs(), BED->randomizer_bottom->num_rand_funcs(), BED->randomizer_top->num_rand_funcs()};
+	int block_cols[3] = {BED->num_mid_vars, BED->num_bottom_vars, BED->num_top_vars};
+	int row_start = 0, col_start = 0;
+	for (int bb=0; bb<3; bb++) {
+		for (ii=row_start; ii<row_start+block_rows[bb]; ii++) {
+			for (jj=0; jj<col_start; jj++)
+				set_zero_mp(&Jv->entry[ii][jj]);
+			for (jj=col_start+block_cols[bb]; jj<Jv->cols; jj++)
+				set_zero_mp(&Jv->entry[ii][jj]);
+		}
+		row_start += block_rows[bb];
+		col_start += block_cols[bb];
+	}
+
+	for (ii=row_start; ii<BED->num_variables-BED->patch.num_patches; ii++) // the coupling rows, which are mostly 0
 		for (jj=0; jj<Jv->cols; jj++)
 			set_zero_mp(&Jv->entry[ii][jj]);
 
@@ -1751,57 +1856,7 @@ int midpoint_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer, mat_mp
 	}
 
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, AtimesJ, current_variable_values, funcVals, Jv);
-
-
-	clear_mp(temp);
-	clear_mp(temp2);
-	clear_mp(temp3);
-	clear_mp(temp4);
-
-	clear_mp(proj_bottom);
-	clear_mp(proj_top);
-	clear_mp(proj_mid);
-
-	clear_mp(u);
-	clear_mp(v);
-	clear_mp(one_minus_u);
-	clear_mp(one_minus_v);
-	clear_mp(one_minus_s);
-	clear_mp(gamma_s);
-
-	clear_vec_mp(curr_mid_vars);
-	clear_vec_mp(curr_top_vars);
-	clear_vec_mp(curr_bottom_vars);
-	clear_vec_mp(patchValues);
-	clear_vec_mp(temp_function_values);
-
-
-	clear_vec_mp(AtimesF);
-
-	clear_vec_mp(tempvec);
-	clear_vec_mp(tempvec2);
-
-
-	clear_mat_mp(Jv_Patch);
-
-
-
-	clear_mat_mp(AtimesJ);
-	clear_mat_mp(Jv_jac);
-	clear_mat_mp(temp_jacobian_functions);
-	clear_mat_mp(temp_jacobian_parameters);
-
-
-
-
-	clear_vec_mp(unused_function_values);
-	clear_vec_mp(unused_parVals);
-	clear_vec_mp(unused_parDer);
-
 
-	clear_mat_mp(unused_Jp);
 
 
 
@@ -1917,6 +1972,7 @@ int change_midpoint_eval_prec(void const *ED, int new_prec)
 		BED->randomizer_bottom->change_prec(new_prec);
 		BED->randomizer_top->change_prec(new_prec);
 
+		BED->temp_vars.change_prec(new_prec);
 
 
 		for (int ii=0; ii<BED->num_projections; ii++) {
@@ -116,12 +116,24 @@ int multilintolin_eval_data_mp::setup(MultilinConfiguration & config,
 
 	}
 
-
+	reserve_temporaries();
 
 	return 0;
 }
 
 
+void multilintolin_eval_data_mp::reserve_temporaries()
+{
+	temp_vars.ensure_have_scalars(4);
+	temp_vars.ensure_have_vectors(3);
+	temp_vars.ensure_have_matrices(4);
+
+	increase_size_vec_mp(temp_vars.vectors[2], randomizer()->num_rand_funcs());
+	increase_size_mat_mp(temp_vars.matrices[0], randomizer()->num_base_funcs(), num_variables);
+	increase_size_mat_mp(temp_vars.matrices[3], randomizer()->num_rand_funcs(), num_variables);
+}
+
+
 
 
 
@@ -335,10 +347,24 @@ int multilintolin_eval_data_d::setup(MultilinConfiguration & config,
 
 
 	SolverDoublePrecision::setup(config.SLP, config.randomizer());
+
+	reserve_temporaries();
+
 	return 0;
 }
 
 
+void multilintolin_eval_data_d::reserve_temporaries()
+{
+	temp_vars.ensure_have_vectors(3);
+	temp_vars.ensure_have_matrices(4);
+
+	increase_size_vec_d(temp_vars.vectors[2], randomizer()->num_rand_funcs());
+	increase_size_mat_d(temp_vars.matrices[0], randomizer()->num_base_funcs(), num_variables);
+	increase_size_mat_d(temp_vars.matrices[3], randomizer()->num_rand_funcs(), num_variables);
+}
+
+
 
 
 
@@ -549,7 +575,7 @@ int multilin_slave_entry_point(SolverConfiguration & solve_options)
 	bcast_tracker_config_t(&solve_options.T, solve_options.id(), solve_options.head() );
 
 	int *settings_buffer = (int *) br_malloc(2*sizeof(int));
-	MPI_Bcast(settings_buffer,2,MPI_INT, 0,solve_options.comm());
+	MPI_Bcast(settings_buffer,2,MPI_INT, solve_options.head(), solve_options.comm());
 	solve_options.robust = settings_buffer[0];
 	solve_options.use_gamma_trick = settings_buffer[1];
 	free(settings_buffer);
@@ -638,16 +664,19 @@ int multilin_to_lin_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_
 	mul_d(gamma_s, BED->gamma, pathVars);       // gamma_s = gamma * s
 
 
-	vec_d patchValues; init_vec_d(patchValues, 0);
-	vec_d temp_function_values; init_vec_d(temp_function_values,0);
-	vec_d AtimesF; init_vec_d(AtimesF,BED->randomizer()->num_rand_funcs()); AtimesF->size = BED->randomizer()->num_rand_funcs();// declare  // initialize
+	// the temporaries persist in the eval data, so that evaluation does no allocation.
+	BED->reserve_temporaries();
+
+	vec_d &patchValues = BED->temp_vars.vectors[0];
+	vec_d &temp_function_values = BED->temp_vars.vectors[1];
+	vec_d &AtimesF = BED->temp_vars.vectors[2]; AtimesF->size = BED->randomizer()->num_rand_funcs();
 
 
-	mat_d temp_jacobian_functions; init_mat_d(temp_jacobian_functions,BED->randomizer()->num_base_funcs(),BED->num_variables);
+	mat_d &temp_jacobian_functions = BED->temp_vars.matrices[0];
 	temp_jacobian_functions->rows = BED->randomizer()->num_base_funcs(); temp_jacobian_functions->cols = BED->num_variables;
-	mat_d temp_jacobian_parameters; init_mat_d(temp_jacobian_parameters,0,0);
-	mat_d Jv_Patch; init_mat_d(Jv_Patch, 0, 0);
-	mat_d AtimesJ; init_mat_d(AtimesJ,BED->randomizer()->num_rand_funcs(),BED->num_variables);
+	mat_d &temp_jacobian_parameters = BED->temp_vars.matrices[1];
+	mat_d &Jv_Patch = BED->temp_vars.matrices[2];
+	mat_d &AtimesJ = BED->temp_vars.matrices[3];
 	AtimesJ->rows = BED->randomizer()->num_rand_funcs(); AtimesJ->cols = BED->num_variables;
 
 
@@ -817,19 +846,7 @@ int multilin_to_lin_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_
 
 
 
-	clear_vec_d(patchValues);
-	clear_vec_d(temp_function_values);
-	clear_vec_d(AtimesF);
-
-
-	clear_mat_d(temp_jacobian_functions);
-	clear_mat_d(temp_jacobian_parameters);
-	clear_mat_d(Jv_Patch);
-	clear_mat_d(AtimesJ);
-
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, AtimesJ, current_variable_values, funcVals, Jv);
 
 
 	return 0;
@@ -849,8 +866,11 @@ int multilin_to_lin_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer,
 
 
 
-	comp_mp one_minus_s, gamma_s; init_mp(one_minus_s); init_mp(gamma_s);
-	comp_mp temp, temp2; init_mp(temp); init_mp(temp2);
+	// the temporaries persist in the eval data, at the current precision, so that evaluation does no allocation.
+	BED->reserve_temporaries();
+
+	comp_mp &one_minus_s = BED->temp_vars.scalars[0], &gamma_s = BED->temp_vars.scalars[1];
+	comp_mp &temp = BED->temp_vars.scalars[2], &temp2 = BED->temp_vars.scalars[3];
 
 	int offset;
 
@@ -861,19 +881,19 @@ int multilin_to_lin_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer,
 	mul_mp(gamma_s, BED->gamma, pathVars);       // gamma_s = gamma * s
 
 
-	vec_mp patchValues; init_vec_mp(patchValues, 0);
-	vec_mp temp_function_values; init_vec_mp(temp_function_values,0);
-	vec_mp AtimesF; init_vec_mp(AtimesF,BED->randomizer()->num_rand_funcs()); AtimesF->size = BED->randomizer()->num_rand_funcs();// declare  // initialize
+	vec_mp &patchValues = BED->temp_vars.vectors[0];
+	vec_mp &temp_function_values = BED->temp_vars.vectors[1];
+	vec_mp &AtimesF = BED->temp_vars.vectors[2]; AtimesF->size = BED->randomizer()->num_rand_funcs();
 
 
 
 
 
-	mat_mp temp_jacobian_functions; init_mat_mp(temp_jacobian_functions,BED->randomizer()->num_base_funcs(),BED->num_variables);
+	mat_mp &temp_jacobian_functions = BED->temp_vars.matrices[0];
 	temp_jacobian_functions->rows = BED->randomizer()->num_base_funcs(); temp_jacobian_functions->cols = BED->num_variables;
-	mat_mp temp_jacobian_parameters; init_mat_mp(temp_jacobian_parameters,0,0);
-	mat_mp Jv_Patch; init_mat_mp(Jv_Patch, 0, 0);
-	mat_mp AtimesJ; init_mat_mp(AtimesJ,BED->randomizer()->num_rand_funcs(),BED->num_variables);
+	mat_mp &temp_jacobian_parameters = BED->temp_vars.matrices[1];
+	mat_mp &Jv_Patch = BED->temp_vars.matrices[2];
+	mat_mp &AtimesJ = BED->temp_vars.matrices[3];
 	AtimesJ->rows = BED->randomizer()->num_rand_funcs(); AtimesJ->cols = BED->num_variables;
 
 
@@ -1056,25 +1076,7 @@ int multilin_to_lin_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer,
 
 
 
-	clear_mp(one_minus_s);
-	clear_mp(gamma_s);
-	clear_mp(temp);
-	clear_mp(temp2);
-
-
-	clear_vec_mp(patchValues);
-	clear_vec_mp(temp_function_values);
-	clear_vec_mp(AtimesF);
-
-
-	clear_mat_mp(temp_jacobian_functions);
-	clear_mat_mp(temp_jacobian_parameters);
-	clear_mat_mp(Jv_Patch);
-	clear_mat_mp(AtimesJ);
-
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, AtimesJ, current_variable_values, funcVals, Jv);
 	
 
 
@@ -1195,6 +1197,7 @@ int change_multilintolin_eval_prec(void const *ED, int new_prec)
 		}
 		BED->randomizer()->change_prec(new_prec);
 
+		BED->temp_vars.change_prec(new_prec);
 	}
 
 	return 0;
@@ -387,7 +387,7 @@ int nullspacejac_eval_data_mp::send(ParallelismConfig & mpi_config)
 int nullspacejac_eval_data_mp::receive(ParallelismConfig & mpi_config)
 {
 	int *buffer = new int[12];
-	MPI_Bcast(buffer, 1, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 
 	if (buffer[0] != NULLSPACE) {
 		std::cout << "worker failed to confirm it is receiving the NULLSPACE type eval data" << std::endl;
@@ -1151,7 +1151,7 @@ int nullspacejac_eval_data_d::send(ParallelismConfig & mpi_config)
 int nullspacejac_eval_data_d::receive(ParallelismConfig & mpi_config)
 {
     int *buffer = new int[12];
-	MPI_Bcast(buffer, 1, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 
 	if (buffer[0] != NULLSPACE){
 		std::cout << "worker failed to confirm it is receiving the nullspace type eval data" << std::endl;
@@ -1541,7 +1541,7 @@ int nullspacejac_solver_master_entry_point(int							MPType,
 
 	prog_t SLP;
 	//	// setup a straight-line program, using the file(s) created by the parser.  the input file must already be parsed
-	setupProg(&SLP, solve_options.T.Precision, solve_options.T.MPType);
+	setup_prog(&SLP, solve_options.T.Precision, solve_options.T.MPType);
 
 
 	solve_options.T.numVars = W.num_variables();
@@ -1613,7 +1613,7 @@ int nullspacejac_solver_master_entry_point(int							MPType,
 	}
 
 
-	clearProg(&SLP, solve_options.T.MPType, 1); // 1 means call freeprogeval()
+	clear_prog(&SLP, solve_options.T.MPType, 1); // 1 means call freeprogeval()
 	return SUCCESSFUL;
 
 }
@@ -1631,7 +1631,7 @@ void nullspace_slave_entry_point(SolverConfiguration & solve_options)
 	bcast_tracker_config_t(&solve_options.T, solve_options.id(), solve_options.head() );
 
 	int *settings_buffer = (int *) br_malloc(2*sizeof(int));
-	MPI_Bcast(settings_buffer,2,MPI_INT, 0,solve_options.comm());
+	MPI_Bcast(settings_buffer,2,MPI_INT, solve_options.head(), solve_options.comm());
 	solve_options.robust = settings_buffer[0];
 	solve_options.use_gamma_trick = settings_buffer[1];
 	free(settings_buffer);
@@ -1698,13 +1698,65 @@ void nullspace_slave_entry_point(SolverConfiguration & solve_options)
 
 
 
+void leave_one_out_products_d(vec_d products, _comp_d *values, int num_values, comp_d scale, comp_d running)
+{
+	if (num_values<=0) {
+		products->size = 0;
+		return;
+	}
+
+	increase_size_vec_d(products, num_values);
+	products->size = num_values;
+
+	// prefix products
+	set_d(&products->coord[0], scale);
+	for (int ii=1; ii<num_values; ii++)
+		mul_d(&products->coord[ii], &products->coord[ii-1], &values[ii-1]);
+
+	// times suffix products
+	set_one_d(running);
+	for (int ii=num_values-1; ii>=0; ii--) {
+		mul_d(&products->coord[ii], &products->coord[ii], running);
+		mul_d(running, running, &values[ii]);
+	}
+}
+
+
+void leave_one_out_products_mp(vec_mp products, _comp_mp *values, int num_values, comp_mp scale, comp_mp running)
+{
+	if (num_values<=0) {
+		products->size = 0;
+		return;
+	}
+
+	increase_size_vec_mp(products, num_values);
+	products->size = num_values;
+
+	// prefix products
+	set_mp(&products->coord[0], scale);
+	for (int ii=1; ii<num_values; ii++)
+		mul_mp(&products->coord[ii], &products->coord[ii-1], &values[ii-1]);
+
+	// times suffix products
+	set_one_mp(running);
+	for (int ii=num_values-1; ii>=0; ii--) {
+		mul_mp(&products->coord[ii], &products->coord[ii], running);
+		mul_mp(running, running, &values[ii]);
+	}
+}
+
+
+
+
+
+
 int nullspacejac_right_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, mat_d Jp, point_d current_variable_values, comp_d pathVars, void const *ED)
 { // evaluates a special homotopy type, built for bertini_real
 
 	nullspacejac_eval_data_d *BED = (nullspacejac_eval_data_d *)ED; // to avoid having to cast every time
 
 	BED->temp_vars.ensure_have_scalars(6);
-	BED->temp_vars.ensure_have_vectors(13);
+	BED->temp_vars.ensure_have_vectors(14);
 	BED->temp_vars.ensure_have_matrices(10);
 
 
@@ -1769,6 +1821,9 @@ int nullspacejac_right_eval_d(point_d funcVals, point_d parVals, vec_d parDer, m
 
 
 
+	vec_d *linprod_cofactors = &BED->temp_vars.vectors[13]; // products of all but one of the starting linears
+
+
 	mat_d *Jv_Patch = &BED->temp_vars.matrices[0];
 
 	mat_d *tempmat5 = &BED->temp_vars.matrices[1];
@@ -2091,29 +2146,21 @@ int nullspacejac_right_eval_d(point_d funcVals, point_d parVals, vec_d parDer, m
 
 
 
-	// an implementation of the product rule
+	// an implementation of the product rule.  d/dx_kk prod_ii L_ii(x) = sum_ii a_ii[kk] prod_{jj!=ii} L_jj(x), with the products of all but one linear from prefix and suffix products, so that this is O(degree) per entry.
 	for (int mm=0; mm<BED->randomizer()->num_rand_funcs(); mm++) {
+		int curr_degree = BED->randomizer()->randomized_degree(mm)-1;
+
+		dot_product_d(*temp, BED->v_linears[mm], (*curr_v_vars));  // everything here is multiplied by (v_linear •	v)
+		leave_one_out_products_d(*linprod_cofactors, (*lin_func_vals)->entry[mm], curr_degree, *temp, *running_prod);
 
 		for (int kk=0; kk<(BED->num_natural_vars+BED->num_synth_vars); kk++) { // for each variable
 			set_zero_d(&(*linprod_derivative_wrt_x)->entry[mm][kk]); // initialize to 0 for the sum
 
-			int curr_degree = BED->randomizer()->randomized_degree(mm)-1;
 			for (int ii=0; ii<curr_degree; ++ii) { //  for each linear
-
-				set_d(*running_prod, &BED->starting_linears[mm][ii]->coord[kk]);// initialize the product
-				for (int jj=0; jj<curr_degree; jj++) {
-					if (jj!=ii) {
-						mul_d(*running_prod,*running_prod,&(*lin_func_vals)->entry[mm][jj]); // the linear evaluated at curr_var_vals
-					}
-				}//re: jj
+				mul_d(*running_prod, &(*linprod_cofactors)->coord[ii], &BED->starting_linears[mm][ii]->coord[kk]);
 				add_d(&(*linprod_derivative_wrt_x)->entry[mm][kk],&(*linprod_derivative_wrt_x)->entry[mm][kk],*running_prod);
-
-			}// re:ii
-
-			dot_product_d(*temp, BED->v_linears[mm], (*curr_v_vars));  // these two lines multiply by  (v_linear •	v)
-			mul_d(&(*linprod_derivative_wrt_x)->entry[mm][kk], &(*linprod_derivative_wrt_x)->entry[mm][kk], *temp);
+			}
 		} // re: kk
-
 	} // re: mm
 
 
@@ -2409,8 +2456,6 @@ int nullspacejac_right_eval_d(point_d funcVals, point_d parVals, vec_d parDer, m
 
 
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, *AtimesJ, current_variable_values, funcVals, Jv);
 
 	return 0;
 }
@@ -2423,7 +2468,7 @@ int nullspacejac_right_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDe
 	nullspacejac_eval_data_mp *BED = (nullspacejac_eval_data_mp *)ED; // to avoid having to cast every time
 
 	BED->temp_vars.ensure_have_scalars(6);
-	BED->temp_vars.ensure_have_vectors(13);
+	BED->temp_vars.ensure_have_vectors(14);
 	BED->temp_vars.ensure_have_matrices(10);
 
 
@@ -2488,6 +2533,9 @@ int nullspacejac_right_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDe
 
 
 
+	vec_mp *linprod_cofactors = &BED->temp_vars.vectors[13]; // products of all but one of the starting linears
+
+
 	mat_mp *Jv_Patch = &BED->temp_vars.matrices[0];
 	mat_mp *tempmat5 = &BED->temp_vars.matrices[1];
 
@@ -2808,29 +2856,21 @@ int nullspacejac_right_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDe
 
 
 
-	// an implementation of the product rule
+	// an implementation of the product rule.  d/dx_kk prod_ii L_ii(x) = sum_ii a_ii[kk] prod_{jj!=ii} L_jj(x), with the products of all but one linear from prefix and suffix products, so that this is O(degree) per entry.
 	for (int mm=0; mm<BED->randomizer()->num_rand_funcs(); mm++) {
+		int curr_degree = BED->randomizer()->randomized_degree(mm)-1;
+
+		dot_product_mp(*temp, BED->v_linears[mm], (*curr_v_vars));  // everything here is multiplied by (v_linear •	v)
+		leave_one_out_products_mp(*linprod_cofactors, (*lin_func_vals)->entry[mm], curr_degree, *temp, *running_prod);
 
 		for (int kk=0; kk<(BED->num_natural_vars+BED->num_synth_vars); kk++) { // for each variable
 			set_zero_mp(&(*linprod_derivative_wrt_x)->entry[mm][kk]); // initialize to 0 for the sum
 
-			int curr_degree = BED->randomizer()->randomized_degree(mm)-1;
 			for (int ii=0; ii<curr_degree; ++ii) { //  for each linear
-
-				set_mp(*running_prod, &BED->starting_linears[mm][ii]->coord[kk]);// initialize the product
-				for (int jj=0; jj<curr_degree; jj++) {
-					if (jj!=ii) {
-						mul_mp(*running_prod,*running_prod,&(*lin_func_vals)->entry[mm][jj]); // the linear evaluated at curr_var_vals
-					}
-				}//re: jj
+				mul_mp(*running_prod, &(*linprod_cofactors)->coord[ii], &BED->starting_linears[mm][ii]->coord[kk]);
 				add_mp(&(*linprod_derivative_wrt_x)->entry[mm][kk],&(*linprod_derivative_wrt_x)->entry[mm][kk],*running_prod);
-
-			}// re:ii
-
-			dot_product_mp(*temp, BED->v_linears[mm], (*curr_v_vars));  // these two lines multiply by  (v_linear •	v)
-			mul_mp(&(*linprod_derivative_wrt_x)->entry[mm][kk], &(*linprod_derivative_wrt_x)->entry[mm][kk], *temp);
+			}
 		} // re: kk
-
 	} // re: mm
 
 
@@ -3123,8 +3163,6 @@ int nullspacejac_right_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDe
 
 
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, *AtimesJ, current_variable_values, funcVals, Jv);
 
 
 	return 0;
@@ -3146,7 +3184,7 @@ int nullspacejac_left_eval_d(point_d funcVals, point_d parVals, vec_d parDer, ma
 	nullspacejac_eval_data_d *BED = (nullspacejac_eval_data_d *)ED; // to avoid having to cast every time
 
 	BED->temp_vars.ensure_have_scalars(6);
-	BED->temp_vars.ensure_have_vectors(13);
+	BED->temp_vars.ensure_have_vectors(14);
 	BED->temp_vars.ensure_have_matrices(10);
 
 
@@ -3211,6 +3249,9 @@ int nullspacejac_left_eval_d(point_d funcVals, point_d parVals, vec_d parDer, ma
 
 
 
+	vec_d *linprod_cofactors = &BED->temp_vars.vectors[13]; // products of all but one of the starting linears
+
+
 	mat_d *Jv_Patch = &BED->temp_vars.matrices[0];
 	mat_d *tempmat = &BED->temp_vars.matrices[1]; change_size_mat_d(*tempmat,BED->num_variables-1,BED->num_variables-1);
 	(*tempmat)->rows = (*tempmat)->cols = BED->num_variables-1; // change the size indicators
@@ -3520,25 +3561,20 @@ int nullspacejac_left_eval_d(point_d funcVals, point_d parVals, vec_d parDer, ma
 
 
 
-	// an implementation of the product rule
-	for (int mm=0; mm< BED->num_jac_equations; mm++) {
+	// an implementation of the product rule.  d/dx_kk prod_ii L_ii(x) = sum_ii a_ii[kk] prod_{jj!=ii} L_jj(x), with the products of all but one linear from prefix and suffix products, so that this is O(degree) per entry.
+	for (int mm=0; mm<BED->num_jac_equations; mm++) {
+		int curr_degree = BED->max_degree;
+
+		dot_product_d(*temp, BED->v_linears[mm], (*curr_v_vars));  // everything here is multiplied by (v_linear •	v)
+		leave_one_out_products_d(*linprod_cofactors, (*lin_func_vals)->entry[mm], curr_degree, *temp, *running_prod);
+
 		for (int kk=0; kk<(BED->num_natural_vars+BED->num_synth_vars); kk++) { // for each variable
 			set_zero_d(&(*linprod_derivative_wrt_x)->entry[mm][kk]); // initialize to 0 for the sum
 
-			for (int ii=0; ii<BED->max_degree; ++ii) { //  for each linear
-
-				set_d(*running_prod, &BED->starting_linears[mm][ii]->coord[kk]);// initialize the product
-				for (int jj=0; jj<BED->max_degree; jj++) {
-					if (jj!=ii) {
-						mul_d(*running_prod,*running_prod,&(*lin_func_vals)->entry[mm][jj]); // the linear evaluated at curr_var_vals
-					}
-				}//re: jj
+			for (int ii=0; ii<curr_degree; ++ii) { //  for each linear
+				mul_d(*running_prod, &(*linprod_cofactors)->coord[ii], &BED->starting_linears[mm][ii]->coord[kk]);
 				add_d(&(*linprod_derivative_wrt_x)->entry[mm][kk],&(*linprod_derivative_wrt_x)->entry[mm][kk],*running_prod);
-
-			}// re:ii
-
-			dot_product_d(*temp, BED->v_linears[mm], (*curr_v_vars));  // these two lines multiply by  (v_linear •	v)
-			mul_d(&(*linprod_derivative_wrt_x)->entry[mm][kk], &(*linprod_derivative_wrt_x)->entry[mm][kk], *temp);
+			}
 		} // re: kk
 	} // re: mm
 
@@ -3828,15 +3864,7 @@ int nullspacejac_left_eval_d(point_d funcVals, point_d parVals, vec_d parDer, ma
 
 
 
-	if (print_this_path)
-	{
-		BED->num_steps++;
-		fprintf(g_path_file,"%.15g %.15g ", pathVars->r, pathVars->i);
-		for (int ii=0; ii<BED->num_variables; ++ii) {
-			fprintf(g_path_file,"%.15g %.15g ",current_variable_values->coord[ii].r,current_variable_values->coord[ii].i);
-		}
-		fprintf(g_path_file,"\n");
-	}
+	BED->num_steps++;
 
 	//	printf("exiting eval\n");
 	return 0;
@@ -3851,7 +3879,7 @@ int nullspacejac_left_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer
 
 
 	BED->temp_vars.ensure_have_scalars(6);
-	BED->temp_vars.ensure_have_vectors(13);
+	BED->temp_vars.ensure_have_vectors(14);
 	BED->temp_vars.ensure_have_matrices(10);
 
 
@@ -3916,6 +3944,9 @@ int nullspacejac_left_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer
 
 
 
+	vec_mp *linprod_cofactors = &BED->temp_vars.vectors[13]; // products of all but one of the starting linears
+
+
 	mat_mp *Jv_Patch = &BED->temp_vars.matrices[0];
 	mat_mp *tempmat = &BED->temp_vars.matrices[1]; change_size_mat_mp(*tempmat,BED->num_variables-1,BED->num_variables-1);
 	(*tempmat)->rows = (*tempmat)->cols = BED->num_variables-1; // change the size indicators
@@ -4224,25 +4255,20 @@ int nullspacejac_left_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer
 
 
 
-	// an implementation of the product rule
-	for (int mm=0; mm< BED->num_jac_equations; mm++) {
+	// an implementation of the product rule.  d/dx_kk prod_ii L_ii(x) = sum_ii a_ii[kk] prod_{jj!=ii} L_jj(x), with the products of all but one linear from prefix and suffix products, so that this is O(degree) per entry.
+	for (int mm=0; mm<BED->num_jac_equations; mm++) {
+		int curr_degree = BED->max_degree;
+
+		dot_product_mp(*temp, BED->v_linears[mm], (*curr_v_vars));  // everything here is multiplied by (v_linear •	v)
+		leave_one_out_products_mp(*linprod_cofactors, (*lin_func_vals)->entry[mm], curr_degree, *temp, *running_prod);
+
 		for (int kk=0; kk<(BED->num_natural_vars+BED->num_synth_vars); kk++) { // for each variable
 			set_zero_mp(&(*linprod_derivative_wrt_x)->entry[mm][kk]); // initialize to 0 for the sum
 
-			for (int ii=0; ii<BED->max_degree; ++ii) { //  for each linear
-
-				set_mp(*running_prod, &BED->starting_linears[mm][ii]->coord[kk]);// initialize the product
-				for (int jj=0; jj<BED->max_degree; jj++) {
-					if (jj!=ii) {
-						mul_mp(*running_prod,*running_prod,&(*lin_func_vals)->entry[mm][jj]); // the linear evaluated at curr_var_vals
-					}
-				}//re: jj
+			for (int ii=0; ii<curr_degree; ++ii) { //  for each linear
+				mul_mp(*running_prod, &(*linprod_cofactors)->coord[ii], &BED->starting_linears[mm][ii]->coord[kk]);
 				add_mp(&(*linprod_derivative_wrt_x)->entry[mm][kk],&(*linprod_derivative_wrt_x)->entry[mm][kk],*running_prod);
-
-			}// re:ii
-
-			dot_product_mp(*temp, BED->v_linears[mm], (*curr_v_vars));  // these two lines multiply by  (v_linear •	v)
-			mul_mp(&(*linprod_derivative_wrt_x)->entry[mm][kk], &(*linprod_derivative_wrt_x)->entry[mm][kk], *temp);
+			}
 		} // re: kk
 	} // re: mm
 
@@ -4532,24 +4558,7 @@ int nullspacejac_left_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer
 
 
 
-	if (print_this_path)
-	{
-
-		BED->num_steps++;
-
-		mpf_out_str (g_path_file, 10, 0, pathVars->r);
-		fprintf(g_path_file," ");
-		mpf_out_str (g_path_file, 10, 0, pathVars->i);
-		fprintf(g_path_file," ");
-		for (int ii=0; ii<BED->num_variables; ++ii) {
-			mpf_out_str (g_path_file, 10, 0, current_variable_values->coord[ii].r);
-			fprintf(g_path_file," ");
-			mpf_out_str (g_path_file, 10, 0, current_variable_values->coord[ii].i);
-			fprintf(g_path_file," ");
-		}
-		fprintf(g_path_file,"\n");
-
-	}
+	BED->num_steps++;
 
 
 	return 0;
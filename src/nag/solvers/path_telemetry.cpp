@@ -0,0 +1,119 @@
+#include "nag/solvers/path_telemetry.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+
+
+namespace {
+
+	/**
+	 \brief the number to give the next solve written by this process, or -1 if not yet read from the file.
+	 */
+	int next_solve_number = -1;
+
+
+	/**
+	 \brief one more than the largest solve number already in a telemetry file, so that runs appending to the same file do not reuse solve numbers.
+
+	 \return the first unused solve number, 0 if the file does not exist.
+	 \param filename The telemetry file.
+	 */
+	int FirstUnusedSolveNumber(boost::filesystem::path const& filename)
+	{
+		FILE *IN = fopen(filename.c_str(), "r");
+		if (IN==NULL)
+			return 0;
+
+		int next = 0;
+		char line[1024];
+		while (fgets(line, sizeof(line), IN)!=NULL) {
+			int solve; // the header line does not start with a number.
+			if (sscanf(line, "%d,", &solve)==1)
+				next = std::max(next, solve+1);
+		}
+
+		fclose(IN);
+		return next;
+	}
+
+} // re: anonymous namespace
+
+
+
+
+void PathTelemetry::Write(boost::filesystem::path const& filename) const
+{
+	bool is_new = !boost::filesystem::exists(filename);
+
+	if (next_solve_number<0)
+		next_solve_number = FirstUnusedSolveNumber(filename);
+
+	FILE *OUT = fopen(filename.c_str(), "a");
+	if (OUT==NULL)
+		throw std::runtime_error("unable to open path telemetry file " + filename.string() + " for appending");
+
+	if (is_new)
+		fprintf(OUT, "solve,solver,path,worker,seconds,evaluations,passes,precision,batched,retval\n");
+
+	for (auto const& r : records_)
+		fprintf(OUT, "%d,%s,%d,%d,%.6f,%lld,%d,%d,%d,%d\n",
+				next_solve_number, solver_name_.c_str(), r.path_number, r.worker, r.wall_time,
+				r.num_evaluations, r.num_passes, r.final_precision, r.batched, r.retVal);
+
+	fclose(OUT);
+	next_solve_number++;
+}
+
+
+
+
+void PathTelemetry::PrintSummary(std::ostream & os) const
+{
+	if (records_.empty())
+		return;
+
+	double total_time = 0;
+	long long total_evaluations = 0;
+	int num_retracked = 0, num_batched = 0;
+	std::map<int,int> by_precision, by_retval;
+
+	for (auto const& r : records_) {
+		total_time += r.wall_time;
+		total_evaluations += r.num_evaluations;
+		if (r.num_passes>1)
+			num_retracked++;
+		if (r.batched)
+			num_batched++;
+		by_precision[r.final_precision]++;
+		by_retval[r.retVal]++;
+	}
+
+	os << solver_name_ << " solve, " << records_.size() << " paths: " << total_time << "s tracking, "
+	   << total_time/records_.size() << "s and " << double(total_evaluations)/records_.size() << " evaluations per path, "
+	   << num_retracked << " retracked, " << num_batched << " batch-advanced\n";
+
+	os << "\tfinal precision:";
+	for (auto const& p : by_precision)
+		os << " " << p.first << " bits (" << p.second << ")";
+	os << "\n";
+
+	os << "\tretVal:";
+	for (auto const& p : by_retval)
+		os << " " << p.first << " (" << p.second << ")";
+	os << "\n";
+
+
+	// the slowest few paths, which are usually the ones worth looking at.
+	std::vector<PathRecord> slowest(records_);
+	const unsigned num_to_show = std::min<unsigned>(5, slowest.size());
+	std::partial_sort(slowest.begin(), slowest.begin()+num_to_show, slowest.end(),
+					  [](PathRecord const& a, PathRecord const& b){return a.wall_time > b.wall_time;});
+
+	os << "\tslowest paths:";
+	for (unsigned ii=0; ii<num_to_show; ii++)
+		os << " " << slowest[ii].path_number << " (" << slowest[ii].wall_time << "s, worker " << slowest[ii].worker << ")";
+	os << std::endl;
+}
@@ -1,4 +1,5 @@
 #include "nag/solvers/solver.hpp"
+#include "nag/solvers/batch_tracker.hpp"
 
 
 extern _comp_d  **mem_d;
@@ -8,9 +9,6 @@ extern int *size_mp;  // size of mem_mp
 extern int *mem_needs_init_d; // determine if mem_d has been initialized
 extern int *mem_needs_init_mp; // determine if mem_mp has been initialized
 
-FILE* g_path_file;
-bool print_this_path;
-static const std::set<int> print_these_paths{344};
 
 
 
@@ -86,6 +84,8 @@ void SolverConfiguration::init()
 	total_num_paths_tracked = 0;
 
 	robust = true;
+	batch_size = 0;
+	path_telemetry = false;
 
 	PPD.num_funcs = 0;
 	PPD.num_hom_var_gp = 0;
@@ -241,9 +241,9 @@ int Solver::send(ParallelismConfig & mpi_config)
 	buffer[2] = this->verbose_level_;
 	buffer[3] = this->MPType;
 
-	MPI_Bcast(buffer, 4, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 4, MPI_INT, mpi_config.head(), mpi_config.comm());
 
-	send_preproc_data(&this->preProcData);
+	send_preproc_data(&this->preProcData, mpi_config.head(), mpi_config.comm());
 
 
 	delete[] buffer;
@@ -259,14 +259,14 @@ int Solver::receive(ParallelismConfig & mpi_config)
 	int *buffer = new int[4];
 
 
-	MPI_Bcast(buffer, 4, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 4, MPI_INT, mpi_config.head(), mpi_config.comm());
 
 	this->num_variables = buffer[0];
 	this->num_steps = buffer[1];
 	this->verbose_level(buffer[2]);
 	this->MPType = buffer[3];
 
-	receive_preproc_data(&this->preProcData);
+	receive_preproc_data(&this->preProcData, mpi_config.head(), mpi_config.comm());
 	have_PPD = true;
 
 
@@ -312,7 +312,7 @@ void SolverMultiplePrecision::clear()
 
 
 	if (have_SLP && received_mpi) { // other wise don't have it, or someone else is responsible for clearing it.
-		clearProg(this->SLP, this->MPType, 1); // 1 means call freeprogeval()
+		clear_prog(this->SLP, this->MPType, 1); // 1 means call freeprogeval()
 		delete[] SLP;
 	}
 
@@ -334,15 +334,15 @@ int SolverMultiplePrecision::send(ParallelismConfig & mpi_config)
     else
         num_SLP = 0;
 
-    MPI_Bcast(&num_SLP, 1, MPI_INT, 0, mpi_config.comm());
+    MPI_Bcast(&num_SLP, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 
     for (int ii=0; ii<num_SLP; ii++) {
-        bcast_prog_t(this->SLP, MPType, 0, 0);
+        bcast_send_prog(this->SLP, MPType, mpi_config);
     }
 
 
 
-	send_patch_mp(&this->patch);
+	send_patch_mp(&this->patch, mpi_config.head(), mpi_config.comm());
 
 
 	bcast_comp_mp(this->gamma, 0,0);
@@ -357,7 +357,7 @@ int SolverMultiplePrecision::send(ParallelismConfig & mpi_config)
 	int * buffer;
 	buffer = new int[1];
 	buffer[0] = this->curr_prec;
-	MPI_Bcast(buffer, 1, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 	delete[] buffer;
 
 
@@ -375,19 +375,19 @@ int SolverMultiplePrecision::receive(ParallelismConfig & mpi_config)
 
 
     if (this->have_SLP) {
-        clearProg(this->SLP, this->MPType, 1);
+        clear_prog(this->SLP, this->MPType, 1);
         this->have_SLP = false;
     }
 
     received_mpi = true;
     int num_SLP;
-    MPI_Bcast(&num_SLP, 1, MPI_INT, 0, mpi_config.comm()); // get the number of SLP's to receieve
+    MPI_Bcast(&num_SLP, 1, MPI_INT, mpi_config.head(), mpi_config.comm()); // get the number of SLP's to receieve
 
     if (num_SLP>0) {
         prog_t * _SLP = new prog_t[num_SLP];//(prog_t *) br_malloc(num_SLP*sizeof(prog_t));
         for (int ii=0; ii<num_SLP; ii++) {
             //			std::cout << "worker bcasting the SLP, MPType" << this->MPType << std::endl;
-            bcast_prog_t(&_SLP[ii], this->MPType, 1, 0); // last two arguments are: myid, headnode
+            bcast_receive_prog(&_SLP[ii], this->MPType, mpi_config);
 														 //			std::cout << "worker copying the SLP" << std::endl;
             this->SLP = &_SLP[ii];
             //			cp_prog_t(this->SLP, &_SLP[ii]);
@@ -399,7 +399,7 @@ int SolverMultiplePrecision::receive(ParallelismConfig & mpi_config)
 		SLP_memory.capture_globals();
     }
 
-	receive_patch_mp(&this->patch);
+	receive_patch_mp(&this->patch, mpi_config.head(), mpi_config.comm());
 
 	bcast_comp_mp(this->gamma, 1,0);
 
@@ -415,7 +415,7 @@ int SolverMultiplePrecision::receive(ParallelismConfig & mpi_config)
 
 	int *buffer = new int[1];
 
-	MPI_Bcast(buffer, 1, MPI_INT, 0, mpi_config.comm());
+	MPI_Bcast(buffer, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 	this->curr_prec = buffer[0];
 
 	delete[] buffer;
@@ -453,7 +453,7 @@ void SolverDoublePrecision::clear(){
 
 
 	if (have_SLP && received_mpi) {
-		clearProg(this->SLP, this->MPType, 1); // 1 means call freeprogeval()
+		clear_prog(this->SLP, this->MPType, 1); // 1 means call freeprogeval()
 		delete[] SLP;
 	}
 }
@@ -473,18 +473,18 @@ int SolverDoublePrecision::send(ParallelismConfig & mpi_config)
         else
             num_SLP = 0;
 
-        MPI_Bcast(&num_SLP, 1, MPI_INT, 0, mpi_config.comm());
+        MPI_Bcast(&num_SLP, 1, MPI_INT, mpi_config.head(), mpi_config.comm());
 
         for (int ii=0; ii<num_SLP; ii++) {
             //		std::cout << "master bcasting the SLP, MPType" << this->MPType << std::endl;
-            bcast_prog_t(this->SLP, MPType, 0, 0);
+            bcast_send_prog(this->SLP, MPType, mpi_config);
         }
     }
 
 
 
 
-	send_patch_d(&(this->patch));
+	send_patch_d(&(this->patch), mpi_config.head(), mpi_config.comm());
 
 	bcast_comp_d(this->gamma, 0,0);
 
@@ -508,18 +508,18 @@ int SolverDoublePrecision::receive(ParallelismConfig & mpi_config)
     if (this->MPType == 0) {
         received_mpi = true;
         if (this->have_SLP) {
-            clearProg(this->SLP, this->MPType, 1);
+            clear_prog(this->SLP, this->MPType, 1);
             this->have_SLP = false;
         }
 
 
         int num_SLP;
-        MPI_Bcast(&num_SLP, 1, MPI_INT, 0, mpi_config.comm()); // get the number of SLP's to receieve
+        MPI_Bcast(&num_SLP, 1, MPI_INT, mpi_config.head(), mpi_config.comm()); // get the number of SLP's to receieve
 
         if (num_SLP>0) {
             prog_t * _SLP = new prog_t[num_SLP];
             for (int ii=0; ii<num_SLP; ii++) {
-                bcast_prog_t(&_SLP[ii], this->MPType, 1, 0); // last two arguments are: myid, headnode
+                bcast_receive_prog(&_SLP[ii], this->MPType, mpi_config);
                 this->SLP = &_SLP[ii];
 
             }
@@ -539,7 +539,7 @@ int SolverDoublePrecision::receive(ParallelismConfig & mpi_config)
 
 
 
-	receive_patch_d(&this->patch); // the receiving part of the broadcast
+	receive_patch_d(&this->patch, mpi_config.head(), mpi_config.comm()); // the receiving part of the broadcast
 
 	bcast_comp_d(this->gamma, 1, 0);
 
@@ -636,7 +636,7 @@ void master_solver(SolverOutput & solve_out, const WitnessSet & W,
 		settings_buffer[0] = solve_options.robust;
 		settings_buffer[1] = solve_options.use_gamma_trick;
 
-		MPI_Bcast(settings_buffer,2,MPI_INT, 0, solve_options.comm());
+		MPI_Bcast(settings_buffer,2,MPI_INT, solve_options.head(), solve_options.comm());
 		free(settings_buffer);
 
 		switch (solve_options.T.MPType) {
@@ -680,6 +680,9 @@ void master_solver(SolverOutput & solve_out, const WitnessSet & W,
 	                        &MIDOUT, mid_name.str());
 
 
+	PathTelemetry telemetry(solve_options.T.MPType==1 ? ED_mp->name() : ED_d->name());
+	RunProfile::Instance().CountSolve(W.num_points());
+
 	if (solve_options.use_parallel()) {
 
 
@@ -687,14 +690,16 @@ void master_solver(SolverOutput & solve_out, const WitnessSet & W,
                             W,
                             endPoints,
                             ED_d, ED_mp,
-                            solve_options);
+                            solve_options,
+                            telemetry);
 	}
 	else{
 		serial_tracker_loop(&trackCount, OUT, MIDOUT,
                              W,
                              endPoints,
                              ED_d, ED_mp,
-                             solve_options);
+                             solve_options,
+                             telemetry);
 	}
 
 
@@ -703,6 +708,12 @@ void master_solver(SolverOutput & solve_out, const WitnessSet & W,
 	fclose(MIDOUT);   fclose(OUT);
 
 
+	if (solve_options.path_telemetry) {
+		telemetry.Write(PathTelemetry::DefaultName());
+		telemetry.PrintSummary(std::cout);
+	}
+
+
 
 
 	// check for path crossings
@@ -790,12 +801,27 @@ void generic_set_start_pts(point_data_mp ** startPts,
 
 
 
+long long num_evaluations_so_far(SolverDoublePrecision const* ED_d, SolverMultiplePrecision const* ED_mp, int MPType)
+{
+	switch (MPType) {
+		case 0:
+			return ED_d->num_steps;
+		case 1:
+			return ED_mp->num_steps;
+		default:
+			return ED_d->num_steps + ED_mp->num_steps;
+	}
+}
+
+
+
 void serial_tracker_loop(trackingStats *trackCount,
                           FILE * OUT, FILE * MIDOUT,
                           const WitnessSet & W,  // was the startpts file pointer.
                           post_process_t *endPoints,
                           SolverDoublePrecision * ED_d, SolverMultiplePrecision * ED_mp,
-                          SolverConfiguration & solve_options)
+                          SolverConfiguration & solve_options,
+                          PathTelemetry & telemetry)
 {
 
 
@@ -841,6 +867,16 @@ void serial_tracker_loop(trackingStats *trackCount,
 	init_endgame_data(&EG, solve_options.T.Precision);
 
 
+	// paths are advanced toward the endgame a block at a time, in double precision, if asked.
+	const bool use_batch = solve_options.batch_size>1 && solve_options.T.MPType!=1;
+	const unsigned batch_size = use_batch ? solve_options.batch_size : 1;
+	BatchTrackerDouble batch_tracker(batch_size);
+	std::vector<bool> advanced;
+	point_data_d *advancedPts_d = (point_data_d *)br_malloc(batch_size * sizeof(point_data_d));
+	for (unsigned ii=0; ii<batch_size; ii++)
+		init_point_data_d(&advancedPts_d[ii], W.num_variables());
+
+
 
 
 	trackCount->numPoints = W.num_points();
@@ -862,33 +898,27 @@ void serial_tracker_loop(trackingStats *trackCount,
 
 		}
 
-		solve_options.increment_num_paths_tracked();
-
-		auto n = solve_options.num_paths_tracked();
-		print_this_path = 0;//print_these_paths.find(n)!=print_these_paths.end();
-		if (print_this_path){
-			std::stringstream ss;
-			ss << "paths/path_" << n;
-			g_path_file = safe_fopen_write(ss.str());
-		} 
-
-		if (solve_options.robust) {
-			robust_track_path(ii, &EG,
-                              &startPts_d[ii], &startPts_mp[ii],
-                              OUT, MIDOUT,
-                              solve_options, ED_d, ED_mp,
-                              curr_eval_d, curr_eval_mp, change_prec, find_dehom);
+		if (use_batch && (ii%batch_size)==0) {
+			batch_tracker.advance(advancedPts_d, advanced,
+								  &startPts_d[ii], std::min<unsigned>(batch_size, W.num_points()-ii),
+								  solve_options.T, ED_d, curr_eval_d);
 		}
-		else{
-			generic_track_path(ii, &EG,
-                               &startPts_d[ii], &startPts_mp[ii],
-                               OUT, MIDOUT,
-                               &solve_options.T, ED_d, ED_mp,
-                               curr_eval_d, curr_eval_mp, change_prec, find_dehom);
 
-		}
+		solve_options.increment_num_paths_tracked();
 
-		if (print_this_path) fclose(g_path_file);
+		PathRecord record;
+		record.path_number = ii;
+		record.worker = solve_options.id();
+		record.batched = use_batch && advanced[ii%batch_size];
+		record.num_evaluations = -num_evaluations_so_far(ED_d, ED_mp, solve_options.T.MPType);
+		boost::timer::cpu_timer timer;
+
+		record.num_passes = track_path_from_best_start(ii, &EG,
+								   &startPts_d[ii], &startPts_mp[ii],
+								   record.batched ? &advancedPts_d[ii%batch_size] : NULL,
+								   OUT, MIDOUT,
+								   solve_options, ED_d, ED_mp,
+								   curr_eval_d, curr_eval_mp, change_prec, find_dehom);
 
 		// check to see if it should be sharpened
 		if (EG.retVal == 0 && solve_options.T.sharpenDigits > 0)
@@ -896,6 +926,12 @@ void serial_tracker_loop(trackingStats *trackCount,
 			sharpen_endpoint_endgame(&EG, &solve_options.T, OUT, ED_d, ED_mp, curr_eval_d, curr_eval_mp, change_prec);
 		}
 
+		record.wall_time = timer.elapsed().wall*1e-9;
+		record.num_evaluations += num_evaluations_so_far(ED_d, ED_mp, solve_options.T.MPType);
+		record.final_precision = EG.prec;
+		record.retVal = EG.retVal;
+		telemetry.Add(record);
+
 
 
 		int issoln;
@@ -975,6 +1011,10 @@ void serial_tracker_loop(trackingStats *trackCount,
     free(startPts_d);
 	free(startPts_mp);
 
+	for (unsigned ii=0; ii<batch_size; ii++)
+		clear_point_data_d(&advancedPts_d[ii]);
+	free(advancedPts_d);
+
 
 
 }
@@ -998,7 +1038,8 @@ void master_tracker_loop(trackingStats *trackCount,
                          const WitnessSet & W,  // was the startpts file pointer.
                          post_process_t *endPoints,
                          SolverDoublePrecision * ED_d, SolverMultiplePrecision * ED_mp,
-                         SolverConfiguration & solve_options)
+                         SolverConfiguration & solve_options,
+                         PathTelemetry & telemetry)
 {
 
 
@@ -1068,7 +1109,8 @@ void master_tracker_loop(trackingStats *trackCount,
 						  solution_counter,
 						  endPoints,
 						  ED_d, ED_mp,
-						  solve_options);
+						  solve_options,
+						  telemetry);
 
 
 
@@ -1090,7 +1132,8 @@ void master_tracker_loop(trackingStats *trackCount,
 						  solution_counter,
 						  endPoints,
 						  ED_d, ED_mp,
-						  solve_options);
+						  solve_options,
+						  telemetry);
 	} // re: while have active
 
 
@@ -1185,6 +1228,17 @@ void worker_tracker_loop(trackingStats *trackCount,
 
 	int *indices_incoming = (int *) br_malloc(1*sizeof(int));
 
+
+	// each packet of paths is advanced toward the endgame a block at a time, in double precision, if asked.
+	const bool use_batch = solve_options.batch_size>1 && solve_options.T.MPType!=1;
+	BatchTrackerDouble batch_tracker(use_batch ? solve_options.batch_size : 1);
+	std::vector<bool> advanced;
+	point_data_d *advancedPts_d = NULL;
+	if (use_batch) {
+		advancedPts_d = (point_data_d *) br_malloc(1*sizeof(point_data_d));
+		init_point_data_d(&advancedPts_d[0], ED_d->num_variables);
+	}
+
 	MPI_Status statty_mc_gatty;
 	int max_num_allocated = 1;
 
@@ -1221,6 +1275,16 @@ void worker_tracker_loop(trackingStats *trackCount,
 					for (int zz=0; zz<numStartPts; zz++) {
 						init_point_data_d(&startPts_d[zz], ED_d->num_variables);
 					}
+
+					if (use_batch) {
+						for (int zz=0; zz<max_num_allocated; zz++) {
+							clear_point_data_d(&advancedPts_d[zz]);
+						}
+						advancedPts_d = (point_data_d *) br_realloc(advancedPts_d, numStartPts*sizeof(point_data_d));
+						for (int zz=0; zz<numStartPts; zz++) {
+							init_point_data_d(&advancedPts_d[zz], ED_d->num_variables);
+						}
+					}
 					break;
 			}
 
@@ -1241,18 +1305,26 @@ void worker_tracker_loop(trackingStats *trackCount,
 		for (int ii=0; ii<numStartPts; ii++) {
 			switch (solve_options.T.MPType) {
 				case 1:
-					receive_vec_mp(startPts_mp[ii].point, solve_options.head());
+					receive_vec_mp(startPts_mp[ii].point, solve_options.head(), solve_options.comm());
 					set_one_mp(startPts_mp[ii].time);
 					break;
 
 				default:
-					receive_vec_d(startPts_d[ii].point, solve_options.head());
+					receive_vec_d(startPts_d[ii].point, solve_options.head(), solve_options.comm());
 					set_one_d(startPts_d[ii].time);
 					break;
 			}
 		}
 
 
+		if (use_batch) {
+			batch_tracker.advance(advancedPts_d, advanced,
+								  startPts_d, numStartPts,
+								  solve_options.T, ED_d, curr_eval_d);
+		}
+
+		std::vector<PathRecord> records(numStartPts);
+
 		// track each of the start points
 		for (int ii = 0; ii < numStartPts; ii++)
 		{
@@ -1272,23 +1344,19 @@ void worker_tracker_loop(trackingStats *trackCount,
 
 
 
-            if (solve_options.robust) {
-				//                boost::timer::auto_cpu_timer t;
-                robust_track_path(indices_incoming[ii], &EG[ii],
-                                  &startPts_d[ii], &startPts_mp[ii],
-                                  OUT, MIDOUT,
-                                  solve_options, ED_d, ED_mp,
-                                  curr_eval_d, curr_eval_mp, change_prec, find_dehom);
+			PathRecord & record = records[ii];
+			record.path_number = current_index;
+			record.worker = solve_options.id();
+			record.batched = use_batch && advanced[ii];
+			record.num_evaluations = -num_evaluations_so_far(ED_d, ED_mp, solve_options.T.MPType);
+			boost::timer::cpu_timer timer;
 
-            }
-            else{
-                // track the path
-                generic_track_path(indices_incoming[ii], &EG[ii],
-                                   &startPts_d[ii], &startPts_mp[ii],
-                                   OUT, MIDOUT,
-                                   &solve_options.T, ED_d, ED_mp,
-                                   curr_eval_d, curr_eval_mp, change_prec, find_dehom);
-            }
+            record.num_passes = track_path_from_best_start(indices_incoming[ii], &EG[ii],
+                                       &startPts_d[ii], &startPts_mp[ii],
+                                       record.batched ? &advancedPts_d[ii] : NULL,
+                                       OUT, MIDOUT,
+                                       solve_options, ED_d, ED_mp,
+                                       curr_eval_d, curr_eval_mp, change_prec, find_dehom);
 
 
 
@@ -1298,6 +1366,11 @@ void worker_tracker_loop(trackingStats *trackCount,
 				sharpen_endpoint_endgame(&EG[ii], &solve_options.T, OUT, ED_d, ED_mp, curr_eval_d, curr_eval_mp, change_prec);
 			}
 
+			record.wall_time = timer.elapsed().wall*1e-9;
+			record.num_evaluations += num_evaluations_so_far(ED_d, ED_mp, solve_options.T.MPType);
+			record.final_precision = EG[ii].prec;
+			record.retVal = EG[ii].retVal;
+
 
 
 		}// re: for (ii=0; ii<W.num_points ;ii++)
@@ -1306,6 +1379,7 @@ void worker_tracker_loop(trackingStats *trackCount,
 		MPI_Send(&numStartPts, 1, MPI_INT, solve_options.head(), NUMPACKETS, solve_options.comm());
 
 		send_recv_endgame_data_t(&EG, &numStartPts, solve_options.T.MPType, solve_options.head(), 1); //1 is 'issending'
+		MPI_Send(records.data(), numStartPts*sizeof(PathRecord), MPI_BYTE, solve_options.head(), PATH_TELEMETRY, solve_options.comm());
 
 
 	}
@@ -1331,6 +1405,13 @@ void worker_tracker_loop(trackingStats *trackCount,
 				clear_endgame_data(&EG[ii]);
 			}
 			free(startPts_d);
+
+			if (use_batch) {
+				for (int ii=0; ii<max_num_allocated; ii++) {
+					clear_point_data_d(&advancedPts_d[ii]);
+				}
+				free(advancedPts_d);
+			}
 			break;
 	}
 	free(EG);
@@ -1372,12 +1453,12 @@ void send_start_points(int next_worker, int num_packets,
 
 	for (int ii=indices_outgoing[0]; ii<=indices_outgoing[num_packets-1]; ii++) {
 		if (solve_options.T.MPType==1) {
-			send_vec_mp( startPts_mp[ii].point, next_worker);
+			send_vec_mp( startPts_mp[ii].point, next_worker, solve_options.comm());
 
 		}
 		else
 		{
-			send_vec_d( startPts_d[ii].point, next_worker);
+			send_vec_d( startPts_d[ii].point, next_worker, solve_options.comm());
 
 		}
 	}
@@ -1392,7 +1473,8 @@ int receive_endpoints(trackingStats *trackCount,
                       int & solution_counter,
                       post_process_t *endPoints,
                       SolverDoublePrecision * ED_d, SolverMultiplePrecision * ED_mp,
-                      SolverConfiguration & solve_options)
+                      SolverConfiguration & solve_options,
+                      PathTelemetry & telemetry)
 {
 
 
@@ -1424,6 +1506,10 @@ int receive_endpoints(trackingStats *trackCount,
 
 	int incoming_id = send_recv_endgame_data_t(EG_receives, &num_incoming, solve_options.T.MPType, statty_mc_gatty.MPI_SOURCE, 0); // the trailing 0 indicates receiving
 
+	std::vector<PathRecord> records(num_incoming);
+	MPI_Recv(records.data(), num_incoming*sizeof(PathRecord), MPI_BYTE, statty_mc_gatty.MPI_SOURCE, PATH_TELEMETRY, solve_options.comm(), &statty_mc_gatty);
+	telemetry.Add(records.data(), num_incoming);
+
 
 	solve_options.deactivate(statty_mc_gatty.MPI_SOURCE);
 
@@ -1621,7 +1707,7 @@ void generic_track_path(int pathNum, endgame_data_t *EG_out,
 
 
 
-void robust_track_path(int pathNum, endgame_data_t *EG_out,
+int robust_track_path(int pathNum, endgame_data_t *EG_out,
                        point_data_d *Pin, point_data_mp *Pin_mp,
                        FILE *OUT, FILE *MIDOUT,
                        SolverConfiguration & solve_options,
@@ -1934,12 +2020,81 @@ void robust_track_path(int pathNum, endgame_data_t *EG_out,
 	solve_options.restore_tracker_config("robust_init");
 
 
-	return;
+	return std::max(iterations,1);
 } // re: robust_track_path
 
 
 
 
+int track_path_from_best_start(int pathNum, endgame_data_t *EG_out,
+								point_data_d *Pin, point_data_mp *Pin_mp, point_data_d *advanced_pt,
+								FILE *OUT, FILE *MIDOUT,
+								SolverConfiguration & solve_options,
+								SolverDoublePrecision *ED_d, SolverMultiplePrecision *ED_mp,
+								int (*eval_func_d)(point_d, point_d, vec_d, mat_d, mat_d, point_d, comp_d, void const *),
+								int (*eval_func_mp)(point_mp, point_mp, vec_mp, mat_mp, mat_mp, point_mp, comp_mp, void const *),
+								int (*change_prec)(void const *, int),
+								int (*find_dehom)(point_d, point_mp, int *, point_d, point_mp, int, void const *, void const *))
+{
+	auto track = [&](point_data_d *start, FILE *TRACKOUT, FILE *TRACKMID)
+	{
+		if (solve_options.robust) {
+			return robust_track_path(pathNum, EG_out,
+							  start, Pin_mp,
+							  TRACKOUT, TRACKMID,
+							  solve_options, ED_d, ED_mp,
+							  eval_func_d, eval_func_mp, change_prec, find_dehom);
+		}
+		else{
+			generic_track_path(pathNum, EG_out,
+							   start, Pin_mp,
+							   TRACKOUT, TRACKMID,
+							   &solve_options.T, ED_d, ED_mp,
+							   eval_func_d, eval_func_mp, change_prec, find_dehom);
+			return 1;
+		}
+	};
+
+
+	int num_passes = 0;
+	if (advanced_pt!=NULL) {
+		// the attempt from the batch-advanced point writes to scratch files, which are kept only if it is accepted, so the path is recorded once.
+		std::stringstream ss;
+		ss<<"batch_midpath_temp_"<<solve_options.id();
+		boost::filesystem::path midname = ss.str();
+		ss.clear(); ss.str("");
+		ss<<"batch_output_temp_"<<solve_options.id();
+		boost::filesystem::path outname = ss.str();
+
+		FILE *TEMPMID = safe_fopen_write(midname);
+		FILE *TEMPOUT = safe_fopen_write(outname);
+		num_passes = track(advanced_pt, TEMPOUT, TEMPMID);
+		fclose(TEMPMID); fclose(TEMPOUT);
+
+		bool accepted = IsAcceptableRetval(EG_out->retVal);
+		if (accepted) {
+			TEMPMID = safe_fopen_read(midname);
+			TEMPOUT = safe_fopen_read(outname);
+			copyfile(TEMPOUT,OUT);
+			copyfile(TEMPMID,MIDOUT);
+			fclose(TEMPMID); fclose(TEMPOUT);
+		}
+		boost::filesystem::remove(midname);
+		boost::filesystem::remove(outname);
+
+		if (accepted)
+			return num_passes;
+
+		if (solve_options.verbose_level()>=3)
+			std::cout << color::gray() << "path " << pathNum << " failed from its batch-advanced point, retracking from its start point" << color::console_default() << std::endl;
+	}
+
+	return num_passes + track(Pin, OUT, MIDOUT);
+}
+
+
+
+
 
 
 bool IsAcceptableRetval(int retval)
@@ -2089,38 +2244,3 @@ int generic_setup_files(FILE ** OUT, boost::filesystem::path outname,
 }
 
 
-
-
-
-int print_path(comp_d pathVars, mat_d AtimesJ, vec_d current_variable_values, vec_d funcVals, mat_d Jv)
-{
-	fprintf(g_path_file,"%.15g %.15g ", pathVars->r, pathVars->i);
-	for (int ii=0; ii<current_variable_values->size; ++ii) {
-		fprintf(g_path_file,"%.15g %.15g ",current_variable_values->coord[ii].r,current_variable_values->coord[ii].i);
-	}
-	fprintf(g_path_file, "%.15e  ", ConditionNumber(Jv));
-	fprintf(g_path_file,"\n");
-	return 0;
-}
-
-int print_path(comp_mp pathVars, mat_mp AtimesJ, vec_mp current_variable_values, vec_mp funcVals, mat_mp Jv)
-{
-	// the `g` is for global
-
-	mpf_out_str (g_path_file, 10, 0, pathVars->r);
-	fprintf(g_path_file," ");
-	mpf_out_str (g_path_file, 10, 0, pathVars->i);
-	fprintf(g_path_file," ");
-	for (int ii=0; ii<current_variable_values->size; ++ii) { 
-		mpf_out_str (g_path_file, 10, 0, current_variable_values->coord[ii].r);
-		fprintf(g_path_file," ");
-		mpf_out_str (g_path_file, 10, 0, current_variable_values->coord[ii].i);
-		fprintf(g_path_file," ");
-	}
-
-	fprintf(g_path_file, "%.15e ", ConditionNumber(Jv));
-	fprintf(g_path_file,"\n");
-	return 0;
-}
-
-
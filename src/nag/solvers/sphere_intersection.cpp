@@ -6,7 +6,7 @@ void SphereConfiguration::set_memory(SolverConfiguration & solve_options)
 
 	//TODO: should i assume here that the input file is already parsed??  (as i already do)
 	this->MPType = solve_options.T.MPType;
-	solve_options.T.numVars = setupProg(SLP, solve_options.T.Precision, solve_options.T.MPType);
+	solve_options.T.numVars = setup_prog(SLP, solve_options.T.Precision, solve_options.T.MPType);
 	//make randomizer matrix here
 	SLP_memory.capture_globals();
 	SLP_memory.set_globals_null();
@@ -328,10 +328,21 @@ int sphere_eval_data_mp::setup(SphereConfiguration & config,
 		}
 	}
 
+	reserve_temporaries();
 
+	return 0;
+}
 
 
-	return 0;
+void sphere_eval_data_mp::reserve_temporaries()
+{
+	temp_vars.ensure_have_scalars(6);
+	temp_vars.ensure_have_vectors(3);
+	temp_vars.ensure_have_matrices(4);
+
+	increase_size_vec_mp(temp_vars.vectors[2], randomizer()->num_rand_funcs());
+	increase_size_mat_mp(temp_vars.matrices[0], randomizer()->num_base_funcs(), num_variables);
+	increase_size_mat_mp(temp_vars.matrices[3], randomizer()->num_rand_funcs(), num_variables);
 }
 
 
@@ -553,10 +564,23 @@ int sphere_eval_data_d::setup(SphereConfiguration & config,
 		rat_to_d(this->gamma, this->BED_mp->gamma_rat);
 	}
 
+	reserve_temporaries();
+
 	return 0;
 }
 
 
+void sphere_eval_data_d::reserve_temporaries()
+{
+	temp_vars.ensure_have_vectors(3);
+	temp_vars.ensure_have_matrices(4);
+
+	increase_size_vec_d(temp_vars.vectors[2], randomizer()->num_rand_funcs());
+	increase_size_mat_d(temp_vars.matrices[0], randomizer()->num_base_funcs(), num_variables);
+	increase_size_mat_d(temp_vars.matrices[3], randomizer()->num_rand_funcs(), num_variables);
+}
+
+
 
 
 
@@ -675,7 +699,7 @@ int sphere_slave_entry_point(SolverConfiguration & solve_options)
 	bcast_tracker_config_t(&solve_options.T, solve_options.id(), solve_options.head() );
 
 	int *settings_buffer = (int *) br_malloc(2*sizeof(int));
-	MPI_Bcast(settings_buffer,2,MPI_INT, 0,solve_options.comm());
+	MPI_Bcast(settings_buffer,2,MPI_INT, solve_options.head(), solve_options.comm());
 	solve_options.robust = settings_buffer[0];
 	solve_options.use_gamma_trick = settings_buffer[1];
 	free(settings_buffer);
@@ -765,17 +789,20 @@ int sphere_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, mat
 	mul_d(gamma_s, BED->gamma, pathVars);       // gamma_s = gamma * s
 
 
-	vec_d patchValues; init_vec_d(patchValues, 0);
-	vec_d temp_function_values; init_vec_d(temp_function_values,0);
-	vec_d AtimesF; init_vec_d(AtimesF,BED->randomizer()->num_rand_funcs()); AtimesF->size = BED->randomizer()->num_rand_funcs();// declare  // initialize
+	// the temporaries persist in the eval data, so that evaluation does no allocation.
+	BED->reserve_temporaries();
 
+	vec_d &patchValues = BED->temp_vars.vectors[0];
+	vec_d &temp_function_values = BED->temp_vars.vectors[1];
+	vec_d &AtimesF = BED->temp_vars.vectors[2]; AtimesF->size = BED->randomizer()->num_rand_funcs();
 
 
-	mat_d temp_jacobian_functions; init_mat_d(temp_jacobian_functions,BED->randomizer()->num_base_funcs(),BED->num_variables);
+
+	mat_d &temp_jacobian_functions = BED->temp_vars.matrices[0];
 	temp_jacobian_functions->rows = BED->randomizer()->num_base_funcs(); temp_jacobian_functions->cols = BED->num_variables;
-	mat_d temp_jacobian_parameters; init_mat_d(temp_jacobian_parameters,0,0);
-	mat_d Jv_Patch; init_mat_d(Jv_Patch, 0, 0);
-	mat_d AtimesJ; init_mat_d(AtimesJ,BED->randomizer()->num_rand_funcs(),BED->num_variables);
+	mat_d &temp_jacobian_parameters = BED->temp_vars.matrices[1];
+	mat_d &Jv_Patch = BED->temp_vars.matrices[2];
+	mat_d &AtimesJ = BED->temp_vars.matrices[3];
 	AtimesJ->rows = BED->randomizer()->num_rand_funcs(); AtimesJ->cols = BED->num_variables;
 
 
@@ -1036,19 +1063,7 @@ int sphere_eval_d(point_d funcVals, point_d parVals, vec_d parDer, mat_d Jv, mat
 
 	BED->SLP_memory.set_globals_null();
 
-	clear_vec_d(patchValues);
-	clear_vec_d(temp_function_values);
-	clear_vec_d(AtimesF);
-
-
-	clear_mat_d(temp_jacobian_functions);
-	clear_mat_d(temp_jacobian_parameters);
-	clear_mat_d(Jv_Patch);
-	clear_mat_d(AtimesJ);
-
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, AtimesJ, current_variable_values, funcVals, Jv);
 
 
 	return 0;
@@ -1070,30 +1085,30 @@ int sphere_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer, mat_mp Jv
 
 	int ii, jj, mm; // counters
 	int offset;
-	comp_mp one_minus_s, gamma_s;
-	comp_mp temp, temp2;
-	comp_mp func_val_sphere, func_val_start;
-	init_mp(one_minus_s);  init_mp(gamma_s);
-	init_mp(temp);  init_mp(temp2);
-	init_mp(func_val_start);
-	init_mp(func_val_sphere);
+
+	// the temporaries persist in the eval data, at the current precision, so that evaluation does no allocation.
+	BED->reserve_temporaries();
+
+	comp_mp &one_minus_s = BED->temp_vars.scalars[0], &gamma_s = BED->temp_vars.scalars[1];
+	comp_mp &temp = BED->temp_vars.scalars[2], &temp2 = BED->temp_vars.scalars[3];
+	comp_mp &func_val_sphere = BED->temp_vars.scalars[4], &func_val_start = BED->temp_vars.scalars[5];
 
 	set_one_mp(one_minus_s);
 	sub_mp(one_minus_s, one_minus_s, pathVars);  // one_minus_s = (1 - s)
 	mul_mp(gamma_s, BED->gamma, pathVars);       // gamma_s = gamma * s
 
 
-	vec_mp patchValues; init_vec_mp(patchValues, 0);
-	vec_mp temp_function_values; init_vec_mp(temp_function_values,0);
-	vec_mp AtimesF; init_vec_mp(AtimesF,BED->randomizer()->num_rand_funcs()); AtimesF->size = BED->randomizer()->num_rand_funcs();// declare  // initialize
+	vec_mp &patchValues = BED->temp_vars.vectors[0];
+	vec_mp &temp_function_values = BED->temp_vars.vectors[1];
+	vec_mp &AtimesF = BED->temp_vars.vectors[2]; AtimesF->size = BED->randomizer()->num_rand_funcs();
 
 
 
-	mat_mp temp_jacobian_functions; init_mat_mp(temp_jacobian_functions,BED->randomizer()->num_base_funcs(),BED->num_variables);
+	mat_mp &temp_jacobian_functions = BED->temp_vars.matrices[0];
 	temp_jacobian_functions->rows = BED->randomizer()->num_base_funcs(); temp_jacobian_functions->cols = BED->num_variables;
-	mat_mp temp_jacobian_parameters; init_mat_mp(temp_jacobian_parameters,0,0);
-	mat_mp Jv_Patch; init_mat_mp(Jv_Patch, 0, 0);
-	mat_mp AtimesJ; init_mat_mp(AtimesJ,BED->randomizer()->num_rand_funcs(),BED->num_variables);
+	mat_mp &temp_jacobian_parameters = BED->temp_vars.matrices[1];
+	mat_mp &Jv_Patch = BED->temp_vars.matrices[2];
+	mat_mp &AtimesJ = BED->temp_vars.matrices[3];
 	AtimesJ->rows = BED->randomizer()->num_rand_funcs(); AtimesJ->cols = BED->num_variables;
 
 
@@ -1344,28 +1359,9 @@ int sphere_eval_mp(point_mp funcVals, point_mp parVals, vec_mp parDer, mat_mp Jv
 	}
 
 	BED->num_steps++;
-	if (print_this_path)
-		print_path(pathVars, AtimesJ, current_variable_values, funcVals, Jv);
 
 	BED->SLP_memory.set_globals_null();
 
-	clear_mp(temp);
-	clear_mp(temp2);
-	clear_mp(gamma_s);
-	clear_mp(one_minus_s);
-	clear_mp(func_val_sphere);
-	clear_mp(func_val_start);
-
-	clear_vec_mp(patchValues);
-	clear_vec_mp(temp_function_values);
-	clear_vec_mp(AtimesF);
-
-
-	clear_mat_mp(temp_jacobian_functions);
-	clear_mat_mp(temp_jacobian_parameters);
-	clear_mat_mp(Jv_Patch);
-	clear_mat_mp(AtimesJ);
-
 
 
 
@@ -1496,6 +1492,7 @@ int change_sphere_eval_prec(void const *ED, int new_prec)
 
 		BED->randomizer()->change_prec(new_prec);
 
+		BED->temp_vars.change_prec(new_prec);
 	}
 
 
@@ -0,0 +1,154 @@
+#include "nag/solvers/system_cache.hpp"
+
+#include <stdexcept>
+
+
+namespace {
+
+	/**
+	 \brief the key under which an SLP goes in the cache: its system, MPType and current precision, since a prog_t is sent at the precision it has.
+	 \return the key, or 0 if the system of the SLP is unknown.
+	 */
+	uint64_t CacheKey(prog_t *SLP, int MPType)
+	{
+		uint64_t hash = SystemCache::Instance().SystemHash(SLP);
+		if (hash==0)
+			return 0;
+
+		hash ^= (uint64_t) MPType;
+		hash *= 1099511628211ULL;
+		hash ^= (uint64_t) SLP->precision;
+		hash *= 1099511628211ULL;
+		return hash==0 ? 1 : hash;
+	}
+
+} // re: anonymous namespace
+
+
+
+
+int setup_prog(prog_t *SLP, int precision, int MPType)
+{
+	int num_vars = setupProg(SLP, precision, MPType);
+	SystemCache::Instance().SetSystemHash(SLP, HashParsedSystem());
+	return num_vars;
+}
+
+
+void copy_prog(prog_t *dest, prog_t *src)
+{
+	cp_prog_t(dest, src);
+	SystemCache::Instance().SetSystemHash(dest, SystemCache::Instance().SystemHash(src));
+}
+
+
+void clear_prog(prog_t *SLP, int MPType, int freeEvalProg)
+{
+	clearProg(SLP, MPType, freeEvalProg);
+	SystemCache::Instance().ForgetSystemHash(SLP);
+}
+
+
+
+
+void bcast_send_prog(prog_t *SLP, int MPType, ParallelismConfig & mpi_config)
+{
+	SystemCache & cache = SystemCache::Instance();
+
+	unsigned long long buffer[2];
+	buffer[0] = CacheKey(SLP, MPType);
+	buffer[1] = buffer[0]!=0 && cache.Touch(buffer[0]); // whether the workers have it
+	MPI_Bcast(buffer, 2, MPI_UNSIGNED_LONG_LONG, mpi_config.head(), mpi_config.comm());
+
+	if (buffer[1])
+		return;
+
+	bcast_prog_t(SLP, MPType, 0, 0); // last two arguments are: myid, headnode
+	if (buffer[0]!=0)
+		cache.Insert(buffer[0], NULL, MPType);
+}
+
+
+void bcast_receive_prog(prog_t *SLP, int MPType, ParallelismConfig & mpi_config)
+{
+	SystemCache & cache = SystemCache::Instance();
+
+	unsigned long long buffer[2];
+	MPI_Bcast(buffer, 2, MPI_UNSIGNED_LONG_LONG, mpi_config.head(), mpi_config.comm());
+
+	if (buffer[1]) {
+		if (!cache.Touch(buffer[0]))
+			throw std::logic_error("the head thinks this worker has an SLP cached, but it does not");
+		cp_prog_t(SLP, cache.Get(buffer[0]));
+		return;
+	}
+
+	bcast_prog_t(SLP, MPType, 1, 0); // last two arguments are: myid, headnode
+	if (buffer[0]!=0)
+		cache.Insert(buffer[0], SLP, MPType);
+}
+
+
+
+
+SystemCache & SystemCache::Instance()
+{
+	static SystemCache cache;
+	return cache;
+}
+
+
+bool SystemCache::Touch(uint64_t key)
+{
+	for (auto iter=entries_.begin(); iter!=entries_.end(); ++iter)
+		if (iter->key==key) {
+			entries_.splice(entries_.begin(), entries_, iter);
+			return true;
+		}
+	return false;
+}
+
+
+void SystemCache::Insert(uint64_t key, prog_t *SLP, int MPType)
+{
+	Entry entry{key, NULL, MPType};
+	if (SLP!=NULL) {
+		entry.SLP = new prog_t;
+		cp_prog_t(entry.SLP, SLP);
+	}
+	entries_.push_front(entry);
+
+	while (entries_.size()>Capacity()) {
+		Clear(entries_.back());
+		entries_.pop_back();
+	}
+}
+
+
+prog_t * SystemCache::Get(uint64_t key)
+{
+	for (auto & entry : entries_)
+		if (entry.key==key) {
+			if (entry.SLP==NULL)
+				throw std::logic_error("asking the head's SystemCache for an SLP, which it does not keep");
+			return entry.SLP;
+		}
+	throw std::logic_error("asking SystemCache for an SLP it does not hold");
+}
+
+
+void SystemCache::Clear(Entry & entry)
+{
+	if (entry.SLP!=NULL) {
+		clearProg(entry.SLP, entry.MPType, 0); // 0 means do not call freeprogeval(); the copy was never set up for evaluation
+		delete entry.SLP;
+		entry.SLP = NULL;
+	}
+}
+
+
+SystemCache::~SystemCache()
+{
+	for (auto & entry : entries_)
+		Clear(entry);
+}
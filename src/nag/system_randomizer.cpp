@@ -53,115 +53,92 @@ void SystemRandomizer::randomize(vec_d randomized_func_vals, mat_d randomized_ja
 		mul_d(&temp_homogenizer_d->coord[ii],&temp_homogenizer_d->coord[ii-1],hom_var);
 	}
 
-	increase_size_mat_d(temp_jac_d,num_original_funcs,jacobian_vals->cols);
-	temp_jac_d->rows = num_original_funcs; temp_jac_d->cols = jacobian_vals->cols;
 
-	// we do both function and jacobian randomization in the same loop for optimization.
-	for (int ii=0; ii<num_randomized_funcs; ii++) {
-		// this must be done in a loop because each output (randomized function) has a different homogeneous structure.
-		//
-		//TODO: optimization could be done by looking at the previous function's structure and omitting previously done calculations (for the second and subsequent functions)
-
-
-		// copy the current randomizer coefficients into a single row matrix
-		for (int jj=0; jj<num_original_funcs; jj++) {
-			set_d(&single_row_input_d->entry[0][jj], &randomizer_matrix_d->entry[ii][jj]); //TODO this is repetitive, and wasteful.  optimize away.
-		} // at least is is just setting, not multiplying
+	const int num_funcs = num_original_funcs;
+	const int num_vars = jacobian_vals->cols;
 
 
+	// homogenizing f_jj for output ii is multiplying it by h^deficiency, which is the same as multiplying R_ij by it.  so fold the homogenization into the randomizer, once per call, as
+	//    W_ij = R_ij h^{d_ij}             for the values and jacobian, and
+	//    P_ij = R_ij d_ij h^{d_ij - 1}     for the product rule in the column of the hom var.
+	// then the randomized values are W*f, and the randomized jacobian is W*J, plus P*f in column 0.
+	scaled_re_d.resize(num_randomized_funcs*num_funcs);  scaled_im_d.resize(num_randomized_funcs*num_funcs);
+	product_rule_re_d.resize(num_randomized_funcs*num_funcs);  product_rule_im_d.resize(num_randomized_funcs*num_funcs);
 
+	for (int ii=0; ii<num_randomized_funcs; ii++) {
+		for (int jj=0; jj<num_funcs; jj++) {
+			const int ind = ii*num_funcs+jj;
+			const double rr = randomizer_re_d[ind], ri = randomizer_im_d[ind];
+			const int deficiency = structure_matrix[ii][jj];
 
-		/////////////////
-		//
-		//  functions
-		//
-		//////////////
-		increase_size_vec_d(temp_funcs_d, num_original_funcs);  temp_funcs_d->size = num_original_funcs;
+			if (deficiency>0) {
+				const double hr = temp_homogenizer_d->coord[deficiency].r, hi = temp_homogenizer_d->coord[deficiency].i;
+				scaled_re_d[ind] = rr*hr - ri*hi;  scaled_im_d[ind] = rr*hi + ri*hr;
 
-		for (int jj=0; jj<num_original_funcs; jj++) {
-			// structure_matrix[ii][jj] gives the degree deficiency
-			if (structure_matrix[ii][jj]>0) { // if must homogenize at least one degree.
-				mul_d(&temp_funcs_d->coord[jj],&func_vals->coord[jj], &temp_homogenizer_d->coord[ structure_matrix[ii][jj] ]);
+				const double pr = deficiency*temp_homogenizer_d->coord[deficiency-1].r, pi = deficiency*temp_homogenizer_d->coord[deficiency-1].i;
+				product_rule_re_d[ind] = rr*pr - ri*pi;  product_rule_im_d[ind] = rr*pi + ri*pr;
 			}
-			else if (structure_matrix[ii][jj]==0) // no need to additionally homogenize -- already at the correct degree
-			{
-				set_d(&temp_funcs_d->coord[jj], &func_vals->coord[jj]);
-			}
-			else // yeah...  maybe optimize away?
-			{
-				set_d(&temp_funcs_d->coord[jj], &func_vals->coord[jj]);
+			else {
+				scaled_re_d[ind] = rr;  scaled_im_d[ind] = ri;
+				product_rule_re_d[ind] = product_rule_im_d[ind] = 0;
 			}
-
 		}
+	}
 
-		mul_mat_vec_d(temp_vec_d, single_row_input_d, temp_funcs_d);
-		set_d(&randomized_func_vals->coord[ii], &temp_vec_d->coord[0]);
-
-
-
-
-		/////////////////
-		//
-		//  jacobian
-		//
-		//////////////
 
+	// the jacobian, as separate real and imaginary parts, row-major and contiguous, so the inner loop of the product below vectorizes.
+	jac_re_d.resize(num_funcs*num_vars);  jac_im_d.resize(num_funcs*num_vars);
+	for (int jj=0; jj<num_funcs; jj++) {
+		for (int kk=0; kk<num_vars; kk++) {
+			jac_re_d[jj*num_vars+kk] = jacobian_vals->entry[jj][kk].r;
+			jac_im_d[jj*num_vars+kk] = jacobian_vals->entry[jj][kk].i;
+		}
+	}
 
-		for (int kk=0; kk<jacobian_vals->cols; kk++) { // kk indexes the variables in jacobian_vals (columns in jacobian)
-			for (int jj=0; jj<num_original_funcs; jj++) { // jj indexes the original functions (rows in jacobian)
-													  // structure_matrix[ii][jj] gives the degree deficiency
-				if (structure_matrix[ii][jj]>0) { // must homogenize at least one degree.
-					mul_d(&temp_jac_d->entry[jj][kk],&jacobian_vals->entry[jj][kk], &temp_homogenizer_d->coord[ structure_matrix[ii][jj] ]);
-				}
-				else if (structure_matrix[ii][jj]==0) // no need to additionally homogenize -- already at the correct degree
-				{
-					set_d(&temp_jac_d->entry[jj][kk],&jacobian_vals->entry[jj][kk]);
-				}
-				else
-				{
-					set_d(&temp_jac_d->entry[jj][kk],&jacobian_vals->entry[jj][kk]);
-				}
+	out_re_d.resize(num_vars);  out_im_d.resize(num_vars);
 
 
-			}
+	for (int ii=0; ii<num_randomized_funcs; ii++) {
+		const double *w_re = &scaled_re_d[ii*num_funcs], *w_im = &scaled_im_d[ii*num_funcs];
+		const double *p_re = &product_rule_re_d[ii*num_funcs], *p_im = &product_rule_im_d[ii*num_funcs];
+
+		// the function value, and the product rule term for the hom var
+		double f_re = 0, f_im = 0, hom_re = 0, hom_im = 0;
+		for (int jj=0; jj<num_funcs; jj++) {
+			const double vr = func_vals->coord[jj].r, vi = func_vals->coord[jj].i;
+			f_re += w_re[jj]*vr - w_im[jj]*vi;  f_im += w_re[jj]*vi + w_im[jj]*vr;
+			hom_re += p_re[jj]*vr - p_im[jj]*vi;  hom_im += p_re[jj]*vi + p_im[jj]*vr;
 		}
+		randomized_func_vals->coord[ii].r = f_re;  randomized_func_vals->coord[ii].i = f_im;
 
 
-		// actually randomize here
-		mat_mul_d(temp_mat_d, single_row_input_d, temp_jac_d);
-
-
-		//copy the output into the returned value.
-		for (int kk=0; kk<jacobian_vals->cols; kk++) {
-			set_d(&randomized_jacobian->entry[ii][kk], &temp_mat_d->entry[0][kk]);
-		}
+		// row ii of W*J, accumulated a row of J at a time.  the randomizer is mostly zero above its staircase, so skip those.
+		double * __restrict__ o_re = out_re_d.data();
+		double * __restrict__ o_im = out_im_d.data();
+		for (int kk=0; kk<num_vars; kk++)
+			o_re[kk] = o_im[kk] = 0;
 
+		for (int jj=0; jj<num_funcs; jj++) {
+			const double wr = w_re[jj], wi = w_im[jj];
+			if (wr==0 && wi==0)
+				continue;
 
-		// for the last step, the first variable is the hom_var, and it must use the product rule.
-		for (int jj=0; jj<num_original_funcs; jj++) {
-			if (structure_matrix[ii][jj]>0) { // only if we need to actually homogenize this function
-											  // we abuse the temp_funcs here and use as a temp storage area.
-				mul_d(&temp_funcs_d->coord[jj], //d•h^(d-1)
-					  &integer_coeffs_d->coord[ structure_matrix[ii][jj] ], &temp_homogenizer_d->coord[ structure_matrix[ii][jj]-1 ]); // this could be optimized if degree deficiency == 1.
-				mul_d(&temp_funcs_d->coord[jj], &temp_funcs_d->coord[jj], &func_vals->coord[jj]);
-				//temp_funcs_ = d•h^(d-1)•f_{jj}
-			}
-			else
-			{
-				set_zero_d(&temp_funcs_d->coord[jj]);
+			const double * __restrict__ j_re = &jac_re_d[jj*num_vars];
+			const double * __restrict__ j_im = &jac_im_d[jj*num_vars];
+			for (int kk=0; kk<num_vars; kk++) {
+				o_re[kk] += wr*j_re[kk] - wi*j_im[kk];
+				o_im[kk] += wr*j_im[kk] + wi*j_re[kk];
 			}
 		}
 
-		//randomize
-		mul_mat_vec_d(temp_vec_d, single_row_input_d, temp_funcs_d); // this produces a single number as output.
-																	 // M = R•(hommed_f)
-																	 // combine for power rule
-		add_d(&randomized_jacobian->entry[ii][0], &randomized_jacobian->entry[ii][0], &temp_vec_d->coord[0]);
+		o_re[0] += hom_re;  o_im[0] += hom_im; // the first variable is the hom_var, and it gets the product rule.
 
+		for (int kk=0; kk<num_vars; kk++) {
+			randomized_jacobian->entry[ii][kk].r = o_re[kk];
+			randomized_jacobian->entry[ii][kk].i = o_im[kk];
+		}
 	}
 
-
-
 }
 
 
@@ -205,6 +182,12 @@ void SystemRandomizer::randomize(vec_mp randomized_func_vals, mat_mp randomized_
 	increase_size_vec_mp(randomized_func_vals, num_randomized_funcs);
 	randomized_func_vals->size = num_randomized_funcs;
 
+	// the tier is that of the outputs the caller asked for, and not of the last change_prec, as one randomizer is shared by the evaluators of several solvers.
+	if (std::max(randomized_func_vals->curr_prec, randomized_jacobian->curr_prec) <= DoubleDouble::kBits) {
+		randomize_dd(randomized_func_vals, randomized_jacobian, func_vals, jacobian_vals, hom_var);
+		return;
+	}
+
 	// do a little precomputation
 	//0th entry is 1, having been set previously.
 	for (int ii=1; ii<=max_degree_deficiency; ii++) {
@@ -322,11 +305,97 @@ void SystemRandomizer::randomize(vec_mp randomized_func_vals, mat_mp randomized_
 }
 
 
+void SystemRandomizer::randomize_dd(vec_mp randomized_func_vals, mat_mp randomized_jacobian,
+									 vec_mp func_vals, mat_mp jacobian_vals,
+									 comp_mp hom_var)
+{
+	const int num_funcs = num_original_funcs;
+	const int num_vars = jacobian_vals->cols;
+
+	mpf_t temp;  mpf_init2(temp, mpf_get_prec(func_vals->coord[0].r));
+
+
+	// the powers of the hom var.  as in double precision, homogenizing is folded into the randomizer, as W = R h^d, and P = R d h^{d-1} for the product rule.
+	std::vector<ComplexDoubleDouble> homogenizer(max_degree_deficiency+1);
+	homogenizer[0] = ComplexDoubleDouble{{1,0},{0,0}};
+	if (max_degree_deficiency>0)
+		homogenizer[1] = mp_to_dd(hom_var, temp);
+	for (int ii=2; ii<=max_degree_deficiency; ii++)
+		homogenizer[ii] = homogenizer[ii-1]*homogenizer[1];
+
+
+	scaled_dd.resize(num_randomized_funcs*num_funcs);
+	product_rule_dd.resize(num_randomized_funcs*num_funcs);
+	for (int ii=0; ii<num_randomized_funcs; ii++) {
+		for (int jj=0; jj<num_funcs; jj++) {
+			const int ind = ii*num_funcs+jj;
+			const int deficiency = structure_matrix[ii][jj];
+
+			if (deficiency>0) {
+				scaled_dd[ind] = randomizer_dd[ind]*homogenizer[deficiency];
+				product_rule_dd[ind] = (randomizer_dd[ind]*homogenizer[deficiency-1])*double(deficiency);
+			}
+			else {
+				scaled_dd[ind] = randomizer_dd[ind];
+				product_rule_dd[ind] = ComplexDoubleDouble{{0,0},{0,0}};
+			}
+		}
+	}
+
+
+	std::vector<ComplexDoubleDouble> funcs(num_funcs);
+	for (int jj=0; jj<num_funcs; jj++)
+		funcs[jj] = mp_to_dd(&func_vals->coord[jj], temp);
+
+	jac_dd.resize(num_funcs*num_vars);
+	for (int jj=0; jj<num_funcs; jj++)
+		for (int kk=0; kk<num_vars; kk++)
+			jac_dd[jj*num_vars+kk] = mp_to_dd(&jacobian_vals->entry[jj][kk], temp);
+
+	out_dd.resize(num_vars);
+
+
+	for (int ii=0; ii<num_randomized_funcs; ii++) {
+		const ComplexDoubleDouble *w = &scaled_dd[ii*num_funcs], *p = &product_rule_dd[ii*num_funcs];
+
+		ComplexDoubleDouble f = {{0,0},{0,0}}, hom = {{0,0},{0,0}};
+		for (int jj=0; jj<num_funcs; jj++) {
+			f = f + w[jj]*funcs[jj];
+			hom = hom + p[jj]*funcs[jj];
+		}
+		dd_to_mp(&randomized_func_vals->coord[ii], f, temp);
+
+
+		for (int kk=0; kk<num_vars; kk++)
+			out_dd[kk] = ComplexDoubleDouble{{0,0},{0,0}};
+
+		for (int jj=0; jj<num_funcs; jj++) {
+			if (is_zero(w[jj]))
+				continue;
+
+			const ComplexDoubleDouble *jac_row = &jac_dd[jj*num_vars];
+			for (int kk=0; kk<num_vars; kk++)
+				out_dd[kk] = out_dd[kk] + w[jj]*jac_row[kk];
+		}
+
+		out_dd[0] = out_dd[0] + hom; // the first variable is the hom_var, and it gets the product rule.
+
+		for (int kk=0; kk<num_vars; kk++)
+			dd_to_mp(&randomized_jacobian->entry[ii][kk], out_dd[kk], temp);
+	}
+
+	mpf_clear(temp);
+}
+
+
+
+
 void SystemRandomizer::change_prec(int new_prec)
 {
 	if (!is_ready()) {
 		throw std::logic_error("trying to change precision when not set up!");
 	}
+
 	change_prec_mat_mp(randomizer_matrix_mp, new_prec);
 	mat_cp_mp(randomizer_matrix_mp,randomizer_matrix_full_prec);
 
@@ -531,7 +600,6 @@ void SystemRandomizer::setup_temps()
 	}
 
 
-	change_size_mat_d(single_row_input_d,1,num_original_funcs);  single_row_input_d->rows = 1; single_row_input_d->cols = num_original_funcs;
 	change_size_mat_mp(single_row_input_mp,1,num_original_funcs);  single_row_input_mp->rows = 1; single_row_input_mp->cols = num_original_funcs;
 
 	change_size_vec_d(temp_homogenizer_d,max_degree_deficiency+1);  temp_homogenizer_d->size = max_degree_deficiency+1;
@@ -540,6 +608,27 @@ void SystemRandomizer::setup_temps()
 	set_one_mp(&temp_homogenizer_mp->coord[0]);
 
 
+	// the double randomizer, as separate real and imaginary parts, row major, for randomize.
+	randomizer_re_d.resize(num_randomized_funcs*num_original_funcs);
+	randomizer_im_d.resize(num_randomized_funcs*num_original_funcs);
+	for (int ii=0; ii<num_randomized_funcs; ii++) {
+		for (int jj=0; jj<num_original_funcs; jj++) {
+			randomizer_re_d[ii*num_original_funcs+jj] = randomizer_matrix_d->entry[ii][jj].r;
+			randomizer_im_d[ii*num_original_funcs+jj] = randomizer_matrix_d->entry[ii][jj].i;
+		}
+	}
+
+	// and the full precision randomizer, in double-double, for randomizing at low multiple precision.
+	randomizer_dd.resize(num_randomized_funcs*num_original_funcs);
+	if (randomizer_matrix_full_prec->rows>0 && randomizer_matrix_full_prec->cols>0) {
+		mpf_t temp;  mpf_init2(temp, mpf_get_prec(randomizer_matrix_full_prec->entry[0][0].r));
+		for (int ii=0; ii<num_randomized_funcs; ii++)
+			for (int jj=0; jj<num_original_funcs; jj++)
+				randomizer_dd[ii*num_original_funcs+jj] = mp_to_dd(&randomizer_matrix_full_prec->entry[ii][jj], temp);
+		mpf_clear(temp);
+	}
+
+
 
 
 	setup_indicator = true;
@@ -615,7 +704,7 @@ void SystemRandomizer::send(int target, ParallelismConfig & mpi_config)
 
 
 	if ( (randomizer_matrix_full_prec->rows != 0) || (randomizer_matrix_full_prec->cols != 0)) {
-		send_mat_mp(randomizer_matrix_full_prec, target);
+		send_mat_mp(randomizer_matrix_full_prec, target, mpi_config.comm());
 	}
 
 
@@ -688,7 +777,9 @@ void SystemRandomizer::receive(int source, ParallelismConfig & mpi_config)
 
 
 	if ( (randomizer_matrix_full_prec->rows != 0) || (randomizer_matrix_full_prec->cols != 0)) {
-		receive_mat_mp(randomizer_matrix_full_prec, source);
+		receive_mat_mp(randomizer_matrix_full_prec, source, mpi_config.comm());
+		mat_cp_mp(randomizer_matrix_mp,randomizer_matrix_full_prec);
+		mat_mp_to_d(randomizer_matrix_d,randomizer_matrix_full_prec);
 	}
 
 
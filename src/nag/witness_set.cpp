@@ -1,5 +1,11 @@
 #include "nag/witness_set.hpp"
 
+#include <cfloat>
+#include <cmath>
+#include <complex>
+#include <map>
+#include <random>
+
 
 
 
@@ -544,6 +550,130 @@ void WitnessSet::sort_for_real(double tol)
 
 
 
+namespace {
+
+	/**
+	 \brief an index of the points of a witness set, by a random real projection of their dehomogenized coordinates, in double precision.
+
+	 Two points are the same to tolerance tol, in the sense of isSamePoint_homogeneous_input, only if their dehomogenized coordinates differ by less than tol*max(1,norm) in every coordinate, where norm is the infinity norm of the smaller of the two.  Then their projections differ by at most that times the one-norm of the projection, so only the points whose projections are that close to a given point's are candidates, and a lookup costs a logarithm rather than a pass over every point.  The candidates are confirmed in MP by the caller.
+
+	 A point whose dehomogenized coordinates do not fit in a double, such as one near infinity, is not indexed, and is a candidate for everything.
+	 */
+	class ProjectionIndex
+	{
+
+	public:
+
+		/**
+		 \brief where a point falls in the index.
+		 */
+		struct Key
+		{
+			double projection; ///< the projection of the dehomogenized point.
+			double norm; ///< the infinity norm of the dehomogenized point.
+			bool finite; ///< whether the above are finite numbers.
+		};
+
+
+		/**
+		 \param num_natural_vars The number of natural variables of the points, including the homogenizing one.
+		 \param tol The tolerance of isSamePoint_homogeneous_input.
+		 */
+		ProjectionIndex(int num_natural_vars, double tol) : tol_(tol), one_norm_(0)
+		{
+			std::mt19937 generator(num_natural_vars); // fixed, so runs are repeatable.  any direction works.
+			std::uniform_real_distribution<double> distribution(-1,1);
+			for (int ii=1; ii<num_natural_vars; ii++) {
+				weights_.push_back(std::complex<double>(distribution(generator), distribution(generator)));
+				one_norm_ += fabs(weights_.back().real()) + fabs(weights_.back().imag());
+			}
+
+			init_mp(dehom_coord_);
+		}
+
+		~ProjectionIndex()
+		{
+			clear_mp(dehom_coord_);
+		}
+
+		ProjectionIndex(const ProjectionIndex&) = delete;
+		ProjectionIndex & operator=(const ProjectionIndex&) = delete;
+
+
+		/**
+		 \brief compute the key of a point.
+		 \return the key.
+		 \param point The point, homogenized, whose first weights_.size()+1 coordinates are the natural ones.
+		 */
+		Key key(vec_mp const& point)
+		{
+			Key k{0, 0, true};
+			for (unsigned jj=0; jj<weights_.size(); jj++) {
+				div_mp(dehom_coord_, &point->coord[jj+1], &point->coord[0]);
+				double re = mpf_get_d(dehom_coord_->r), im = mpf_get_d(dehom_coord_->i);
+
+				k.projection += weights_[jj].real()*re + weights_[jj].imag()*im;
+				k.norm = std::max(k.norm, std::hypot(re,im));
+			}
+
+			k.finite = std::isfinite(k.projection) && std::isfinite(k.norm);
+			return k;
+		}
+
+
+		/**
+		 \brief add a point.
+		 \param index The index of the point in the witness set.
+		 \param k The key of the point.
+		 */
+		void insert(unsigned index, Key const& k)
+		{
+			if (k.finite)
+				indexed_.insert(std::make_pair(k.projection, index));
+			else
+				unindexed_.push_back(index);
+		}
+
+
+		/**
+		 \brief find the points which might be the same as one with a given key.
+		 \param k The key.
+		 \param result Set to the indices of the candidates.
+		 */
+		void candidates(Key const& k, std::vector<unsigned> & result) const
+		{
+			result = unindexed_;
+
+			if (!k.finite) {
+				for (auto const& entry : indexed_)
+					result.push_back(entry.second);
+				return;
+			}
+
+			// the tolerance, as isSamePoint_inhomogeneous_input scales it, plus room for the rounding of the projections in double.
+			double scaled_tol = tol_*std::max(1.0, k.norm);
+			double radius = one_norm_*(scaled_tol*(1+1e-8) + 4*(weights_.size()+1)*DBL_EPSILON*(k.norm+scaled_tol));
+
+			for (auto iter = indexed_.lower_bound(k.projection-radius); iter!=indexed_.end() && iter->first<=k.projection+radius; ++iter)
+				result.push_back(iter->second);
+		}
+
+	private:
+
+		double tol_; ///< the tolerance of the comparison.
+		std::vector<std::complex<double> > weights_; ///< the projection, applied to the real and imaginary parts of each dehomogenized coordinate.
+		double one_norm_; ///< the sum of the absolute values of the real and imaginary parts of the weights.
+		comp_mp dehom_coord_; ///< temporary, for dehomogenizing.
+
+		std::multimap<double, unsigned> indexed_; ///< the finite points, by projection.
+		std::vector<unsigned> unindexed_; ///< the points with no finite key.
+	};
+
+} // re: anonymous namespace
+
+
+
+
 // T is necessary for the tolerances.
 void WitnessSet::sort_for_unique(double tol)
 {
@@ -552,35 +682,36 @@ void WitnessSet::sort_for_unique(double tol)
 		throw std::logic_error("sorting witness set with 0 variables for uniqueness");
 	}
 
-	int curr_uniqueness;
 	int num_good_pts = 0;
-	std::vector<int> is_unique;
+	std::vector<int> is_unique(num_points(), 1);
 
-	for (unsigned int ii = 0; ii<num_points(); ++ii) {
+	// a point is kept if none after it is the same, so go from the back, with the points after the current one in the index.
+	ProjectionIndex index(num_natty_vars_, tol);
+	std::vector<unsigned> candidates;
+	for (unsigned int ii = num_points(); ii-- > 0; ) {
 		vec_mp &curr_point = point(ii);
 
-		curr_uniqueness = 1;
+		ProjectionIndex::Key key = index.key(curr_point);
+		index.candidates(key, candidates);
 
 		int prev_size_1 = curr_point->size;  curr_point->size = num_natty_vars_; // cache and change to natural number
 
-		for (unsigned int jj=ii+1; jj<num_points(); ++jj) {
+		for (auto jj : candidates) {
 			vec_mp & inner_point = point(jj);
 			int prev_size_2 = inner_point->size; inner_point->size = num_natty_vars_; // cache and change to natural number
-			if ( isSamePoint_homogeneous_input(curr_point,inner_point,tol) ){
-				curr_uniqueness = 0;
-			}
+			bool same = isSamePoint_homogeneous_input(curr_point,inner_point,tol);
 			inner_point->size = prev_size_2; // restore
+			if (same) {
+				is_unique[ii] = 0;
+				break;
+			}
 		}
 		curr_point->size = prev_size_1; // restore
 
-		if (curr_uniqueness==1) {
-			is_unique.push_back(1);
+		if (is_unique[ii]==1)
 			num_good_pts++;
-		}
-		else {
-			is_unique.push_back(0);
-		}
 
+		index.insert(ii, key);
 	}
 
 
@@ -820,10 +951,19 @@ void WitnessSet::merge(const WitnessSet & W_in, double tol)
 	}
 
 
+	ProjectionIndex index(this->num_natural_variables(), tol);
+	for (unsigned int jj = 0; jj<num_points(); jj++)
+		index.insert(jj, index.key(this->point(jj)));
+
+	std::vector<unsigned> candidates;
 	for (unsigned int ii = 0; ii<W_in.num_points(); ii++) {
 		int is_new = 1;
 		vec_mp & in_point = W_in.point(ii);
-		for (unsigned int jj = 0; jj<num_points(); jj++){
+
+		ProjectionIndex::Key key = index.key(in_point);
+		index.candidates(key, candidates);
+
+		for (auto jj : candidates){
 			vec_mp & curr_point = this->point(jj);
 
 			//cache the sizes
@@ -848,7 +988,7 @@ void WitnessSet::merge(const WitnessSet & W_in, double tol)
 		}
 
 		if (is_new==1)
-			WitnessSet::add_point( (in_point) );
+			index.insert(WitnessSet::add_point( (in_point) ), key);
 	}
 
 
@@ -916,13 +1056,13 @@ void WitnessSet::send(ParallelismConfig & mpi_config, int target) const
     free(buffer);
 
     for (unsigned int ii=0; ii<num_linears(); ii++) {
-        send_vec_mp( linear(ii),target);
+        send_vec_mp( linear(ii),target, mpi_config.comm());
     }
     for (unsigned int ii=0; ii<num_patches(); ii++) {
-        send_vec_mp( patch(ii),target);
+        send_vec_mp( patch(ii),target, mpi_config.comm());
     }
     for (unsigned int ii=0; ii<num_points(); ii++) {
-        send_vec_mp( point(ii) ,target);
+        send_vec_mp( point(ii) ,target, mpi_config.comm());
     }
 
     char * namebuffer = (char *) br_malloc(1024*sizeof(char));
@@ -955,17 +1095,17 @@ void WitnessSet::receive(int source, ParallelismConfig & mpi_config)
     vec_mp tempvec; init_vec_mp2(tempvec,0,1024);
 
     for (unsigned int ii=0; ii<temp_num_linears; ii++) {
-        receive_vec_mp(tempvec,source);
+        receive_vec_mp(tempvec,source, mpi_config.comm());
         add_linear(tempvec);
     }
 
     for (unsigned int ii=0; ii<temp_num_patches; ii++) {
-        receive_vec_mp(tempvec,source);
+        receive_vec_mp(tempvec,source, mpi_config.comm());
         add_patch(tempvec);
     }
 
 	for (unsigned int ii=0; ii<temp_num_pts; ii++) {
-        receive_vec_mp(tempvec,source);
+        receive_vec_mp(tempvec,source, mpi_config.comm());
         add_point(tempvec);
     }
 
@@ -50,10 +50,20 @@ int UbermasterProcess::main_loop()
 
 
 	NumericalIrreducibleDecomposition witness_data;
-	witness_data.populate(&solve_options.T);
-
-
-	WitnessSet W = witness_data.choose(program_options);
+	WitnessSet W;
+	std::vector<int> components; // in batch mode, the components to decompose, all of dimension batch_dim
+	int batch_dim = -1;
+	{
+		RunProfile::StageTimer stage("witness_data");
+		witness_data.populate(&solve_options.T);
+		if (program_options.batch_mode()) {
+			components = witness_data.choose_batch(program_options, batch_dim);
+			if (!components.empty())
+				W = witness_data.form_specific_witness_set(batch_dim, components[0]);
+		}
+		else
+			W = witness_data.choose(program_options);
+	}
 
 	if (W.num_points()==0) {
 		std::cout << "no witness points, cannot decompose anything..." << std::endl;
@@ -63,16 +73,91 @@ int UbermasterProcess::main_loop()
 
 
 
+	// one projection for all the components, as they are of the same dimension and in the same variables.
+	vec_mp *pi = (vec_mp *) br_malloc(W.dimension()*sizeof(vec_mp ));
+	for (int ii=0; ii<W.dimension(); ii++) {
+		init_vec_mp2(pi[ii],W.num_variables(), solve_options.T.AMP_max_prec);
+		pi[ii]->size = W.num_variables();
+	}
+	get_projection(pi, program_options, W.num_variables(), W.dimension());
+
+	// stages reused from an earlier surface Decomposition were computed with its projections, so they are used throughout.
+	if (!program_options.reuse_dir().empty() && W.dimension()==2)
+		SphereIndependentStages::Fetch(program_options.reuse_dir(), pi, W.num_variables());
+
+	int dimension = W.dimension();
+
+
+
+	// the parsed system, tracker config and workers are shared by the components.  each component starts from the options as they were given, since a decomposition changes some of them, such as the output folder.
+	BertiniRealConfig const given_options = program_options;
+	int sweep_dim = W.dimension(), sweep_comp = W.component_number();
+	unsigned num_sets = program_options.batch_mode() ? components.size() : 1;
+	for (unsigned ii=0; ii<num_sets; ii++)
+	{
+		if (ii>0) {
+			program_options = given_options;
+			RunProfile::StageTimer stage("witness_data");
+			W = witness_data.form_specific_witness_set(batch_dim, components[ii]);
+		}
+
+		if (program_options.batch_mode())
+			std::cout << "decomposing component " << components[ii] << " of dimension " << batch_dim << ", " << ii+1 << " of " << num_sets << std::endl;
+
+		decompose(W, pi, num_vars);
+	}
+
+
+	if (!given_options.sweep_filename().empty())
+	{
+		if (given_options.batch_mode())
+			std::cout << "a sweep follows a single component, not a batch.  not sweeping." << std::endl;
+		else
+			sweep(given_options, sweep_dim, sweep_comp, pi, num_vars);
+	}
+
+
+
+
+	for (int ii=0; ii<dimension; ii++)
+		clear_vec_mp(pi[ii]);
+	free(pi);
+
+
+	return SUCCESSFUL;
+}
+
+
+
+
+void UbermasterProcess::finish(bool succeeded)
+{
+	// dismiss the workers
+	int sendme = TERMINATE;
+	MPI_Bcast(&sendme, 1, MPI_INT, solve_options.head(), solve_options.comm());
+
+	RunProfile::Instance().Finish(solve_options.comm(), solve_options.head());
+	if (succeeded && boost::filesystem::is_directory(program_options.output_dir()))
+		RunProfile::Instance().Write(program_options.output_dir() / RunProfile::FileName("bertini_real"), "bertini_real", solve_options.num_procs());
+}
+
+
+
+
+
+void UbermasterProcess::decompose(WitnessSet & W, vec_mp *pi, int num_vars)
+{
 	W.get_variable_names(num_vars);
 	W.set_input_filename(program_options.input_filename());
 
 	if (program_options.user_patch())
 	{
-		vec_mp* patch = (vec_mp *) br_malloc(1*sizeof(vec_mp));
-	    init_vec_mp2(*patch, W.num_variables(), solve_options.T.AMP_max_prec)
-		get_patch(patch, program_options, W.num_variables());
+		vec_mp patch;
+		init_vec_mp2(patch, W.num_variables(), solve_options.T.AMP_max_prec);
+		get_patch(&patch, program_options, W.num_variables());
 
-		W.RescaleToPatch(*patch);
+		W.RescaleToPatch(patch);
+		clear_vec_mp(patch);
 	}
 
 
@@ -84,17 +169,9 @@ int UbermasterProcess::main_loop()
 
 	V.set_same_point_tolerance(program_options.same_point_tol());
 
-
-	vec_mp *pi = (vec_mp *) br_malloc(W.dimension()*sizeof(vec_mp ));
 	for (int ii=0; ii<W.dimension(); ii++) {
-		init_vec_mp2(pi[ii],W.num_variables(), solve_options.T.AMP_max_prec);
-		pi[ii]->size = W.num_variables();
+		V.add_projection(pi[ii]);
 	}
-	get_projection(pi, program_options, W.num_variables(), W.dimension());
-
-    for (int ii=0; ii<W.dimension(); ii++) {
-        V.add_projection(pi[ii]);
-    }
 
 
 
@@ -108,23 +185,106 @@ int UbermasterProcess::main_loop()
 	{
 		critreal(W,pi,V);
 	}
+}
 
 
 
+void UbermasterProcess::sweep(BertiniRealConfig const& given_options, int dim, int comp, vec_mp *pi, int num_vars)
+{
+#ifdef functionentry_output
+	std::cout << "UbermasterProcess::sweep" << std::endl;
+#endif
 
+	ParameterSweep parameters;
+	parameters.Read(given_options.sweep_filename());
 
+	// each step's decomposition writes Dir_Name, but the run's own is the one to sample.
+	boost::filesystem::remove("Dir_Name_given");
+	boost::filesystem::copy_file("Dir_Name", "Dir_Name_given");
 
-	for (int ii=0; ii<W.dimension(); ii++)
-		clear_vec_mp(pi[ii]);
-	free(pi);
+	// put it back however the sweep ends, so the sampler never reads a half-made step's.
+	try{
+		boost::filesystem::path previous_input = given_options.input_filename();
+		for (unsigned step=1; step<=parameters.NumSteps(); step++)
+		{
+			program_options = given_options;
 
+			std::stringstream suffix;
+			suffix << "_step_" << step;
+			boost::filesystem::path step_input = boost::filesystem::absolute(given_options.input_filename().filename().string() + suffix.str());
+			parameters.WriteInput(given_options.input_filename(), step_input, step);
 
-	// dismiss the workers
-	int sendme = TERMINATE;
-	MPI_Bcast(&sendme, 1, MPI_INT, 0, MPI_COMM_WORLD);
-	return SUCCESSFUL;
-}
+			std::cout << "sweeping to step " << step << " of " << parameters.NumSteps() << std::endl;
+
+			WitnessSet W;
+			{
+				RunProfile::StageTimer stage("sweep");
+
+				NumericalIrreducibleDecomposition previous;
+				previous.populate(&solve_options.T);
+
+				PointHolder carried;
+				bool continued = parameters.Continue(previous, dim, comp, previous_input, step_input, "witness_data_sweep",
+													 program_options.same_point_tol(), program_options, carried);
+				if (continued)
+					rename("witness_data_sweep", "witness_data");
+				else
+				{
+					std::cout << "computing the witness data of step " << step << " from scratch" << std::endl;
+					std::vector<std::string> command_line_options;
+					command_line_options.push_back(step_input.string());
+
+					program_options.call_for_help(BERTINI_MAIN);
+					bertini_main_wrapper(command_line_options, program_options.num_procs(), 0, 0);
+				}
 
+				NumericalIrreducibleDecomposition witness_data;
+				witness_data.populate(&solve_options.T);
+
+				// computed from scratch, the components are numbered afresh, so the swept one is found again by the points which did come through.  failing that, it is the only one of its dimension, or lost.
+				if (!continued)
+				{
+					int new_dim = dim, new_comp = comp;
+					if (parameters.FindComponent(witness_data, carried, step_input, program_options, new_dim, new_comp))
+					{
+						dim = new_dim; comp = new_comp;
+					}
+					else if (witness_data.components().count(dim) && witness_data.components().at(dim).size()==1)
+						comp = witness_data.components().at(dim).begin()->first;
+					else
+					{
+						std::cout << "the swept component cannot be told apart from the others of dimension " << dim << " at step " << step << ".  ending the sweep." << std::endl;
+						break;
+					}
+				}
+
+				// after the membership test, which writes over the parsed system.
+				int MPType;
+				parse_input_file(step_input, &MPType);
+
+				W = witness_data.form_specific_witness_set(dim, comp);
+			}
+
+			if (W.num_points()==0) {
+				std::cout << "step " << step << " has no component " << comp << " of dimension " << dim << ".  ending the sweep." << std::endl;
+				break;
+			}
+
+			program_options.set_input_filename(step_input);
+			program_options.output_dir(given_options.output_dir().string() + suffix.str());
+			decompose(W, pi, num_vars);
+
+			previous_input = step_input;
+		}
+	}
+	catch (...)
+	{
+		rename("Dir_Name_given", "Dir_Name");
+		throw;
+	}
+
+	rename("Dir_Name_given", "Dir_Name");
+}
 
 
 
@@ -147,6 +307,7 @@ void UbermasterProcess::bertini_real(WitnessSet & W, vec_mp *pi, VertexSet & V)
 	program_options.PrintMetadata(program_options.output_dir() / "run_metadata");
 
 
+	boost::filesystem::path decomposition_input; // the copy of the input file written alongside the decomposition
 	switch (W.dimension()) {
 		case 1:
 		{
@@ -164,6 +325,8 @@ void UbermasterProcess::bertini_real(WitnessSet & W, vec_mp *pi, VertexSet & V)
 			C.output_main(program_options.output_dir());
 
 			V.print(program_options.output_dir()/ "V.vertex");
+			V.print_binary(program_options.output_dir()/ "V.vertex.bin");
+			decomposition_input = program_options.output_dir() / C.input_filename().filename();
 
 		}
 			break;
@@ -183,6 +346,8 @@ void UbermasterProcess::bertini_real(WitnessSet & W, vec_mp *pi, VertexSet & V)
 			S.output_main(program_options.output_dir());
 
 			V.print(program_options.output_dir()/ "V.vertex");
+			V.print_binary(program_options.output_dir()/ "V.vertex.bin");
+			decomposition_input = program_options.output_dir() / S.input_filename().filename();
 		}
 			break;
 
@@ -195,6 +360,16 @@ void UbermasterProcess::bertini_real(WitnessSet & W, vec_mp *pi, VertexSet & V)
 
 	program_options.PrintMetadata(program_options.output_dir() / "run_metadata");
 
+
+	// leave the parsed system behind, so the sampler need not parse it again.
+	if (!decomposition_input.empty() && boost::filesystem::is_regular_file(decomposition_input))
+	{
+		int MPType;
+		parse_input_file(decomposition_input, &MPType);
+		SaveParsedSystem(decomposition_input, MPType, program_options.output_dir() / "parsed_system");
+	}
+
+	DecompositionArchive::Pack(program_options.output_dir());
 }
 
 
@@ -282,15 +457,13 @@ void UbermasterProcess::critreal(WitnessSet & W, vec_mp *pi, VertexSet & V)
 
 int WorkerProcess::main_loop()
 {
-	int single_int_buffer = 0;
-
 	int solver_choice = INITIAL_STATE;
 
 
 
 	while (solver_choice != TERMINATE) {
 
-		MPI_Bcast(&solver_choice, 1, MPI_INT, solve_options.head(), MPI_COMM_WORLD);
+		MPI_Bcast(&solver_choice, 1, MPI_INT, solve_options.head(), solve_options.comm());
 
 		if ( (solve_options.id()==1) && (program_options.verbose_level()>=2)) { //(solver_choice!=0) &&
 			std::cout << "received call for help for solver " << enum_lookup(solver_choice) << std::endl;
@@ -308,13 +481,6 @@ int WorkerProcess::main_loop()
 			}
 				break;
 
-			case PARSING:
-				MPI_Bcast(&single_int_buffer, 1, MPI_INT, 0, MPI_COMM_WORLD); // this catches a broadcast from Bertini's parser...
-				if (single_int_buffer!=0) {
-					std::cout << single_int_buffer << std::endl;
-				}
-				break;
-
 			case MULTILIN:
 				multilin_slave_entry_point(this->solve_options);
 				break;
@@ -329,6 +495,10 @@ int WorkerProcess::main_loop()
 				bertini_main_wrapper(command_line_options, solve_options.num_procs(), solve_options.id(), solve_options.head());
 				break;
 			}
+			case PARSING:
+				CatchParse();
+				break;
+
 			case TERMINATE:
 				break;
 			default:
@@ -338,8 +508,5 @@ int WorkerProcess::main_loop()
 	}
 
 
-
-
-
 	return SUCCESSFUL;
 }
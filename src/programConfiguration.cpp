@@ -31,15 +31,118 @@ unsigned int parse_input_file(boost::filesystem::path filename, int * MPType)
 	int my_id = 0, num_processes = 1, headnode = 0; // headnode is always 0
 
 
+	// the parser broadcasts over MPI_COMM_WORLD regardless of num_processes, so the workers are told to catch it.
 	int bcastme = PARSING;
 	MPI_Bcast(&bcastme, 1, MPI_INT, 0, MPI_COMM_WORLD);
-	//end parser-bertini essentials
 
 	parse_input(const_cast< char*> (filename.c_str()), &trackType, MPType, &genType, &userHom, &currentSeed, &sharpenOnly, &needToDiff, &remove_temp, useParallelDiff, my_id, num_processes, headnode);
 	return currentSeed;
 }
 
 
+void CatchParse()
+{
+	int single_int_buffer = 0;
+	MPI_Bcast(&single_int_buffer, 1, MPI_INT, 0, MPI_COMM_WORLD);
+}
+
+
+
+namespace {
+
+	// 64-bit FNV-1a, over the bytes of a file.  this is only to detect a changed input file, not for security.
+	uint64_t HashFileContents(boost::filesystem::path const& filename)
+	{
+		std::ifstream fin(filename.string(), std::ios::binary);
+		if (!fin.is_open())
+			throw std::runtime_error("unable to open " + filename.string() + " for hashing");
+
+		uint64_t hash = 14695981039346656037ULL;
+		char c;
+		while (fin.get(c))
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+	// copy_option was renamed between boost versions, so remove-then-copy it is.
+	void CopyOver(boost::filesystem::path const& from, boost::filesystem::path const& to)
+	{
+		boost::filesystem::remove(to);
+		boost::filesystem::copy_file(from, to);
+	}
+
+} // re: anonymous namespace
+
+
+const std::vector<std::string> & ParsedSystemFiles()
+{
+	static const std::vector<std::string> names{"arr.out", "num.out", "deg.out", "names.out", "config", "func_input", "preproc_data"};
+	return names;
+}
+
+
+uint64_t HashParsedSystem()
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (auto const& name : ParsedSystemFiles())
+	{
+		hash ^= HashFileContents(name);
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+
+void SaveParsedSystem(boost::filesystem::path const& input_filename, int MPType, boost::filesystem::path const& snapshot_dir)
+{
+#ifdef functionentry_output
+	std::cout << "SaveParsedSystem" << std::endl;
+#endif
+
+	boost::filesystem::create_directories(snapshot_dir);
+
+	for (auto const& name : ParsedSystemFiles())
+		CopyOver(name, snapshot_dir / name);
+
+	std::ofstream fout((snapshot_dir / "source").string());
+	fout << input_filename.string() << "\n" << MPType << "\n" << HashFileContents(input_filename) << "\n";
+}
+
+
+bool RestoreParsedSystem(boost::filesystem::path const& input_filename, int * MPType, boost::filesystem::path const& snapshot_dir)
+{
+#ifdef functionentry_output
+	std::cout << "RestoreParsedSystem" << std::endl;
+#endif
+
+	std::ifstream fin((snapshot_dir / "source").string());
+	if (!fin.is_open())
+		return false;
+
+	std::string recorded_name;
+	int recorded_mptype;
+	uint64_t recorded_hash;
+	if (!std::getline(fin, recorded_name) || !(fin >> recorded_mptype >> recorded_hash))
+		return false;
+
+	if (!boost::filesystem::is_regular_file(input_filename) || HashFileContents(input_filename)!=recorded_hash)
+		return false;
+
+	for (auto const& name : ParsedSystemFiles())
+		if (!boost::filesystem::is_regular_file(snapshot_dir / name))
+			return false;
+
+	for (auto const& name : ParsedSystemFiles())
+		CopyOver(snapshot_dir / name, name);
+
+	*MPType = recorded_mptype;
+	return true;
+}
+
+
 
 void ParallelismConfig::init()
 {
@@ -61,21 +164,6 @@ void ParallelismConfig::init()
 
 	my_communicator_ = MPI_COMM_WORLD; // default communicator is MPI_COMM_WORLD
 
-
-
-
-	//		MPI_Group orig_group, new_group;
-	//
-	//		/* Extract the original group handle */
-	//
-	//		MPI_Comm_group(MPI_COMM_WORLD, &orig_group);
-	//
-	//		/* Create new communicator and then perform collective communications */
-	//
-	//		MPI_Comm_create(MPI_COMM_WORLD, orig_group, &my_communicator);
-	//
-	//		MPI_Comm_size(my_communicator, &this->numprocs);
-	//		MPI_Comm_rank(my_communicator, &this->my_id);
 	return;
 }
 
@@ -90,7 +178,9 @@ void ParallelismConfig::init_active_workers()
 		available_workers_.pop();
 
 
-	for (int ii=1; ii<this->numprocs_; ii++) {
+	for (int ii=0; ii<this->numprocs_; ii++) {
+		if (ii==headnode_)
+			continue;
 		available_workers_.push(ii);
 		worker_status_[ii] = INACTIVE;
 	}
@@ -106,7 +196,7 @@ int ParallelismConfig::activate_next_worker()
 
 	if (worker_status_[worker_id] == ACTIVE) {
 		std::cout << "master tried making worker" << worker_id << " active when it was already active" << std::endl;
-		MPI_Abort(MPI_COMM_WORLD,1);
+		abort(1);
 	}
 	worker_status_[worker_id] = ACTIVE;
 
@@ -119,7 +209,7 @@ void ParallelismConfig::deactivate(int worker_id)
 {
 	if (worker_status_[worker_id] == INACTIVE) {
 		std::cout << "master tried decativating worker" << worker_id << " when it was already inactive" << std::endl;
-		MPI_Abort(MPI_COMM_WORLD,2);
+		abort(2);
 	}
 	worker_status_[worker_id] = INACTIVE;
 
@@ -133,7 +223,7 @@ void ParallelismConfig::send_all_available(int numtosend)
 {
 	while (available_workers_.size()>0)  {
 		int sendtome = available_workers_.front();
-		MPI_Send(&numtosend, 1, MPI_INT, sendtome, NUMPACKETS, MPI_COMM_WORLD);
+		MPI_Send(&numtosend, 1, MPI_INT, sendtome, NUMPACKETS, comm());
 		available_workers_.pop();
 	}
 }
@@ -142,7 +232,7 @@ void ParallelismConfig::send_all_available(int numtosend)
 void ParallelismConfig::call_for_help(int solver_type)
 {
 
-	MPI_Bcast(&solver_type, 1, MPI_INT, id(), MPI_COMM_WORLD);
+	MPI_Bcast(&solver_type, 1, MPI_INT, id(), comm());
 	init_active_workers();
 
 }
@@ -162,8 +252,8 @@ bool ParallelismConfig::have_available()
 bool ParallelismConfig::have_active()
 {
 	bool yep = false;
-	for (int ii=1; ii<this->numprocs_; ii++) {
-		if (this->worker_status_[ii]==ACTIVE) {
+	for (auto const& status : worker_status_) {
+		if (status.second==ACTIVE) {
 			yep = true;
 			break;
 		}
@@ -174,8 +264,8 @@ bool ParallelismConfig::have_active()
 int ParallelismConfig::num_active()
 {
 	int num = 0;
-	for (int ii=1; ii<this->numprocs_; ii++) {
-		if (this->worker_status_[ii]==ACTIVE) {
+	for (auto const& status : worker_status_) {
+		if (status.second==ACTIVE) {
 			num++;
 		}
 	}
@@ -194,27 +284,68 @@ int ParallelismConfig::num_active()
 
 
 
-void ProgramConfigBase::move_to_temp()
+void ProgramConfigBase::move_to_temp(std::vector<boost::filesystem::path> const& inputs)
 {
-	if (!boost::filesystem::exists(this->working_dir())) {
-		boost::filesystem::create_directory(this->working_dir());
+	if (scratch_base_.empty()) {
+		working_dir(called_dir());
+		return;
+	}
+
+
+	std::string name;
+	if (is_head()) {
+		boost::filesystem::path base = scratch_base_;
+		if (base=="memory")
+			base = boost::filesystem::is_directory("/dev/shm") ? boost::filesystem::path("/dev/shm") : boost::filesystem::temp_directory_path();
+
+		name = (boost::filesystem::absolute(base, called_dir()) / boost::filesystem::unique_path("bertini_real_scratch_%%%%-%%%%-%%%%-%%%%")).string();
 	}
 
-	if (!boost::filesystem::is_directory(this->working_dir())) {
-		std::cerr << "trying to move into a directory which is a regular file!" << std::endl;
-		// add error code here
+	if (use_parallel()) {
+		int length = name.size();
+		MPI_Bcast(&length, 1, MPI_INT, head(), comm());
+		name.resize(length);
+		MPI_Bcast(&name[0], length, MPI_CHAR, head(), comm());
 	}
 
-	chdir(this->working_dir().c_str());
+	working_dir(name);
+
+
+	boost::filesystem::create_directories(this->working_dir()); // on every process, in case the scratch base is local to each node.
+
+	if (is_head())
+		for (auto const& input : inputs)
+			if (boost::filesystem::exists(called_dir() / input))
+				boost::filesystem::copy_file(called_dir() / input, working_dir() / input.filename());
+
+	if (chdir(this->working_dir().c_str())!=0)
+		throw std::runtime_error("unable to move into the workspace " + this->working_dir().string());
 
 	if (this->verbose_level()>=3)
 		std::cout << "moved to working_dir '" << this->working_dir().string() << "'" << std::endl;
 }
 
-void ProgramConfigBase::move_to_called()
+void ProgramConfigBase::move_to_called(std::vector<boost::filesystem::path> const& outputs)
 {
+	if (working_dir()==called_dir())
+		return;
+
+	if (is_head())
+		for (auto const& output : outputs)
+			if (boost::filesystem::exists(working_dir() / output)) {
+				boost::filesystem::remove(called_dir() / output.filename());
+				boost::filesystem::copy_file(working_dir() / output, called_dir() / output.filename());
+			}
+
+	if (chdir(this->called_dir().c_str())!=0)
+		throw std::runtime_error("unable to move back to " + this->called_dir().string());
+
+	if (use_parallel())
+		MPI_Barrier(comm()); // everyone is out before the workspace goes
 
-	chdir(this->called_dir().c_str());
+	boost::system::error_code ec; // if the workspace is shared, the other processes may be removing it too.
+	boost::filesystem::remove_all(working_dir(), ec);
+	working_dir(called_dir());
 
 	if (this->verbose_level()>=3)
 		std::cout << "moved to called_dir '" << this->called_dir().string() << "'" << std::endl;
@@ -388,6 +519,8 @@ int  BertiniRealConfig::parse_commandline(int argc, char **argv)
 			{"sphere",required_argument, 0, 'S'}, {"s",required_argument, 0, 'S'},
 			{"patch",required_argument, 0, 'A'},
 			{"robustness",required_argument, 0, 'r'},{"r",required_argument, 0, 'r'},
+			{"batchsize",required_argument, 0, 'B'},
+			{"telemetry",no_argument, 0, 'L'},
 			{"input",required_argument,	0, 'i'}, {"i",required_argument, 0, 'i'},
 			{"version",		no_argument,			 0, 'v'}, {"v",		no_argument,			 0, 'v'},
 			{"help",		no_argument,			 0, 'h'}, {"h",		no_argument,			 0, 'h'},
@@ -399,13 +532,18 @@ int  BertiniRealConfig::parse_commandline(int argc, char **argv)
 			{"samepointtol",	required_argument,		 0, 'e'},
 			{"ignoresing", no_argument, 0, 'w'},
 			{"realify", no_argument, 0, 'R'},
+			{"scratch", required_argument, 0, 'W'},
+			{"components", required_argument, 0, 'C'},
+			{"serve", required_argument, 0, 'Q'},
+			{"sweep", required_argument, 0, 'K'},
+			{"reuse", required_argument, 0, 'U'},
 
 			{0, 0, 0, 0}
 		};
 		/* getopt_long stores the option index here. */
 		int option_index = 0;
 
-		choice = getopt_long_only (argc, argv, "d:c:Dg:V:o:smp:S:i:rvhM:E:P:tTe:wA:R", // if followed by colon, requires option.  two colons is optional
+		choice = getopt_long_only (argc, argv, "d:c:Dg:V:o:smp:S:i:rB:LvhM:E:P:tTe:wA:RW:C:Q:K:U:", // if followed by colon, requires option.  two colons is optional
 								   long_options, &option_index);
 
 		/* Detect the end of the options. */
@@ -471,6 +609,46 @@ int  BertiniRealConfig::parse_commandline(int argc, char **argv)
 				robustness(atoi(optarg));
 				break;
 
+			case 'B':
+				batch_size(atoi(optarg));
+				break;
+
+			case 'L':
+				path_telemetry(true);
+				break;
+
+			case 'W':
+				scratch_base(optarg);
+				break;
+
+			case 'Q':
+				serve_queue_ = boost::filesystem::absolute(optarg);
+				break;
+
+			case 'K':
+				sweep_filename_ = boost::filesystem::absolute(optarg);
+				break;
+
+			case 'U':
+				reuse_dir_ = boost::filesystem::absolute(optarg);
+				break;
+
+			case 'C':
+			{
+				batch_mode_ = true;
+				batch_components_.clear();
+				std::string components = optarg;
+				if (components=="all")
+					break;
+
+				std::stringstream converter(components);
+				std::string comp;
+				while (std::getline(converter, comp, ','))
+					if (!comp.empty())
+						batch_components_.push_back(atoi(comp.c_str()));
+				break;
+			}
+
 			case 'R':
 				realify_ = true;
 				break;
@@ -595,10 +773,8 @@ int  BertiniRealConfig::parse_commandline(int argc, char **argv)
 
 	this->set_called_dir(boost::filesystem::absolute(boost::filesystem::current_path()));
 	this->output_dir(boost::filesystem::absolute(this->output_dir()));
-
-	boost::filesystem::path new_name = this->called_dir();
-	new_name/="temp";
-	this->working_dir(new_name);
+	input_filename_ = boost::filesystem::absolute(input_filename_); // so it may be read from the workspace
+	this->working_dir(this->called_dir());
 
 
 
@@ -628,6 +804,8 @@ void BertiniRealConfig::print_usage() const
 	line("-h -help", 			" --", 		" ", "print this help menu");
 	line("-sphere -b", 			"string", 	" -- ", "name of sphere file");
 	line("-r -robustness", 			"int", 	" 1 ", "use lower robustness to speed up computation -- but get worse results, probably");
+	line("-batchsize", 			"int", 	" 0 ", "advance this many paths at once in double precision before the endgame.  0 or 1 tracks each path alone");
+	line("-telemetry", 			" -- ", 	" ", "append a record of every path of every solve to path_telemetry.csv, and print a summary after each solve");
 	line("-debug", 				" -- ", 	" ", "make bertini_real wait 30 seconds for you to attach a debugger");
 	line("-symengine -E", 		"string", 	"matlab", "select a symbolic engine.  choices are 'matlab' and 'python'");
 	line("-pycommand -P", 		"string", 	"python", "indicate how python should be called.  default is 'python'");
@@ -638,6 +816,11 @@ void BertiniRealConfig::print_usage() const
 	line("-gammatrick -g", 		"bool", "0" , "use the complex gamma trick for all paths.  is this good?  does it even work at all?  does using this option produce complete garbage, or speed things up like racing stripes?  i don't know, but it's implemented and an option.  choose your own adventure.  enjoy.");
 	line("-ignoresing", " -- ", " ", "ignore singular curve(s); only use if singular curves are naked");
 	line("-realify", " -- ", " ", "change patch and discard imaginary parts where possible throughout decomposition");
+	line("-scratch", "string", " -- ", "make a private workspace for the run's temporary files in this folder, and remove it at the end.  'memory' uses /dev/shm");
+	line("-components", "string", " -- ", "decompose several components of the dimension in one run, each into its own _dim_X_comp_Y folder.  'all', or a comma separated list like 0,2,3");
+	line("-serve", "string", " -- ", "keep the processes running, and run the bertini_real and sampler jobs put in this queue folder.  see job_service.hpp for the format of a job");
+	line("-sweep", "string", " -- ", "decompose the chosen component again at each line of parameter values in this file, continuing its witness points from the previous values.  see parameter_sweep.hpp for the format");
+	line("-reuse", "string", " -- ", "for a surface, reuse the critical curve, singular curves and their critical points from the earlier decomposition in this folder, which used another sphere.  only the sphere-dependent parts are recomputed");
 	printf("\n\n\n");
 	return;
 }
@@ -646,6 +829,11 @@ void BertiniRealConfig::init()
 {
 	target_component_ = -2;
 	target_dimension_ = -1;
+	batch_mode_ = false;
+	batch_components_.clear();
+	serve_queue_.clear();
+	sweep_filename_.clear();
+	reuse_dir_.clear();
 
 	debugwait_ = false;
 	max_deflations_ = 10;
@@ -0,0 +1,189 @@
+#include "run_profile.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <sys/resource.h>
+
+
+#if MPI_VERSION >= 3
+#define BR_MPI_SEND_BUFFER const void *
+#else
+#define BR_MPI_SEND_BUFFER void *
+#endif
+
+
+namespace {
+
+	/**
+	 \brief count the bytes of a message in the profile.
+	 */
+	void count_message(int count, MPI_Datatype datatype)
+	{
+		int type_size;
+		PMPI_Type_size(datatype, &type_size);
+		RunProfile::Instance().CountBytesSent((long long) count * type_size);
+	}
+
+} // re: anonymous namespace
+
+
+
+
+// the hooks through the MPI profiling interface, which count every byte sent by this process.
+extern "C" {
+
+int MPI_Send(BR_MPI_SEND_BUFFER buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm)
+{
+	count_message(count, datatype);
+	return PMPI_Send(buf, count, datatype, dest, tag, comm);
+}
+
+
+int MPI_Isend(BR_MPI_SEND_BUFFER buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request *request)
+{
+	count_message(count, datatype);
+	return PMPI_Isend(buf, count, datatype, dest, tag, comm, request);
+}
+
+
+int MPI_Bcast(void *buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm)
+{
+	int my_id, num_procs;
+	PMPI_Comm_rank(comm, &my_id);
+	PMPI_Comm_size(comm, &num_procs);
+	if (my_id==root)
+		count_message(count*(num_procs-1), datatype);
+	return PMPI_Bcast(buffer, count, datatype, root, comm);
+}
+
+} // re: extern "C"
+
+
+
+
+RunProfile & RunProfile::Instance()
+{
+	static RunProfile profile;
+	return profile;
+}
+
+
+
+
+long RunProfile::PeakRSS()
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage)!=0)
+		return 0;
+#ifdef __APPLE__
+	return usage.ru_maxrss/1024; // bytes, on mac
+#else
+	return usage.ru_maxrss;
+#endif
+}
+
+
+
+
+RunProfile::StageTimer::StageTimer(std::string const& name)
+{
+	RunProfile & profile = RunProfile::Instance();
+
+	std::string full_name = profile.open_stages_.empty() ? name : profile.open_stages_.back() + "/" + name;
+
+	auto existing = std::find_if(profile.stages_.begin(), profile.stages_.end(),
+								 [&full_name](Stage const& s){return s.name==full_name;});
+	index_ = existing - profile.stages_.begin();
+	if (existing==profile.stages_.end())
+		profile.stages_.push_back(Stage{full_name, int(profile.open_stages_.size()), 0, 0, 0, 0, 0, 0, 0});
+	profile.stages_[index_].num_calls++;
+
+	profile.open_stages_.push_back(full_name);
+
+	num_solves_at_start_ = profile.num_solves_;
+	num_paths_at_start_ = profile.num_paths_;
+	mpi_bytes_at_start_ = profile.mpi_bytes_sent_;
+}
+
+
+RunProfile::StageTimer::~StageTimer()
+{
+	RunProfile & profile = RunProfile::Instance();
+
+	boost::timer::cpu_times elapsed = timer_.elapsed();
+
+	Stage & stage = profile.stages_[index_];
+	stage.wall_time += elapsed.wall*1e-9;
+	stage.cpu_time += (elapsed.user+elapsed.system)*1e-9;
+	stage.peak_rss_kb = PeakRSS();
+	stage.num_solves += profile.num_solves_ - num_solves_at_start_;
+	stage.num_paths += profile.num_paths_ - num_paths_at_start_;
+	stage.mpi_bytes_sent += profile.mpi_bytes_sent_ - mpi_bytes_at_start_;
+
+	profile.open_stages_.pop_back();
+}
+
+
+
+
+void RunProfile::Finish(MPI_Comm comm, int head)
+{
+	long long bytes_sent = mpi_bytes_sent_;
+	long peak_rss = PeakRSS();
+
+	MPI_Reduce(&bytes_sent, &total_mpi_bytes_sent_, 1, MPI_LONG_LONG, MPI_SUM, head, comm);
+	MPI_Reduce(&peak_rss, &max_peak_rss_kb_, 1, MPI_LONG, MPI_MAX, head, comm);
+}
+
+
+
+
+void RunProfile::Reset()
+{
+	if (!open_stages_.empty())
+		throw std::logic_error("resetting the run profile with stage " + open_stages_.back() + " open");
+
+	timer_.start();
+	stages_.clear();
+	num_solves_ = 0;
+	num_paths_ = 0;
+	mpi_bytes_sent_ = 0;
+	total_mpi_bytes_sent_ = 0;
+	max_peak_rss_kb_ = 0;
+}
+
+
+
+
+void RunProfile::Write(boost::filesystem::path const& filename, std::string const& program, int num_procs) const
+{
+	FILE *OUT = fopen(filename.c_str(), "w");
+	if (OUT==NULL)
+		throw std::runtime_error("unable to open run profile file " + filename.string() + " for writing");
+
+	boost::timer::cpu_times elapsed = timer_.elapsed();
+
+	fprintf(OUT, "{\n");
+	fprintf(OUT, "\t\"program\": \"%s\",\n", program.c_str());
+	fprintf(OUT, "\t\"num_procs\": %d,\n", num_procs);
+	fprintf(OUT, "\t\"wall_time\": %.6f,\n", elapsed.wall*1e-9);
+	fprintf(OUT, "\t\"cpu_time\": %.6f,\n", (elapsed.user+elapsed.system)*1e-9);
+	fprintf(OUT, "\t\"peak_rss_kb\": %ld,\n", PeakRSS());
+	fprintf(OUT, "\t\"max_peak_rss_kb_all_procs\": %ld,\n", max_peak_rss_kb_);
+	fprintf(OUT, "\t\"num_solves\": %lld,\n", num_solves_);
+	fprintf(OUT, "\t\"num_paths\": %lld,\n", num_paths_);
+	fprintf(OUT, "\t\"mpi_bytes_sent\": %lld,\n", mpi_bytes_sent_);
+	fprintf(OUT, "\t\"mpi_bytes_sent_all_procs\": %lld,\n", total_mpi_bytes_sent_);
+
+	fprintf(OUT, "\t\"stages\": [");
+	for (unsigned ii=0; ii<stages_.size(); ii++)
+	{
+		Stage const& s = stages_[ii];
+		fprintf(OUT, "%s\n\t\t{\"name\": \"%s\", \"depth\": %d, \"num_calls\": %d, \"wall_time\": %.6f, \"cpu_time\": %.6f, \"peak_rss_kb\": %ld, \"num_solves\": %lld, \"num_paths\": %lld, \"mpi_bytes_sent\": %lld}",
+				ii==0 ? "" : ",", s.name.c_str(), s.depth, s.num_calls, s.wall_time, s.cpu_time, s.peak_rss_kb, s.num_solves, s.num_paths, s.mpi_bytes_sent);
+	}
+	fprintf(OUT, "\n\t]\n}\n");
+
+	fclose(OUT);
+}
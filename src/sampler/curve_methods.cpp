@@ -2,6 +2,18 @@
 
 
 
+namespace {
+
+	// the curve is known in the sampling stream by the name of its decomposition's folder.
+	std::string StreamName(boost::filesystem::path const& input_filename)
+	{
+		return input_filename.parent_path().filename().string();
+	}
+
+} // re: anonymous namespace
+
+
+
 
 
 
@@ -86,7 +98,7 @@ void Curve::AdaptiveMovementSamplerSerial(VertexSet & V,
 										   sampler_configuration & sampler_options,
 										   SolverConfiguration & solve_options)
 {
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	solve_options.get_PPD();
 
 
@@ -116,7 +128,7 @@ void Curve::AdaptiveMovementSamplerMaster(VertexSet & V,
 										   sampler_configuration & sampler_options,
 										   SolverConfiguration & solve_options)
 {
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	solve_options.get_PPD();
 
 
@@ -158,14 +170,14 @@ void Curve::AdaptiveMovementSamplerMaster(VertexSet & V,
 		if (solve_options.have_available())
 			continue;
 
-		ReportEdgeMaster(V, solve_options);
+		ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 
 	//wait for everybody to finish
 
 	while (solve_options.have_active()) {// each active worker
-		int source = ReportEdgeMaster(V, solve_options);
+		int source = ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 	solve_options.send_all_available(-1);
@@ -217,7 +229,7 @@ void Curve::AdaptiveDistanceSamplerSerial(VertexSet & V,
 													SolverConfiguration & solve_options)
 {
 
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	solve_options.get_PPD();
 
 	WitnessSet W;
@@ -253,7 +265,7 @@ void Curve::AdaptiveDistanceSamplerMaster(VertexSet & V,
 													sampler_configuration & sampler_options,
 													SolverConfiguration & solve_options)
 {
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	solve_options.get_PPD();
 
 	WitnessSet W;
@@ -295,14 +307,14 @@ void Curve::AdaptiveDistanceSamplerMaster(VertexSet & V,
 		if (solve_options.have_available())
 			continue;
 
-		ReportEdgeMaster(V, solve_options);
+		ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 
 	//wait for everybody to finish
 
 	while (solve_options.have_active()) {// each active worker
-		int source = ReportEdgeMaster(V, solve_options);
+		int source = ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 	solve_options.send_all_available(-1);
@@ -355,7 +367,7 @@ void Curve::SemiFixedSamplerSerial(VertexSet & V,  //change this original one to
 									  SolverConfiguration & solve_options,
 									  std::vector<int> const& num_samples_per_interval)
 {
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	solve_options.get_PPD();
 
 	WitnessSet W;
@@ -397,7 +409,7 @@ void Curve::SemiFixedSamplerMaster(VertexSet & V,  //master in parallel for semi
 	WitnessSet W;
 
 
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	// this parse HAS to be done before calling for help...
 
 	solve_options.get_PPD();
@@ -436,14 +448,14 @@ void Curve::SemiFixedSamplerMaster(VertexSet & V,  //master in parallel for semi
 		if (solve_options.have_available())
 			continue;
 
-		ReportEdgeMaster(V, solve_options);
+		ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 
 	//wait for everybody to finish
 
 	while (solve_options.have_active()) {// each active worker
-		int source = ReportEdgeMaster(V, solve_options);
+		int source = ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 	solve_options.send_all_available(-1);
@@ -515,7 +527,7 @@ void Curve::FixedSamplerSerial(VertexSet & V,
 	WitnessSet W;
 
 
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	// this parse HAS to be done before calling for help...
 
 	solve_options.get_PPD();
@@ -551,7 +563,7 @@ void Curve::FixedSamplerMaster(VertexSet & V,
 	WitnessSet W;
 
 
-	parse_input_file(input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	// this parse HAS to be done before calling for help...
 
 	solve_options.get_PPD();
@@ -597,14 +609,14 @@ void Curve::FixedSamplerMaster(VertexSet & V,
 		if (solve_options.have_available())
 			continue;
 
-		ReportEdgeMaster(V, solve_options);
+		ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 
 	//wait for everybody to finish
 
 	while (solve_options.have_active()) {// each active worker
-		int source = ReportEdgeMaster(V, solve_options);
+		int source = ReportEdgeMaster(V, sampler_options, solve_options);
 	}
 
 	solve_options.send_all_available(-1);
@@ -641,7 +653,7 @@ void Curve::FixedSamplerWorker(VertexSet & V,
 }
 
 
-int Curve::ReportEdgeMaster(VertexSet & V, SolverConfiguration & solve_options)
+int Curve::ReportEdgeMaster(VertexSet & V, sampler_configuration & sampler_options, SolverConfiguration & solve_options)
 {
 	// receive note from worker *** that edge ___ is done
 	// receive finished_edge_index
@@ -653,6 +665,10 @@ int Curve::ReportEdgeMaster(VertexSet & V, SolverConfiguration & solve_options)
 
 	SynchronizeVertexSetMaster(finished_edge_index, V, whos_talking, solve_options);
 
+	// the worker's passes are not seen here, only the finished edge.
+	if (sampler_options.stream)
+		sampler_options.stream->Edge(StreamName(input_filename()), finished_edge_index, -1, sample_indices_[finished_edge_index], V);
+
 	solve_options.deactivate(whos_talking);
 
 	return whos_talking;
@@ -797,6 +813,10 @@ void Curve::SampleEdgeAdaptiveMovement(	int ii,
 
 	prev_num_samp = num_samples_on_edge(ii); // grab the number of points from the array of integers
 
+	const std::string stream_name = StreamName(input_filename());
+	if (sampler_options.stream)
+		sampler_options.stream->Edge(stream_name, ii, 0, current_indices, V);
+
 
 
 	int pass_number  = 0;//this should be the only place this is reset.
@@ -967,6 +987,9 @@ void Curve::SampleEdgeAdaptiveMovement(	int ii,
 		if (sampler_options.verbose_level()>=1) // print by default
 			printf("\n\n");
 
+		if (sampler_options.stream)
+			sampler_options.stream->Edge(stream_name, ii, pass_number+1, new_indices, V);
+
 		if( (num_refinements == 0) || (pass_number >= sampler_options.maximum_num_iterations) ) // if have no need for new samples
 		{
 			sample_indices_[ii].swap(new_indices);
@@ -1083,6 +1106,10 @@ void Curve::SampleEdgeAdaptiveDistance(	int ii,
 
 	prev_num_samp = num_samples_on_edge(ii); // grab the number of points from the array of integers
 
+	const std::string stream_name = StreamName(input_filename());
+	if (sampler_options.stream)
+		sampler_options.stream->Edge(stream_name, ii, 0, current_indices, V);
+
 
 	int pass_number  = 0;//this should be the only place this is reset.
 	while((num_refinements>0) && (pass_number < sampler_options.maximum_num_iterations)) // breaking condition is all samples being less than TOL away from each other (in the infty norm sense).
@@ -1273,6 +1300,9 @@ void Curve::SampleEdgeAdaptiveDistance(	int ii,
 		prev_num_samp=sample_counter; // update the number of samples
 		pass_number++;
 
+		if (sampler_options.stream)
+			sampler_options.stream->Edge(stream_name, ii, pass_number, current_indices, V);
+
 	}//while loop
 
 	sample_indices_[ii].swap(current_indices);
@@ -0,0 +1,18 @@
+#include "sampler.hpp"
+
+
+
+
+int main(int argC, char *args[])
+{
+	MPI_Init(&argC,&args);
+
+	sampler_configuration sampler_options;
+	sampler_options.parse_commandline(argC, args);
+
+	RunSampler(sampler_options);
+
+	MPI_Finalize();
+
+	return 0;
+}
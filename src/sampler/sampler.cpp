@@ -2,6 +2,48 @@
 
 
 
+namespace {
+
+	// 64-bit FNV-1a, over the bytes of an open file, continuing from hash.
+	uint64_t HashFile(FILE *IN, uint64_t hash)
+	{
+		int c;
+		while ( (c = fgetc(IN)) != EOF)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ULL;
+		}
+		fclose(IN);
+		return hash;
+	}
+
+
+	/**
+	 \brief hash the files which identify a decomposition -- its vertex set, its summary and its faces -- whether loose in the folder or packed in its archive.  files it does not have are skipped.
+	 */
+	uint64_t HashDecomposition(boost::filesystem::path const& directoryName)
+	{
+		const std::vector<std::string> names{"V.vertex", "V.vertex.bin", "S.surf", "F.faces"};
+
+		uint64_t hash = 14695981039346656037ULL;
+		if (DecompositionArchive::ExistsIn(directoryName))
+		{
+			DecompositionArchive archive(directoryName / DecompositionArchive::DefaultName());
+			for (auto const& name : names)
+				if (archive.HasChunk(name))
+					hash = HashFile(archive.OpenChunk(name), hash);
+		}
+		else
+			for (auto const& name : names)
+				if (boost::filesystem::is_regular_file(directoryName / name))
+					hash = HashFile(safe_fopen_read(directoryName / name), hash);
+		return hash;
+	}
+
+} // re: anonymous namespace
+
+
+
 
 
 
@@ -31,6 +73,36 @@ void sampler_configuration::SetDefaults()
 	mode = Mode::AdaptivePredMovement;
 
 	save_ribs = false;
+
+	use_error_estimate = false;
+}
+
+
+
+std::string sampler_configuration::journal_run_name() const
+{
+	std::stringstream converter;
+	if (samples_face_subset())
+		converter << "faces_" << first_face << "-" << last_face;
+	else
+		converter << "faces_all";
+	return converter.str();
+}
+
+
+std::string sampler_configuration::journal_signature() const
+{
+	std::stringstream converter;
+	converter << std::setprecision(17);
+	converter << "mode " << static_cast<int>(mode) << "\n"
+			  << "tol " << mpf_get_d(TOL) << "\n"
+			  << "iterations " << minimum_num_iterations << " " << maximum_num_iterations << "\n"
+			  << "ribs " << min_num_ribs << " " << max_num_ribs << "\n"
+			  << "numsamples " << target_num_samples << "\n"
+			  << "cyclenum " << use_uniform_cycle_num << " " << cycle_num << "\n"
+			  << "errorest " << use_error_estimate << "\n"
+			  << "decomposition " << decomposition_hash << "\n";
+	return converter.str();
 }
 
 
@@ -78,6 +150,12 @@ void sampler_configuration::print_usage()
 	line("-nouniformcyclenum",  " -- ", " ", "turn OFF uniform cycle number usage in surface sampling.  buggy.");
 	line("-uniformcyclenum",  " -- ", " ", "turn ON uniform cycle number usage in surface sampling.  works well.");
 	line("-saveribs",  " -- ", " ", "turn ON saving of ribs for each face.  off by default.");
+	line("-errorest",  " -- ", " ", "turn ON refinement of surfaces by midpoint deviation from straight, rather than by distance.  uses -tol.");
+	line("-faces",  "<a-b>", "all", "sample only faces a through b, inclusive, of a surface.  writes only the face journal; run again without -faces to merge.");
+	line("-freshstart",  " -- ", " ", "discard face journals from previous runs, rather than resuming from them.");
+	line("-stream",  " -- ", " ", "write each refinement pass to samp.stream as it completes, for viewing while sampling runs.  adaptive faces are then refined a pass at a time over all ribs.");
+	line("-benchmark",  "<int>", "0", "time this many evaluations of the midpoint homotopy, at the first face sampled adaptively.  pair with -faces to keep the run short.  needs a build with -Devaluator_benchmark.");
+	line("-scratch",  "<dir>", " -- ", "make a private workspace for the run's temporary files in this folder, and remove it at the end.  'memory' uses /dev/shm");
 	std::cout << "\n\n\n";
 	std::cout.flush();
 	return;
@@ -115,12 +193,18 @@ int  sampler_configuration::parse_commandline(int argc, char **argv)
 			{"nouniformcyclenum", no_argument, 0, 'U'},
 			{"cyclenum", required_argument, 0, 'c'},
 			{"saveribs", no_argument, 0, 'I'},
+			{"faces", required_argument, 0, 'F'},
+			{"freshstart", no_argument, 0, 'E'},
+			{"errorest", no_argument, 0, 'e'},
+			{"stream", no_argument, 0, 'S'},
+			{"benchmark", required_argument, 0, 'B'},
+			{"scratch", required_argument, 0, 'W'},
 			{0, 0, 0, 0}
 		};
 		/* getopt_long stores the option index here. */
 		int option_index = 0;
 
-		choice = getopt_long_only (argc, argv, "bdf:svt:V:l:m:R:r:hM:uUc:I", // colon requires option, two is optional
+		choice = getopt_long_only (argc, argv, "bdf:svt:V:l:m:R:r:hM:uUc:IF:EeSB:W:", // colon requires option, two is optional
 															 long_options, &option_index);
 
 		/* Detect the end of the options. */
@@ -223,6 +307,49 @@ int  sampler_configuration::parse_commandline(int argc, char **argv)
 				this->save_ribs = true;
 				break;
 
+			case 'F':
+			{
+				std::string curr_opt{optarg};
+				auto dash = curr_opt.find('-');
+				if (dash==std::string::npos) {
+					first_face = last_face = atoi(optarg);
+				}
+				else {
+					first_face = atoi(curr_opt.substr(0,dash).c_str());
+					last_face = atoi(curr_opt.substr(dash+1).c_str());
+				}
+
+				if (first_face<0 || last_face<first_face) {
+					std::cout << "option to 'faces' must be a range a-b of face indices, with 0 <= a <= b, but you provided " << curr_opt << std::endl;
+					exit(0);
+				}
+				break;
+			}
+
+			case 'E':
+				this->fresh_start = true;
+				break;
+
+			case 'e':
+				this->use_error_estimate = true;
+				break;
+
+			case 'S':
+				this->stream_output = true;
+				break;
+
+			case 'B':
+#ifdef evaluator_benchmark
+				this->benchmark_evaluations = atoi(optarg);
+#else
+				std::cout << "-benchmark is only available when built with CPPFLAGS=-Devaluator_benchmark.  ignoring it." << std::endl;
+#endif
+				break;
+
+			case 'W':
+				scratch_base(optarg);
+				break;
+
 			case '?':
 				/* getopt_long already printed an error message. */
 				break;
@@ -247,6 +374,9 @@ int  sampler_configuration::parse_commandline(int argc, char **argv)
 		putchar ('\n');
 	}
 
+	this->set_called_dir(boost::filesystem::absolute(boost::filesystem::current_path()));
+	this->working_dir(this->called_dir());
+
 	return 0;
 }
 
@@ -256,12 +386,9 @@ int  sampler_configuration::parse_commandline(int argc, char **argv)
 
 
 
-int main(int argC, char *args[])
+int RunSampler(sampler_configuration & sampler_options)
 {
-	MPI_Init(&argC,&args);
-
-	sampler_configuration sampler_options;
-	sampler_options.parse_commandline(argC, args);
+	sampler_options.move_to_temp({"Dir_Name"});
 
 
 	if (false) { // sampler_options.debugwait()
@@ -286,20 +413,52 @@ int main(int argC, char *args[])
 
 
 
+	int result = 0;
 	if (sampler_options.is_head())
 	{
 		boost::timer::auto_cpu_timer t;
-		SamplerMaster(sampler_options);
+		try{
+			SamplerMaster(sampler_options);
+		}
+		catch (std::exception &e){
+			std::cout << "uncaught exception from sampler master;" << std::endl;
+			std::cout << e.what() << std::endl;
+			result = 1;
+		}
+
+		// dismiss the workers, even if the sampling failed, so that they are not left waiting for a routine.
+		if (sampler_options.use_parallel())
+		{
+			int sendme = TERMINATE;
+			MPI_Bcast(&sendme, 1, MPI_INT, sampler_options.head(), sampler_options.comm());
+		}
 	}
 	else
 	{
-		SamplerWorker(sampler_options);
+		// a worker which throws has left the head waiting on it, and the two cannot be brought back into step.  abort the run, rather than leave every process hanging.
+		try{
+			SamplerWorker(sampler_options);
+		}
+		catch (std::exception &e){
+			std::cout << "uncaught exception from sampler worker " << sampler_options.id() << ", aborting;" << std::endl;
+			std::cout << e.what() << std::endl;
+			sampler_options.abort(1);
+		}
 	}
 
+	RunProfile::Instance().Finish(sampler_options.comm(), sampler_options.head());
+	if (sampler_options.is_head() && result==0)
+		RunProfile::Instance().Write(sampler_options.output_dir() / RunProfile::FileName("sampler"), "sampler", sampler_options.num_procs());
+
+	// every process returns the same status, so that a JobService agrees on whether the job failed.
+	if (sampler_options.use_parallel())
+		MPI_Allreduce(MPI_IN_PLACE, &result, 1, MPI_INT, MPI_MAX, sampler_options.comm());
+
+	sampler_options.move_to_called();
+
 	clearMP();
-	MPI_Finalize();
 
-	return 0;
+	return result;
 }
 
 
@@ -314,6 +473,7 @@ void SamplerMaster(sampler_configuration & sampler_options)
 	boost::filesystem::path directoryName;
 
 	get_dir_mptype_dimen( directoryName, MPType, dimension); // i really do hate this.
+	directoryName = sampler_options.called_dir() / directoryName; // Dir_Name names it relative to where we were called, not the workspace.
 	sampler_options.output_dir(directoryName);
 	witnessSetName = directoryName / "WitnessSet";
 	samplingNamenew = directoryName;
@@ -359,7 +519,7 @@ void SamplerMaster(sampler_configuration & sampler_options)
 	if (solve_options.use_parallel())
 	{
 		int routine = TRACKER_CONFIG;
-		MPI_Bcast(&routine, 1, MPI_INT, solve_options.head(), MPI_COMM_WORLD);
+		MPI_Bcast(&routine, 1, MPI_INT, solve_options.head(), solve_options.comm());
 		bcast_tracker_config_t(&solve_options.T, solve_options.id(), solve_options.head() );
 	}
 
@@ -367,9 +527,37 @@ void SamplerMaster(sampler_configuration & sampler_options)
 	VertexSet V(decom_pointy->num_variables());
 
 	V.set_tracker_config(&solve_options.T);
-	V.setup_vertices(directoryName / "V.vertex"); //setup V structure from V.vertex
+	if (DecompositionArchive::ExistsIn(directoryName))
+	{
+		DecompositionArchive archive(directoryName / DecompositionArchive::DefaultName());
+		if (archive.HasChunk("V.vertex.bin"))
+		{
+			FILE *IN = archive.OpenChunk("V.vertex.bin");
+			V.setup_vertices_binary(IN);
+			fclose(IN);
+		}
+		else
+		{
+			FILE *IN = archive.OpenChunk("V.vertex");
+			V.setup_vertices(IN);
+			fclose(IN);
+		}
+	}
+	else if (boost::filesystem::is_regular_file(directoryName / "V.vertex.bin"))
+	{
+		FILE *IN = safe_fopen_read(directoryName / "V.vertex.bin");
+		V.setup_vertices_binary(IN);
+		fclose(IN);
+	}
+	else
+		V.setup_vertices(directoryName / "V.vertex"); //setup V structure from V.vertex
 	V.set_same_point_tolerance(1e1*solve_options.T.real_threshold);
 
+	sampler_options.decomposition_hash = HashDecomposition(directoryName);
+
+	if (sampler_options.stream_output)
+		sampler_options.stream = std::make_shared<SamplingStream>(directoryName / SamplingStream::DefaultName(), V.num_natural_variables());
+
 
 	/////////
 	////////
@@ -383,6 +571,7 @@ void SamplerMaster(sampler_configuration & sampler_options)
 	switch (dimension) {
 		case 1:
 		{
+			RunProfile::StageTimer stage("curve");
 			switch (sampler_options.mode){
 				case sampler_configuration::Mode::Fixed:
 					curve.FixedSampler(V,
@@ -407,8 +596,15 @@ void SamplerMaster(sampler_configuration & sampler_options)
 					throw std::runtime_error("semi fixed not available for root-level curves.");
 					break;
 			} // switch
+
+			if (sampler_options.stream)
+			{
+				sampler_options.stream->Finish();
+				sampler_options.stream.reset();
+			}
 			curve.output_sampling_data(directoryName);
 			V.print(directoryName / "V_samp.vertex");
+			DecompositionArchive::Pack(directoryName);
 
 			break;
 		}
@@ -416,6 +612,7 @@ void SamplerMaster(sampler_configuration & sampler_options)
 
 		case 2:
 		{
+			RunProfile::StageTimer stage("surface");
 			switch (sampler_options.mode){
 				case sampler_configuration::Mode::Fixed:
 				{
@@ -441,18 +638,27 @@ void SamplerMaster(sampler_configuration & sampler_options)
 
 			} // switch
 
+			if (sampler_options.stream)
+			{
+				sampler_options.stream->Finish();
+				sampler_options.stream.reset();
+			}
+
+			if (sampler_options.samples_face_subset())
+			{
+				std::cout << "sampled faces " << sampler_options.first_face << " through " << sampler_options.last_face << " into journal " << FaceJournal::Directory(directoryName) << ".\nrun sampler again without -faces, with all journals in that folder, to merge and write the sampling." << std::endl;
+				break;
+			}
+
 			surf.output_sampling_data(directoryName);
 			V.print(directoryName / "V_samp.vertex");
+			DecompositionArchive::Pack(directoryName);
 
 			break;
 		}
 		default:
 			break;
 	}
-
-	// dismiss the workers
-	int sendme = TERMINATE;
-	MPI_Bcast(&sendme, 1, MPI_INT, 0, MPI_COMM_WORLD);
 }
 
 
@@ -471,7 +677,7 @@ void SamplerWorker(sampler_configuration & sampler_options)
 
 	while (routine != TERMINATE) {
 		// get the task to perform.  yes, everyone has to participate, because of B1 things.  ugh.
-		MPI_Bcast(&routine, 1, MPI_INT, solve_options.head(), MPI_COMM_WORLD);
+		MPI_Bcast(&routine, 1, MPI_INT, solve_options.head(), solve_options.comm());
 
 		if ( (solve_options.id()==1) && (sampler_options.verbose_level()>=2)) { //(routine!=0) &&
 			std::cout << "sampler worker received call for help for solver " << enum_lookup(routine) << " (code " << routine << ")" << std::endl;
@@ -488,12 +694,6 @@ void SamplerWorker(sampler_configuration & sampler_options)
 				WorkerSampleSurface(sampler_options, solve_options);
 				break;
 			}
-			case PARSING:
-			{
-				int single_int_buffer = 0;
-				MPI_Bcast(&single_int_buffer, 1, MPI_INT, solve_options.head(), solve_options.comm()); // this catches a broadcast from Bertini's parser...
-				break;
-			}
 			case TRACKER_CONFIG:
 			{
 				if (have_tracker_config)
@@ -504,6 +704,9 @@ void SamplerWorker(sampler_configuration & sampler_options)
 				initMP(solve_options.T.Precision);
 				break;
 			}
+			case PARSING:
+				CatchParse();
+				break;
 			case TERMINATE:
 				break;
 			default:
@@ -521,7 +724,7 @@ void common_sampler_startup(const Decomposition & D,
 							SolverConfiguration & solve_options)
 {
 
-	parse_input_file(D.input_filename()); // restores all the temp files generated by the parser, to this folder.  i think this can be removed?  but the PPD and tracker config both depend on it...  so maybe not.
+	parse_or_restore_input_file(D.input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.  the PPD and tracker config both depend on it.
 
 
 
@@ -553,6 +756,18 @@ void common_sampler_startup(const Decomposition & D,
 
 
 
+void parse_or_restore_input_file(boost::filesystem::path const& input_filename,
+								 sampler_configuration const& sampler_options)
+{
+	int MPType;
+	if (!RestoreParsedSystem(input_filename, &MPType, sampler_options.output_dir() / "parsed_system"))
+		parse_input_file(input_filename);
+}
+
+
+
+
+
 //dehomogenizes, takes the average, computes the projection.
 //takes in the full projection \pi, including the homogenizing coordinate.
 void estimate_new_projection_value(comp_mp result, vec_mp left, vec_mp right, vec_mp pi){
@@ -665,6 +880,57 @@ void estimate_new_projection_value(comp_mp result, vec_mp estimated_point, vec_m
 
 
 
+// the distance from mid to the line through left and right, after dehomogenizing, in the real parts only.
+void midpoint_deviation(mpf_t result, const vec_mp left, const vec_mp mid, const vec_mp right)
+{
+	vec_mp dehom_left, dehom_mid, dehom_right;
+	init_vec_mp(dehom_left,0);  dehom_left->size  = 0;
+	init_vec_mp(dehom_mid,0);   dehom_mid->size   = 0;
+	init_vec_mp(dehom_right,0); dehom_right->size = 0;
+
+	dehomogenize(&dehom_left, left);
+	dehomogenize(&dehom_mid, mid);
+	dehomogenize(&dehom_right, right);
+
+	int n = std::min(std::min(dehom_left->size, dehom_mid->size), dehom_right->size);
+
+	// chord = right-left, offset = mid-left.  the deviation is the part of offset perpendicular to chord.
+	mpf_t chord_sq, along, t, perp_sq, c, d;
+	mpf_init(chord_sq); mpf_init(along); mpf_init(t); mpf_init(perp_sq); mpf_init(c); mpf_init(d);
+	mpf_set_ui(chord_sq, 0); mpf_set_ui(along, 0);
+
+	for (int ii=0; ii<n; ii++) {
+		mpf_sub(c, dehom_right->coord[ii].r, dehom_left->coord[ii].r);
+		mpf_sub(d, dehom_mid->coord[ii].r, dehom_left->coord[ii].r);
+
+		mpf_mul(t, c, c);  mpf_add(chord_sq, chord_sq, t);
+		mpf_mul(t, c, d);  mpf_add(along, along, t);
+	}
+
+	if (mpf_sgn(chord_sq)>0)
+		mpf_div(along, along, chord_sq); // now the fraction of the way along the chord
+	else
+		mpf_set_ui(along, 0);
+
+	mpf_set_ui(perp_sq, 0);
+	for (int ii=0; ii<n; ii++) {
+		mpf_sub(c, dehom_right->coord[ii].r, dehom_left->coord[ii].r);
+		mpf_sub(d, dehom_mid->coord[ii].r, dehom_left->coord[ii].r);
+
+		mpf_mul(t, along, c);
+		mpf_sub(d, d, t);
+		mpf_mul(t, d, d);
+		mpf_add(perp_sq, perp_sq, t);
+	}
+
+	mpf_sqrt(result, perp_sq);
+
+	mpf_clear(chord_sq); mpf_clear(along); mpf_clear(t); mpf_clear(perp_sq); mpf_clear(c); mpf_clear(d);
+	clear_vec_mp(dehom_left); clear_vec_mp(dehom_mid); clear_vec_mp(dehom_right);
+}
+
+
+
 
 
 void UnpackProjvals(vec_mp projvals, const std::vector< int > & rib, int projind, const VertexSet & V)
@@ -1,4 +1,5 @@
 #include "sampler.hpp"
+#include <algorithm>
 
 #include <boost/math/common_factor.hpp>
 
@@ -13,31 +14,74 @@ void Surface::fixed_sampler(VertexSet & V,
 	if (sampler_options.save_ribs)
 		PrepareForSavingRibs(sampler_options);
 
+	if (sampler_options.stream)
+		for (unsigned int ii=0; ii<num_faces(); ii++)
+			sampler_options.stream->Face(ii, 0, RawFaceTriangles(ii), V);
+
 	FixedSampleCurves(V, sampler_options, solve_options);
 
 	solve_options.force_no_parallel(true);
 
 	//once you have the fixed samples of the curves, down here is just making the integer triangles.
-	for (unsigned int ii=0; ii<num_faces(); ii++) {
-
+	SampleFaces(V, sampler_options, [&](int ii)
+	{
 		if (faces_[ii].is_degenerate() || faces_[ii].is_malformed())
-			continue;
+			return true;
 
 		std::cout << "Face " << ii << " of " << num_faces() << std::endl;
 		if (sampler_options.verbose_level()>=1)
 			std::cout << faces_[ii];
 
 		FixedSampleFace(ii, V, sampler_options, solve_options);
-	} // re: for ii, that is for the faces
+		return true;
+	});
 
 	return;
 }
 
 
+void Surface::SampleFaces(VertexSet & V,
+						  sampler_configuration & sampler_options,
+						  std::function<bool(int)> const& sample_face)
+{
+	RunProfile::StageTimer stage("faces");
+
+	samples_.assign(num_faces(), std::vector< Triangle >(0));
+
+	if (sampler_options.fresh_start)
+		boost::filesystem::remove_all(FaceJournal::Directory(sampler_options.output_dir()));
+
+	FaceJournal journal(sampler_options.output_dir(), sampler_options.journal_run_name(), sampler_options.journal_signature(), num_faces());
+
+	V.set_curr_input(this->input_filename());
+	auto num_replayed = journal.Replay(V, samples_);
+	if (num_replayed>0)
+		std::cout << "resumed " << num_replayed << " completed faces from " << FaceJournal::Directory(sampler_options.output_dir()) << std::endl;
+
+	if (sampler_options.stream)
+		for (unsigned int ii=0; ii<num_faces(); ii++)
+			if (journal.IsComplete(ii))
+				sampler_options.stream->Face(ii, -1, samples_[ii], V);
+
+
+	for (unsigned int ii=0; ii<num_faces(); ii++) {
+
+		if (!sampler_options.face_in_range(ii) || journal.IsComplete(ii))
+			continue;
+
+		auto first_new_vertex = V.num_vertices();
+		if (sample_face(ii))
+			journal.Record(ii, samples_[ii], V, first_new_vertex);
+	} // re: for ii, that is for the faces
+}
+
+
 void Surface::FixedSampleCurves(VertexSet & V,
 								sampler_configuration & sampler_options,
 								SolverConfiguration & solve_options)
 {
+	RunProfile::StageTimer stage("curves");
+
 	int target_num_samples = sampler_options.target_num_samples;
 
 	std::cout << "critical curve" << std::endl;
@@ -115,7 +159,7 @@ void Surface::FixedSampleFace(int face_index, VertexSet & V, sampler_configurati
 
 	//this is here to get ready to use a single midtrack, followed by many multilins.
 	//get ready to use the multilin tracker.
-	parse_input_file(this->input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(this->input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	solve_options.get_PPD();
 
 	this->randomizer()->setup(this->num_variables()-this->num_patches()-2, solve_options.PPD.num_funcs);
@@ -435,6 +479,22 @@ void Surface::FixedSampleFace(int face_index, VertexSet & V, sampler_configurati
 					temp_vertex.set_type(Surface_sample_point);
 					temp_rib.push_back(V.add_vertex(temp_vertex));
 
+					if (sampler_options.use_error_estimate)
+					{
+						// how far the surface bows away from the straight segment between the endpoints.  if it's within tolerance, neither half needs more.
+						midpoint_deviation(dist_away,
+										   V[refined_rib[rr]].point(),
+										   W_new.point(0),
+										   V[refined_rib[rr+1]].point());
+
+						bool refine_halves = mpf_cmp(dist_away, sampler_options.TOL)>0;
+						refine_flags_next.push_back(refine_halves);
+						refine_flags_next.push_back(refine_halves);
+						if (refine_halves)
+							need_refinement = true;
+						continue;
+					}
+
 					dehomogenize(&dehom_left,V[refined_rib[rr]].point());
 					norm_of_difference_mindim(dist_away,
 									   dehom_left, // the current new point
@@ -483,10 +543,14 @@ void Surface::FixedSampleFace(int face_index, VertexSet & V, sampler_configurati
 		}
 	}
 
-	StitchRibs(ribs,V);
+	StitchRibs(ribs,V,face_index);
 	if (sampler_options.save_ribs)
 		SaveRibs(ribs, face_index, sampler_options);
 
+	// a fixed sampling has no passes to show along the way, so the face goes straight from its raw fan to this.
+	if (sampler_options.stream)
+		sampler_options.stream->Face(face_index, 1, samples_[face_index], V);
+
 	clear_vec_mp(blank_point);
 	clear_mp(target_projection_value);
 	mpf_clear(dist_away);
@@ -517,30 +581,36 @@ void Surface::AdaptiveSampler(VertexSet & V,
 	if (sampler_options.save_ribs)
 		PrepareForSavingRibs(sampler_options);
 
+	if (sampler_options.stream)
+		for (unsigned int ii=0; ii<num_faces(); ii++)
+			sampler_options.stream->Face(ii, 0, RawFaceTriangles(ii), V);
+
 	auto num_ribs_between_crits = AdaptiveSampleCurves(V, sampler_options, solve_options);
 
 	solve_options.force_no_parallel(true);
 	
 	//once you have the fixed samples of the curves, down here is just making the integer triangles.
-	for (unsigned int ii=0; ii<num_faces(); ii++) {
-
+	SampleFaces(V, sampler_options, [&](int ii)
+	{
 		if (faces_[ii].is_degenerate() || faces_[ii].is_malformed())
-			DegenerateSampleFace(ii,V,sampler_options, solve_options);
-		else
 		{
-			std::cout << "Face " << ii << " of " << num_faces() << std::endl;
-			if (sampler_options.verbose_level()>=1)
-				std::cout << faces_[ii];
+			DegenerateSampleFace(ii,V,sampler_options, solve_options);
+			return true;
+		}
 
-			try{
-				AdaptiveSampleFace(ii, V, sampler_options, solve_options, num_ribs_between_crits);
-			}
-			catch (std::exception & e)
-			{
-				std::cout << "bailed out on face " << ii << ".  reason: " << e.what() << std::endl;
-			}
+		std::cout << "Face " << ii << " of " << num_faces() << std::endl;
+		if (sampler_options.verbose_level()>=1)
+			std::cout << faces_[ii];
+
+		try{
+			return AdaptiveSampleFace(ii, V, sampler_options, solve_options, num_ribs_between_crits); // if any track failed, not journaled, so a restart tries it again.
 		}
-	} // re: for ii, that is for the faces
+		catch (std::exception & e)
+		{
+			std::cout << "bailed out on face " << ii << ".  reason: " << e.what() << std::endl;
+			return false; // not journaled, so a restart tries it again.
+		}
+	});
 
 	return;
 }
@@ -550,6 +620,7 @@ std::vector<int> Surface::AdaptiveSampleCurves(VertexSet & V,
 								sampler_configuration & sampler_options,
 								SolverConfiguration & solve_options)
 {
+	RunProfile::StageTimer stage("curves");
 
 	// first we need to compute the set of numbers of ribs per face.
 	// this is determined by the widths in terms of projection value.
@@ -614,6 +685,22 @@ std::vector<int> Surface::AdaptiveNumSamplesPerRib(VertexSet const& V, sampler_c
 	{
 		auto interval_ind = curr_face.crit_slice_index();
 
+		if (sampler_options.use_error_estimate)
+		{
+			// measure how far the bounding edges bow away from straight, rather than how long they are.
+			const auto& bottom_edge = curve_with_name(curr_face.system_name_bottom())->get_edge(curr_face.bottom_edge());
+			const auto& top_edge = curve_with_name(curr_face.system_name_top())->get_edge(curr_face.top_edge());
+
+			midpoint_deviation(temp1->r, V[bottom_edge.left()].point(), V[bottom_edge.midpt()].point(), V[bottom_edge.right()].point());
+			midpoint_deviation(temp2->r, V[top_edge.left()].point(), V[top_edge.midpt()].point(), V[top_edge.right()].point());
+
+			if (mpf_cmp(temp2->r, temp1->r) > 0)
+				mpf_set(temp1->r, temp2->r);
+			if (mpf_cmp(temp1->r, max_widths_found->coord[interval_ind].r) > 0)
+				mpf_set(max_widths_found->coord[interval_ind].r, temp1->r);
+			continue;
+		}
+
 		const Curve* bottom = curve_with_name(curr_face.system_name_bottom());
 
 		dehomogenize(&tempvec1,V[bottom->get_edge(curr_face.bottom_edge()).left()].point());
@@ -659,7 +746,8 @@ std::vector<int> Surface::AdaptiveNumSamplesPerRib(VertexSet const& V, sampler_c
 		div_mp(temp2, &max_widths_found->coord[ii], temp1);
 		mp_to_d(temp_d, temp2);
 
-		int est_num = ceil(temp_d->r);
+		// the deviation of a chord from a smooth curve shrinks like the square of its length, so halving the spacing quarters the error.
+		int est_num = sampler_options.use_error_estimate ? ceil(sqrt(std::max(temp_d->r,0.0))) : ceil(temp_d->r);
 
 
 		{
@@ -680,7 +768,7 @@ std::vector<int> Surface::AdaptiveNumSamplesPerRib(VertexSet const& V, sampler_c
 
 
 
-void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configuration & sampler_options,
+bool Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configuration & sampler_options,
 										SolverConfiguration & solve_options,
 								std::vector<int> const& num_ribs_between_crits)
 {
@@ -728,7 +816,7 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 
 	//this is here to get ready to use a single midtrack, followed by many multilins.
 	//get ready to use the multilin tracker.
-	parse_input_file(this->input_filename()); // restores all the temp files generated by the parser, to this folder.
+	parse_or_restore_input_file(this->input_filename(), sampler_options); // restores all the temp files generated by the parser, to this folder.
 	solve_options.get_PPD();
 
 	this->randomizer()->setup(this->num_variables()-this->num_patches()-2, solve_options.PPD.num_funcs);
@@ -941,7 +1029,29 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 	Vertex temp_vertex;
 
 
-	for (int jj=1; jj<num_ribs-1; jj++) {
+#ifdef evaluator_benchmark
+	static bool benchmarked = false;
+	if (!benchmarked && sampler_options.benchmark_evaluations>0 && num_ribs>2)
+	{
+		// time the evaluator as it stands for the first rib.  once per run.
+		ScaleByCycleNum(md_config.u_target, &u_proj_values->coord[1], cycle_num_l, cycle_num_r);
+		set_mp(md_config.v_target,half);
+		midpoint_eval_benchmark(W_midtrack, md_config, solve_options, sampler_options.benchmark_evaluations);
+		benchmarked = true;
+	}
+#endif
+
+
+	bool all_tracks_succeeded = true; // set false by any failed track, so the face is not journaled as complete.
+
+	std::vector<int> rib_startpts(num_ribs, -1);
+	std::vector< std::vector<bool> > rib_refine_flags(num_ribs);
+	std::vector<bool> rib_needs_refinement(num_ribs, false);
+
+
+	// track the first point on rib jj, from the face's midpoint by the midpoint tracker.
+	auto start_rib = [&](int jj)
+	{
 		if (sampler_options.verbose_level()>=1)
 			std::cout << "sampling rib " << jj << std::endl;
 
@@ -957,7 +1067,7 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 		}
 		catch (std::logic_error& e) {
 			std::cout << "not completing sampling this face.  reason:" << std::endl << e.what() << std::endl;
-			continue;
+			return false;
 		}
 
 
@@ -971,22 +1081,37 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 																   md_config,
 															   solve_options);
 
-		int startpt_index;
 		if (success_indicator!=SUCCESSFUL) {
 			std::cout << color::red() << "midpoint solver unsuccesful at generating first point on rib" << color::console_default() << std::endl;
-			continue;
+			all_tracks_succeeded = false;
+			return false;
 		}
 
 		WitnessSet W_new;
 		fillme.get_noninfinite_w_mult_full(W_new);
 		if (W_new.num_points()==0) {
 			std::cout << color::red() << "midpoint tracker did not return any noninfinite points" << color::console_default() << std::endl;
-			continue;
+			all_tracks_succeeded = false;
+			return false;
 		}
 
 		temp_vertex.set_type(Surface_sample_point);
 		temp_vertex.set_point(W_new.point(0));
-		startpt_index = V.add_vertex(temp_vertex);
+		rib_startpts[jj] = V.add_vertex(temp_vertex);
+
+		ribs[jj] = Rib{curr_bottom_index, rib_startpts[jj], curr_top_index};
+		rib_refine_flags[jj].assign(2, true); // guarantee at least 5 points on the rib.  seems reasonable
+		rib_needs_refinement[jj] = true;
+		return true;
+	};
+
+
+	// one pass of refinement of rib jj, by the multilin tracker from its start point.
+	auto refine_rib = [&](int jj, unsigned pass_number)
+	{
+		int startpt_index = rib_startpts[jj];
+		Rib & refined_rib = ribs[jj];
+		std::vector<bool> & refine_flags = rib_refine_flags[jj];
 
 		// need to set the values of the projections in the linears -- they are not unit-scaled as is the midpoint tracker.
 
@@ -1005,126 +1130,171 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 		// projection value 1 will be set later, when contructing the rib.
 
 
+		assert( (refine_flags.size() == refined_rib.size()-1) && "refinement flags must be one less than num entries on rib");
 
-		Rib refined_rib(3);
-		refined_rib[0] = curr_bottom_index;
-		refined_rib[1] = startpt_index;
-		refined_rib[2] = curr_top_index;
+		Rib temp_rib;
+		std::vector<bool> refine_flags_next;
+		bool rib_needs_more = false; // will set to true if points too far apart
 
+		for (unsigned rr=0; rr<refine_flags.size(); ++rr) {
+			temp_rib.push_back(refined_rib[rr]);
+			if (refine_flags[rr]) {
+				estimate_new_projection_value(target_projection_value,		// the new value
+											  V[refined_rib[rr]].point(),	//
+											  V[refined_rib[rr+1]].point(), // two points input
+											  pi(1));
 
-		std::vector<bool> refine_flags(2, true); // guarantee at least 5 points on the rib.  seems reasonable
-		bool need_refinement = true;
-		unsigned pass_number = 0;
-		while ( need_refinement && (pass_number < sampler_options.maximum_num_iterations) )
-		{
-			assert( (refine_flags.size() == refined_rib.size()-1) && "refinement flags must be one less than num entries on rib");
+				neg_mp(&target_multilin_linears[1]->coord[0],target_projection_value);
 
-			Rib temp_rib;
-			std::vector<bool> refine_flags_next;
-			need_refinement = false; // reset to no, in case don't need.  will set to true if point too far apart
+				if (sampler_options.verbose_level()>=4)
+				{
+					std::cout << "refining rib, tracking from\n";
+					print_point_to_screen_matlab(W_multilin.point(0),"startpt");
 
-			for (unsigned rr=0; rr<refine_flags.size(); ++rr) {
-				temp_rib.push_back(refined_rib[rr]);
-				if (refine_flags[rr]) {
-					estimate_new_projection_value(target_projection_value,		// the new value
-												  V[refined_rib[rr]].point(),	//
-												  V[refined_rib[rr+1]].point(), // two points input
-												  pi(1));
+					print_point_to_screen_matlab(W_multilin.linear(0),"start_linear0");
+					print_point_to_screen_matlab(W_multilin.linear(1),"start_linear1");
 
-					neg_mp(&target_multilin_linears[1]->coord[0],target_projection_value);
+					print_point_to_screen_matlab(target_multilin_linears[0],"target_linear0");
+					print_point_to_screen_matlab(target_multilin_linears[1],"target_linear1");
 
-					if (sampler_options.verbose_level()>=4)
-					{
-						std::cout << "refining rib, tracking from\n";
-						print_point_to_screen_matlab(W_multilin.point(0),"startpt");
+					print_comp_matlab(&V[refined_rib[rr]].projection_values()->coord[1],"left proj val");
+					print_comp_matlab(&V[refined_rib[rr+1]].projection_values()->coord[1],"right proj val");
+				}
 
-						print_point_to_screen_matlab(W_multilin.linear(0),"start_linear0");
-						print_point_to_screen_matlab(W_multilin.linear(1),"start_linear1");
-
-						print_point_to_screen_matlab(target_multilin_linears[0],"target_linear0");
-						print_point_to_screen_matlab(target_multilin_linears[1],"target_linear1");
-
-						print_comp_matlab(&V[refined_rib[rr]].projection_values()->coord[1],"left proj val");
-						print_comp_matlab(&V[refined_rib[rr+1]].projection_values()->coord[1],"right proj val");
-					}
-
-					SolverOutput track_result;
-					success_indicator = multilin_solver_master_entry_point(W_multilin,         // WitnessSet
+				SolverOutput track_result;
+				int success_indicator = multilin_solver_master_entry_point(W_multilin,         // WitnessSet
 																		   track_result, // the new data is put here!
 																		   target_multilin_linears,
 																		   ml_config,
 																		   solve_options);
 
-					WitnessSet W_new;
-					track_result.get_noninfinite_w_mult_full(W_new);
+				if (success_indicator!=SUCCESSFUL) {
+					std::cout << color::red() << "multilin solver unsuccessful at refining rib " << jj << color::console_default() << std::endl;
+					all_tracks_succeeded = false;
+					refine_flags_next.push_back(false);
+					continue;
+				}
 
+				WitnessSet W_new;
+				track_result.get_noninfinite_w_mult_full(W_new);
 
-					if (W_new.num_points()==0) {
-						std::cout << color::red() << "multilin tracker did not return any noninfinite points :(" << color::console_default() << std::endl;
-						refine_flags_next.push_back(false);
-						continue;
-					}
 
+				if (W_new.num_points()==0) {
+					std::cout << color::red() << "multilin tracker did not return any noninfinite points :(" << color::console_default() << std::endl;
+					refine_flags_next.push_back(false);
+					continue;
+				}
 
-					dehomogenize(&dehom_right,W_new.point(0));
-					if (!checkForReal_mp(dehom_right, (V.T())->real_threshold))
-					{
-						std::cout << color::red() << "got non-real solution sample... something strange going on!\n\nnot refining this interval any more..." << color::console_default() << '\n';
-						refine_flags_next.push_back(false);
-						continue;
 
-					}
+				dehomogenize(&dehom_right,W_new.point(0));
+				if (!checkForReal_mp(dehom_right, (V.T())->real_threshold))
+				{
+					std::cout << color::red() << "got non-real solution sample... something strange going on!\n\nnot refining this interval any more..." << color::console_default() << '\n';
+					refine_flags_next.push_back(false);
+					continue;
 
+				}
 
-					temp_vertex.set_point(W_new.point(0));
-					temp_vertex.set_type(Surface_sample_point);
-					temp_rib.push_back(V.add_vertex(temp_vertex));
 
-					dehomogenize(&dehom_left,V[refined_rib[rr]].point());
-					norm_of_difference_mindim(dist_away,
-									   dehom_left, // the current new point
-									   dehom_right);
+				temp_vertex.set_point(W_new.point(0));
+				temp_vertex.set_type(Surface_sample_point);
+				temp_rib.push_back(V.add_vertex(temp_vertex));
+
+				if (sampler_options.use_error_estimate)
+				{
+					// how far the surface bows away from the straight segment between the endpoints.  if it's within tolerance, neither half needs more.
+					midpoint_deviation(dist_away,
+									   V[refined_rib[rr]].point(),
+									   W_new.point(0),
+									   V[refined_rib[rr+1]].point());
+
+					bool refine_halves = mpf_cmp(dist_away, sampler_options.TOL)>0;
+					refine_flags_next.push_back(refine_halves);
+					refine_flags_next.push_back(refine_halves);
+					if (refine_halves)
+						rib_needs_more = true;
+					continue;
+				}
 
+				dehomogenize(&dehom_left,V[refined_rib[rr]].point());
+				norm_of_difference_mindim(dist_away,
+								   dehom_left, // the current new point
+								   dehom_right);
 
-					refine_flags_next.push_back(mpf_cmp(dist_away, sampler_options.TOL)>0);
-					if (refine_flags_next.back())
-						need_refinement = true;
 
+				refine_flags_next.push_back(mpf_cmp(dist_away, sampler_options.TOL)>0);
+				if (refine_flags_next.back())
+					rib_needs_more = true;
 
-					dehomogenize(&dehom_left,V[refined_rib[rr+1]].point());
 
-					norm_of_difference_mindim(dist_away,
-									   dehom_left, // the current new point
-									   dehom_right);
+				dehomogenize(&dehom_left,V[refined_rib[rr+1]].point());
 
+				norm_of_difference_mindim(dist_away,
+								   dehom_left, // the current new point
+								   dehom_right);
 
-					refine_flags_next.push_back(mpf_cmp(dist_away, sampler_options.TOL)>0);
-					if (refine_flags_next.back())
-						need_refinement = true;
-				} // re: if refine_flags[rr]
-				else
-					refine_flags_next.push_back(false);
 
-			} // re: for (unsigned rr=0
-			temp_rib.push_back(refined_rib.back());
-			swap(temp_rib,refined_rib);
+				refine_flags_next.push_back(mpf_cmp(dist_away, sampler_options.TOL)>0);
+				if (refine_flags_next.back())
+					rib_needs_more = true;
+			} // re: if refine_flags[rr]
+			else
+				refine_flags_next.push_back(false);
 
-			if (pass_number<sampler_options.minimum_num_iterations)
-			{
-				for (int uu = 0; uu < refine_flags_next.size(); ++uu)
-					refine_flags_next[uu] = true;
+		} // re: for (unsigned rr=0
+		temp_rib.push_back(refined_rib.back());
+		swap(temp_rib,refined_rib);
 
-				need_refinement = true;
-			}
+		if (pass_number<sampler_options.minimum_num_iterations && !sampler_options.use_error_estimate)
+		{
+			for (int uu = 0; uu < refine_flags_next.size(); ++uu)
+				refine_flags_next[uu] = true;
 
-			swap(refine_flags_next,refine_flags);
+			rib_needs_more = true;
+		}
 
+		swap(refine_flags_next,refine_flags);
 
+		rib_needs_refinement[jj] = rib_needs_more;
+	};
 
-			++pass_number;
-		} // re: while
 
-		swap(ribs[jj], refined_rib);
+	// the mesh of the face as it stands, with the midslice put in if need be.
+	auto stream_level = [&](int level)
+	{
+		std::vector<Rib> current_ribs(ribs);
+		if (num_ribs%2==0)
+			current_ribs.insert(current_ribs.begin() + num_ribs/2, current_midslice.SamplesOnEdge(mid_edge));
+		sampler_options.stream->Face(face_index, level, TriangulateRibs(current_ribs, V), V);
+	};
+
+
+	if (!sampler_options.stream)
+	{
+		// each rib to completion in turn.
+		for (int jj=1; jj<num_ribs-1; jj++)
+			if (start_rib(jj))
+				for (unsigned pass_number = 0; rib_needs_refinement[jj] && pass_number < sampler_options.maximum_num_iterations; ++pass_number)
+					refine_rib(jj, pass_number);
+	}
+	else
+	{
+		// when streaming, the ribs are refined a pass at a time, all together, so that a valid, coarser mesh of the face exists after each pass.  the samples are the same, but are added to V in a different order.
+		for (int jj=1; jj<num_ribs-1; jj++)
+			start_rib(jj);
+		stream_level(1);
+
+		for (unsigned pass_number = 0; pass_number < sampler_options.maximum_num_iterations; ++pass_number)
+		{
+			if (std::find(rib_needs_refinement.begin(), rib_needs_refinement.end(), true)==rib_needs_refinement.end())
+				break;
+
+			for (int jj=1; jj<num_ribs-1; jj++)
+				if (rib_needs_refinement[jj])
+					refine_rib(jj, pass_number);
+
+			stream_level(pass_number+2);
+		}
 	}
 
 	//check the ribs.
@@ -1146,7 +1316,7 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 	}
 
 
-	StitchRibs(ribs,V);
+	StitchRibs(ribs,V,face_index);
 	if (sampler_options.save_ribs)
 		SaveRibs(ribs, face_index, sampler_options);
 
@@ -1158,6 +1328,8 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 	clear_vec_mp(target_multilin_linears[0]); clear_vec_mp(target_multilin_linears[1]); free(target_multilin_linears);
 
 	clear_vec_mp(dehom_right); clear_vec_mp(dehom_left);
+
+	return all_tracks_succeeded;
 }
 
 
@@ -1165,7 +1337,7 @@ void Surface::AdaptiveSampleFace(int face_index, VertexSet & V, sampler_configur
 void Surface::DegenerateSampleFace(int face_index, VertexSet & V, sampler_configuration & sampler_options,
 										SolverConfiguration & solve_options)
 {
-	samples_.push_back(std::vector< Triangle >(0));
+	samples_[face_index].clear();
 }
 
 
@@ -1175,7 +1347,13 @@ void Surface::DegenerateSampleFace(int face_index, VertexSet & V, sampler_config
 //
 ///////////////
 
-void Surface::StitchRibs(std::vector<Rib> const& ribs, VertexSet & V)
+void Surface::StitchRibs(std::vector<Rib> const& ribs, VertexSet & V, int face_index)
+{
+	samples_[face_index] = TriangulateRibs(ribs, V);
+}
+
+
+std::vector< Triangle > Surface::TriangulateRibs(std::vector<Rib> const& ribs, VertexSet & V) const
 {
 	std::vector< Triangle > current_samples;
 	for (auto r = ribs.begin(); r!=ribs.end()-1; r++) {
@@ -1189,7 +1367,48 @@ void Surface::StitchRibs(std::vector<Rib> const& ribs, VertexSet & V)
 		// triangulate_two_ribs_by_angle_optimization(*r, *(r+1), V, (V.T())->real_threshold, current_samples);
 	}
 
-	samples_.push_back(current_samples);
+	return current_samples;
+}
+
+
+std::vector< Triangle > Surface::RawFaceTriangles(int face_index) const
+{
+	std::vector< Triangle > triangles;
+
+	const Face& curr_face = faces_[face_index];
+	if (curr_face.is_degenerate() || curr_face.is_malformed() || curr_face.crit_slice_index()<0)
+		return triangles;
+
+	auto fan = [&](Edge const& e, bool reverse)
+	{
+		if (e.left()<0 || e.midpt()<0 || e.right()<0)
+			return;
+		if (reverse) {
+			triangles.push_back(Triangle(e.right(), e.midpt(), curr_face.midpt()));
+			triangles.push_back(Triangle(e.midpt(), e.left(), curr_face.midpt()));
+		}
+		else {
+			triangles.push_back(Triangle(e.left(), e.midpt(), curr_face.midpt()));
+			triangles.push_back(Triangle(e.midpt(), e.right(), curr_face.midpt()));
+		}
+	};
+
+	if (curr_face.top_edge()>=0)
+		fan(curve_with_name(curr_face.system_name_top())->get_edge(curr_face.top_edge()), true);
+
+	if (curr_face.bottom_edge()>=0)
+		fan(curve_with_name(curr_face.system_name_bottom())->get_edge(curr_face.bottom_edge()), false);
+
+	auto slice_ind = curr_face.crit_slice_index();
+	for (unsigned int jj=0; jj<curr_face.num_left(); jj++)
+		if (curr_face.left_edge(jj)>=0)
+			fan(crit_slices_[slice_ind].get_edge(curr_face.left_edge(jj)), false);
+
+	for (unsigned int jj=0; jj<curr_face.num_right(); jj++)
+		if (curr_face.right_edge(jj)>=0)
+			fan(crit_slices_[slice_ind+1].get_edge(curr_face.right_edge(jj)), true);
+
+	return triangles;
 }
 
 
@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+"""
+    :platform: Unix
+    :synopsis: End-to-end benchmarks of bertini_real and sampler over the test/ corpus.
+
+Each case is copied into a scratch folder, its input's random seed is fixed,
+and then bertini (for the witness data), bertini_real and sampler are run on
+it at a fixed number of processes.  The wall time of each program, the
+per-stage profiles bertini_real and sampler write (bertini_real_profile.json
+and sampler_profile.json), and the numbers of vertices, edges, faces, paths and
+samples go into one JSON results file.
+
+Given a baseline results file, every time which grew by more than the
+tolerance, and every count which changed, is reported, and the exit status is
+nonzero if there were any.
+
+    python3 run_benchmarks.py --bindir ../../build --suite quick
+    python3 run_benchmarks.py --bindir ../../build --suite quick --baseline baseline.json
+"""
+
+import argparse
+import datetime
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+
+here = os.path.dirname(os.path.abspath(__file__))
+test_dir = os.path.dirname(here)
+
+
+def load_cases(filename, suite, names):
+    """
+    Read the case list, and pick out the cases to run, each with the defaults filled in.
+
+    :param filename: The case list, a JSON file.
+    :param suite: The name of a suite, or None.
+    :param names: A list of case names, or None.  Takes precedence over suite.
+    :return: The cases to run.
+    """
+    with open(filename) as f:
+        listing = json.load(f)
+
+    defaults = listing["defaults"]
+    cases = []
+    for case in listing["cases"]:
+        if names:
+            if case["name"] not in names:
+                continue
+        elif suite and suite not in case.get("suites", []):
+            continue
+
+        filled = dict(defaults)
+        filled.update(case)
+        filled["bertini_real_args"] = defaults["bertini_real_args"] + case.get("bertini_real_args", [])
+        filled["sampler_args"] = defaults["sampler_args"] + case.get("sampler_args", [])
+        cases.append(filled)
+
+    if names:
+        missing = set(names) - set(c["name"] for c in cases)
+        if missing:
+            raise ValueError("no such benchmark cases: " + ", ".join(sorted(missing)))
+    return cases
+
+
+def fix_seed(input_filename, seed):
+    """
+    Set the random seed in the CONFIG section of a Bertini input file, adding it if absent.
+    """
+    with open(input_filename) as f:
+        text = f.read()
+
+    seed_line = re.compile(r"^\s*randomseed\s*:.*$", re.IGNORECASE | re.MULTILINE)
+    if seed_line.search(text):
+        text = seed_line.sub("randomseed: {};".format(seed), text)
+    else:
+        text = re.sub(r"^(\s*CONFIG\s*)$", r"\1\nrandomseed: {};".format(seed), text, count=1, flags=re.IGNORECASE | re.MULTILINE)
+
+    with open(input_filename, "w") as f:
+        f.write(text)
+
+
+def launcher(procs, mpiexec):
+    """
+    The command prefix which runs a program on a number of processes.
+    """
+    if procs > 1:
+        return [mpiexec, "-n", str(procs)]
+    return []
+
+
+def run(command, cwd, timeout, log):
+    """
+    Run a command, logging its output, and time it.
+
+    :return: The wall time in seconds, and whether it succeeded.
+    """
+    log.write("$ " + " ".join(command) + "\n")
+    log.flush()
+    start = time.time()
+    try:
+        result = subprocess.run(command, cwd=cwd, stdin=subprocess.DEVNULL, stdout=log, stderr=subprocess.STDOUT, timeout=timeout)
+        ok = result.returncode == 0
+    except subprocess.TimeoutExpired:
+        log.write("timed out after {} seconds\n".format(timeout))
+        ok = False
+    return time.time() - start, ok
+
+
+def first_int(filename):
+    """
+    The first integer in a file, which for the vertex, edge and face files of a decomposition is the number of entries.
+    """
+    try:
+        with open(filename) as f:
+            return int(f.read().split()[0])
+    except (OSError, IndexError, ValueError):
+        return None
+
+
+def read_json(filename):
+    try:
+        with open(filename) as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return None
+
+
+def decomposition_dir(work_dir):
+    """
+    The folder of the decomposition bertini_real wrote, as recorded in Dir_Name.
+    """
+    try:
+        with open(os.path.join(work_dir, "Dir_Name")) as f:
+            name = f.read().split()[0]
+    except (OSError, IndexError):
+        return None
+    return os.path.join(work_dir, os.path.basename(name))
+
+
+def run_case(case, args, log):
+    """
+    Run one case from scratch, and collect its timings and counts.
+    """
+    source = os.path.join(test_dir, case["path"])
+    work_dir = tempfile.mkdtemp(prefix="br_bench_" + case["name"] + "_")
+    result = {"path": case["path"], "seed": case["seed"], "procs": case["procs"], "ok": False, "times": {}, "counts": {}}
+
+    try:
+        for entry in ("input", "sphere", "pi"):
+            if os.path.isfile(os.path.join(source, entry)):
+                shutil.copy(os.path.join(source, entry), work_dir)
+        fix_seed(os.path.join(work_dir, "input"), case["seed"])
+
+        timeout = case["timeout"]
+        prefix = launcher(case["procs"], args.mpiexec)
+
+        seconds, ok = run([args.bertini, "input"], work_dir, timeout, log)
+        result["times"]["bertini"] = seconds
+        if not ok:
+            return result
+
+        br_command = prefix + [os.path.join(args.bindir, "bertini_real")] + case["bertini_real_args"]
+        if os.path.isfile(os.path.join(work_dir, "sphere")):
+            br_command += ["-sphere", "sphere"]
+        if os.path.isfile(os.path.join(work_dir, "pi")):
+            br_command += ["-pi", "pi"]
+        seconds, ok = run(br_command, work_dir, timeout, log)
+        result["times"]["bertini_real"] = seconds
+
+        decomposition = decomposition_dir(work_dir)
+        if not ok or decomposition is None:
+            return result
+
+        profile = read_json(os.path.join(decomposition, "bertini_real_profile.json"))
+        if profile:
+            result["counts"]["paths"] = profile["num_paths"]
+            result["counts"]["solves"] = profile["num_solves"]
+            result["mpi_bytes_sent"] = profile["mpi_bytes_sent_all_procs"]
+            result["peak_rss_kb"] = profile["max_peak_rss_kb_all_procs"]
+            for stage in profile["stages"]:
+                result["times"]["bertini_real/" + stage["name"]] = stage["wall_time"]
+
+        result["counts"]["vertices"] = first_int(os.path.join(decomposition, "V.vertex"))
+        if os.path.isfile(os.path.join(decomposition, "E.edge")):
+            result["counts"]["edges"] = first_int(os.path.join(decomposition, "E.edge"))
+        if os.path.isfile(os.path.join(decomposition, "F.faces")):
+            result["counts"]["faces"] = first_int(os.path.join(decomposition, "F.faces"))
+
+        if not args.no_sampler:
+            seconds, ok = run(prefix + [os.path.join(args.bindir, "sampler")] + case["sampler_args"], work_dir, timeout, log)
+            result["times"]["sampler"] = seconds
+            if not ok:
+                return result
+
+            profile = read_json(os.path.join(decomposition, "sampler_profile.json"))
+            if profile:
+                for stage in profile["stages"]:
+                    result["times"]["sampler/" + stage["name"]] = stage["wall_time"]
+            result["counts"]["sample_vertices"] = first_int(os.path.join(decomposition, "V_samp.vertex"))
+
+        result["ok"] = True
+        return result
+    finally:
+        if args.keep:
+            result["work_dir"] = work_dir
+        else:
+            shutil.rmtree(work_dir, ignore_errors=True)
+
+
+def compare(results, baseline, tolerance, min_seconds):
+    """
+    Compare results against a baseline.
+
+    A time is a regression if it grew by more than the fraction tolerance, and by more than min_seconds, so that noise on short stages is not flagged.  Any change in a count is reported, since it means the decomposition itself changed.
+
+    :return: A list of human readable regressions.
+    """
+    regressions = []
+    for name, current in results["cases"].items():
+        old = baseline["cases"].get(name)
+        if old is None:
+            continue
+        if old["ok"] and not current["ok"]:
+            regressions.append("{}: failed, but passed in the baseline".format(name))
+            continue
+
+        for key, seconds in current["times"].items():
+            before = old["times"].get(key)
+            if before is None:
+                continue
+            if seconds > before * (1 + tolerance) and seconds - before > min_seconds:
+                regressions.append("{}: {} took {:.2f}s, baseline {:.2f}s (+{:.0f}%)".format(
+                    name, key, seconds, before, 100 * (seconds - before) / before if before > 0 else float("inf")))
+
+        for key, count in current["counts"].items():
+            before = old["counts"].get(key)
+            if before is not None and count != before:
+                regressions.append("{}: {} is {}, baseline {}".format(name, key, count, before))
+    return regressions
+
+
+def git_commit():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "HEAD"], cwd=here, stderr=subprocess.DEVNULL).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="run the bertini_real benchmarks over the test/ corpus")
+    parser.add_argument("--bindir", default=".", help="the folder containing the bertini_real and sampler executables")
+    parser.add_argument("--bertini", default="bertini", help="the bertini executable, used to compute witness data")
+    parser.add_argument("--mpiexec", default="mpiexec", help="the MPI launcher, used when a case runs on more than one process")
+    parser.add_argument("--cases", default=os.path.join(here, "cases.json"), help="the case list")
+    parser.add_argument("--suite", default="quick", help="the suite of cases to run.  'all' runs every case")
+    parser.add_argument("--only", nargs="+", help="run just these cases, by name")
+    parser.add_argument("--procs", type=int, help="override the number of processes of every case")
+    parser.add_argument("--seed", type=int, help="override the random seed of every case")
+    parser.add_argument("--output", default="benchmark_results.json", help="where to write the results")
+    parser.add_argument("--baseline", help="a results file to compare against")
+    parser.add_argument("--tolerance", type=float, default=0.2, help="the fraction by which a time may grow before it is a regression")
+    parser.add_argument("--min-seconds", type=float, default=1.0, help="the least growth in a time, in seconds, which can be a regression")
+    parser.add_argument("--no-sampler", action="store_true", help="do not run the sampler")
+    parser.add_argument("--keep", action="store_true", help="keep each case's scratch folder")
+    parser.add_argument("--log", default="benchmark.log", help="where to write the output of the programs")
+    args = parser.parse_args()
+    args.bindir = os.path.abspath(args.bindir)
+
+    cases = load_cases(args.cases, None if args.suite == "all" else args.suite, args.only)
+    for case in cases:
+        if args.procs is not None:
+            case["procs"] = args.procs
+        if args.seed is not None:
+            case["seed"] = args.seed
+
+    results = {
+        "date": datetime.datetime.now().isoformat(timespec="seconds"),
+        "commit": git_commit(),
+        "cases": {},
+    }
+
+    with open(args.log, "w") as log:
+        for case in cases:
+            print("{} ({}, {} procs, seed {}) ...".format(case["name"], case["path"], case["procs"], case["seed"]), end=" ", flush=True)
+            result = run_case(case, args, log)
+            results["cases"][case["name"]] = result
+            total = sum(result["times"].get(k, 0) for k in ("bertini", "bertini_real", "sampler"))
+            print("{} in {:.1f}s".format("ok" if result["ok"] else "FAILED", total), flush=True)
+
+    with open(args.output, "w") as f:
+        json.dump(results, f, indent=1, sort_keys=True)
+    print("results written to " + args.output)
+
+    failed = [name for name, r in results["cases"].items() if not r["ok"]]
+    if failed:
+        print("failed cases: " + ", ".join(failed) + ".  see " + args.log)
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(results, baseline, args.tolerance, args.min_seconds)
+        if regressions:
+            print("{} regressions against {}:".format(len(regressions), args.baseline))
+            for r in regressions:
+                print("\t" + r)
+            return 1
+        print("no regressions against " + args.baseline)
+
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
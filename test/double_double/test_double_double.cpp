@@ -0,0 +1,246 @@
+/**
+ \file test_double_double.cpp
+
+ checks the DoubleDouble arithmetic of double_double.hpp against mpf at 256 bits.  Every operation must agree to DoubleDouble::kBits bits, relative to the size of its operands, which is what SystemRandomizer::randomize_dd relies on.
+
+ Then checks SystemRandomizer::randomize at 64, 96 and 128 bits against the same randomization at 256 bits, which takes the MPFR path, to the precision asked for.  The first two go through randomize_dd, and the last must not.  Run by `make check`.
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "nag/double_double.hpp"
+#include "nag/system_randomizer.hpp"
+
+
+
+namespace {
+
+	const int kReferencePrec = 256;
+	const int kNumTrials = 10000;
+
+
+	// a random DoubleDouble, with a full trailing part, and exponent in [-40,40].
+	DoubleDouble RandomDD(std::mt19937_64 & gen)
+	{
+		std::uniform_real_distribution<double> unit(-1,1);
+		std::uniform_int_distribution<int> exponent(-40,40);
+
+		double hi = std::ldexp(unit(gen), exponent(gen));
+		double lo = std::ldexp(hi*unit(gen), -53);
+		return quick_two_sum(hi, lo);
+	}
+
+
+	// |computed - exact| <= 2^-kBits * scale, with everything in mpf.
+	bool Agrees(DoubleDouble const& computed, mpf_t exact, mpf_t scale, mpf_t temp, mpf_t tol)
+	{
+		dd_to_mpf(temp, computed, tol);
+		mpf_sub(temp, temp, exact);
+		mpf_abs(temp, temp);
+
+		mpf_div_2exp(tol, scale, DoubleDouble::kBits);
+		return mpf_cmp(temp, tol) <= 0;
+	}
+
+
+	int Fail(std::string const& what, DoubleDouble const& a, DoubleDouble const& b)
+	{
+		std::cout.precision(17);
+		std::cout << what << " disagrees with mpf for a = " << a.hi << " + " << a.lo << ", b = " << b.hi << " + " << b.lo << std::endl;
+		return 1;
+	}
+
+
+
+	const int kNumFuncs = 5;
+	const int kNumRandomized = 3;
+	const int kNumVars = 4; // including the homogenizing one
+
+
+	// |computed - exact| <= 2^-(prec-8), in both parts, for values of size about 1.
+	bool AgreesTo(comp_mp computed, comp_mp exact, int prec, mpf_t temp)
+	{
+		mpf_sub(temp, computed->r, exact->r);
+		mpf_abs(temp, temp);
+		mpf_mul_2exp(temp, temp, prec-8);
+		if (mpf_cmp_ui(temp, 1)>0)
+			return false;
+
+		mpf_sub(temp, computed->i, exact->i);
+		mpf_abs(temp, temp);
+		mpf_mul_2exp(temp, temp, prec-8);
+		return mpf_cmp_ui(temp, 1)<=0;
+	}
+
+
+	// randomizes random values at prec, and at kReferencePrec, which is above DoubleDouble::kBits so goes through MPFR, and compares.  the inputs are the same numbers in both.
+	int CheckRandomize(SystemRandomizer const& randomizer, int prec, std::mt19937_64 & gen)
+	{
+		std::uniform_real_distribution<double> unit(-1,1);
+
+		SystemRandomizer low = randomizer, reference = randomizer;
+		low.change_prec(prec);
+		reference.change_prec(kReferencePrec);
+
+		vec_mp f, f_ref, out_f, out_f_ref;
+		init_vec_mp2(f, kNumFuncs, prec);  f->size = kNumFuncs;
+		init_vec_mp2(f_ref, kNumFuncs, kReferencePrec);  f_ref->size = kNumFuncs;
+		init_vec_mp2(out_f, 0, prec);
+		init_vec_mp2(out_f_ref, 0, kReferencePrec);
+
+		mat_mp J, J_ref, out_J, out_J_ref;
+		init_mat_mp2(J, kNumFuncs, kNumVars, prec);  J->rows = kNumFuncs;  J->cols = kNumVars;
+		init_mat_mp2(J_ref, kNumFuncs, kNumVars, kReferencePrec);  J_ref->rows = kNumFuncs;  J_ref->cols = kNumVars;
+		init_mat_mp2(out_J, 0, 0, prec);
+		init_mat_mp2(out_J_ref, 0, 0, kReferencePrec);
+
+		comp_mp h, h_ref;  init_mp2(h, prec);  init_mp2(h_ref, kReferencePrec);
+
+		mpf_t temp;  mpf_init2(temp, kReferencePrec);
+
+		int num_failures = 0;
+		for (int trial=0; trial<100; trial++)
+		{
+			// values of size at most 1, so the homogenizing powers stay so too.
+			mpf_set_d(h->r, 0.7*unit(gen));  mpf_set_d(h->i, 0.7*unit(gen));
+			set_mp(h_ref, h);
+			for (int ii=0; ii<kNumFuncs; ii++) {
+				mpf_set_d(f->coord[ii].r, unit(gen));  mpf_set_d(f->coord[ii].i, unit(gen));
+				set_mp(&f_ref->coord[ii], &f->coord[ii]);
+				for (int jj=0; jj<kNumVars; jj++) {
+					mpf_set_d(J->entry[ii][jj].r, unit(gen));  mpf_set_d(J->entry[ii][jj].i, unit(gen));
+					set_mp(&J_ref->entry[ii][jj], &J->entry[ii][jj]);
+				}
+			}
+
+			low.randomize(out_f, out_J, f, J, h);
+			reference.randomize(out_f_ref, out_J_ref, f_ref, J_ref, h_ref);
+
+			bool agrees = true;
+			for (int ii=0; ii<kNumRandomized; ii++) {
+				agrees = agrees && AgreesTo(&out_f->coord[ii], &out_f_ref->coord[ii], prec, temp);
+				for (int jj=0; jj<kNumVars; jj++)
+					agrees = agrees && AgreesTo(&out_J->entry[ii][jj], &out_J_ref->entry[ii][jj], prec, temp);
+			}
+
+			if (!agrees) {
+				std::cout << "randomize at " << prec << " bits disagrees with MPFR at " << kReferencePrec << std::endl;
+				num_failures++;
+			}
+		}
+
+		mpf_clear(temp);
+		clear_mp(h);  clear_mp(h_ref);
+		clear_mat_mp(J);  clear_mat_mp(J_ref);  clear_mat_mp(out_J);  clear_mat_mp(out_J_ref);
+		clear_vec_mp(f);  clear_vec_mp(f_ref);  clear_vec_mp(out_f);  clear_vec_mp(out_f_ref);
+
+		return num_failures;
+	}
+
+} // re: anonymous namespace
+
+
+
+int main()
+{
+	mpf_set_default_prec(kReferencePrec);
+
+	mpf_t a, b, exact, scale, temp, tol, abs_b;
+	mpf_init(a); mpf_init(b); mpf_init(exact); mpf_init(scale); mpf_init(temp); mpf_init(tol); mpf_init(abs_b);
+
+	std::mt19937_64 gen(1729);
+
+	int num_failures = 0;
+	for (int ii=0; ii<kNumTrials; ii++) {
+		DoubleDouble x = RandomDD(gen), y = RandomDD(gen);
+		dd_to_mpf(a, x, temp);
+		dd_to_mpf(b, y, temp);
+		mpf_abs(abs_b, b);
+
+		// mpf_get_d truncates, so the round trip through mpf is not quite exact.
+		mpf_abs(scale, a);
+		if (!Agrees(mpf_to_dd(a, tol), a, scale, temp, tol))
+			num_failures += Fail("mpf_to_dd", x, y);
+
+		// sums, scaled by |a|+|b|, so cancellation is allowed for.
+		mpf_abs(scale, a);
+		mpf_add(scale, scale, abs_b);
+
+		mpf_add(exact, a, b);
+		if (!Agrees(x+y, exact, scale, temp, tol))
+			num_failures += Fail("+", x, y);
+
+		mpf_sub(exact, a, b);
+		if (!Agrees(x-y, exact, scale, temp, tol))
+			num_failures += Fail("-", x, y);
+
+		// products, scaled by |a||b|.
+		mpf_abs(scale, a);
+		mpf_mul(scale, scale, abs_b);
+
+		mpf_mul(exact, a, b);
+		if (!Agrees(x*y, exact, scale, temp, tol))
+			num_failures += Fail("*", x, y);
+
+		mpf_set_d(temp, y.hi);
+		mpf_mul(exact, a, temp);
+		mpf_abs(scale, exact);
+		if (!Agrees(x*y.hi, exact, scale, temp, tol))
+			num_failures += Fail("* double", x, y);
+	}
+
+
+	// complex products, scaled by |a||b| in the max norm, as in the randomizer's sums of products.
+	for (int ii=0; ii<kNumTrials; ii++) {
+		ComplexDoubleDouble x{RandomDD(gen), RandomDD(gen)}, y{RandomDD(gen), RandomDD(gen)};
+		ComplexDoubleDouble z = x*y;
+
+		mpf_t ar, ai, br, bi;
+		mpf_init(ar); mpf_init(ai); mpf_init(br); mpf_init(bi);
+		dd_to_mpf(ar, x.r, temp); dd_to_mpf(ai, x.i, temp);
+		dd_to_mpf(br, y.r, temp); dd_to_mpf(bi, y.i, temp);
+
+		mpf_abs(scale, ar); mpf_abs(temp, ai);
+		if (mpf_cmp(temp, scale)>0) mpf_set(scale, temp);
+		mpf_abs(abs_b, br); mpf_abs(temp, bi);
+		if (mpf_cmp(temp, abs_b)>0) mpf_set(abs_b, temp);
+		mpf_mul(scale, scale, abs_b);
+		mpf_mul_ui(scale, scale, 2);
+
+		mpf_mul(exact, ar, br); mpf_mul(temp, ai, bi); mpf_sub(exact, exact, temp);
+		if (!Agrees(z.r, exact, scale, temp, tol))
+			num_failures += Fail("complex * (real part)", x.r, y.r);
+
+		mpf_mul(exact, ar, bi); mpf_mul(temp, ai, br); mpf_add(exact, exact, temp);
+		if (!Agrees(z.i, exact, scale, temp, tol))
+			num_failures += Fail("complex * (imaginary part)", x.i, y.i);
+
+		mpf_clear(ar); mpf_clear(ai); mpf_clear(br); mpf_clear(bi);
+	}
+
+	mpf_clear(a); mpf_clear(b); mpf_clear(exact); mpf_clear(scale); mpf_clear(temp); mpf_clear(tol); mpf_clear(abs_b);
+
+
+	// the randomizer reads the degrees of the functions from deg.out.  they differ, so the homogenizing powers are exercised.
+	{
+		FILE *OUT = safe_fopen_write("deg.out");
+		fprintf(OUT, "3\n3\n2\n2\n1\n");
+		fclose(OUT);
+
+		SystemRandomizer randomizer;
+		randomizer.setup(kNumRandomized, kNumFuncs);
+		remove("deg.out");
+
+		for (int prec : {64, 96, 128})
+			num_failures += CheckRandomize(randomizer, prec, gen);
+	}
+
+	if (num_failures>0) {
+		std::cout << num_failures << " DoubleDouble operations or randomizations disagreed with mpf" << std::endl;
+		return 1;
+	}
+	return 0;
+}